@@ -0,0 +1,43 @@
+#pragma once
+
+#include "precompiled.h"
+
+#include "sbt-core.h"
+
+// Accumulates the core's statistics (see get_statistics) over several runs.
+
+struct statistic_summary {
+	std::string name;
+	double total;
+	double min;
+	double max;
+	size_t runs;
+	double mean() const { return total / runs; }
+};
+
+class run_summary {
+public:
+	// Call after each run.
+	void add_run() {
+		std::vector<sbt_statistic> stats(get_statistics(nullptr, 0));
+		if (!stats.empty()) { get_statistics(&stats.front(), stats.size()); }
+		for (auto s = stats.begin(); s != stats.end(); ++s) {
+			auto existing = std::find_if(summaries.begin(), summaries.end(), [s](const statistic_summary & summary) {
+				return summary.name == s->name;
+			});
+			if (existing == summaries.end()) {
+				statistic_summary summary = { s->name, s->value, s->value, s->value, 1 };
+				summaries.push_back(summary);
+			}
+			else {
+				existing->total += s->value;
+				existing->min = std::min(existing->min, s->value);
+				existing->max = std::max(existing->max, s->value);
+				++existing->runs;
+			}
+		}
+	}
+	const std::vector<statistic_summary> & statistics() const { return summaries; }
+private:
+	std::vector<statistic_summary> summaries;
+};
@@ -0,0 +1,160 @@
+// sbt-bench: runs the core against an input snapshot some number of times
+// and reports per-phase timings, peak memory use, and a checksum of the
+// results (so that optimizations can be checked for changed output).
+//
+// usage: sbt-bench <snapshot> [-n runs] [-f flags] [-v]
+
+#include "precompiled.h"
+
+#include "platform.h"
+#include "run_summary.h"
+#include "sbt-core.h"
+
+namespace {
+
+typedef boost::format fmt;
+
+void print(char * msg) { printf("%s", msg); }
+
+// FNV-1a, because it's simple and the checksum only needs to be stable.
+class hasher {
+public:
+	hasher() : h(14695981039346656037ULL) { }
+	void add(const void * data, size_t len) {
+		const unsigned char * bytes = static_cast<const unsigned char *>(data);
+		for (size_t i = 0; i < len; ++i) {
+			h ^= bytes[i];
+			h *= 1099511628211ULL;
+		}
+	}
+	void add(const char * str) { add(str, strlen(str)); }
+	void add(double d) {
+		// Rounded so that the checksum isn't sensitive to output noise.
+		long long rounded = (long long)floor(d * 1e6 + 0.5);
+		add(&rounded, sizeof(rounded));
+	}
+	void add(int i) { add(&i, sizeof(i)); }
+	unsigned long long value() const { return h; }
+private:
+	unsigned long long h;
+};
+
+// Space boundary GUIDs are random and the output order isn't meaningful, so
+// this combines (by addition) hashes of everything else about each
+// boundary. Vertices are combined the same way so that the checksum doesn't
+// depend on where each loop starts.
+unsigned long long checksum(space_boundary ** sbs, size_t count) {
+	unsigned long long res = 0;
+	for (size_t i = 0; i < count; ++i) {
+		const space_boundary & sb = *sbs[i];
+		hasher h;
+		h.add(sb.element_name);
+		h.add(sb.bounded_space->id);
+		h.add(sb.normal_x);
+		h.add(sb.normal_y);
+		h.add(sb.normal_z);
+		h.add(sb.is_external);
+		h.add(sb.is_virtual);
+		h.add(sb.opposite != nullptr ? 1 : 0);
+		h.add(sb.parent != nullptr ? 1 : 0);
+		for (size_t j = 0; j < sb.material_layer_count; ++j) {
+			h.add(sb.layers[j]);
+			h.add(sb.thicknesses[j]);
+		}
+		unsigned long long vertices = 0;
+		for (size_t j = 0; j < sb.geometry.vertex_count; ++j) {
+			hasher v;
+			v.add(sb.geometry.vertices[j].x);
+			v.add(sb.geometry.vertices[j].y);
+			v.add(sb.geometry.vertices[j].z);
+			vertices += v.value();
+		}
+		h.add(&vertices, sizeof(vertices));
+		res += h.value();
+	}
+	return res;
+}
+
+int usage() {
+	fprintf(stderr, "usage: sbt-bench <snapshot> [-n runs] [-f flags] [-v]\n");
+	return 2;
+}
+
+} // namespace
+
+int main(int argc, char ** argv) {
+	if (argc < 2) { return usage(); }
+	char * snapshot_path = argv[1];
+	int runs = 1;
+	int flags = -1;
+	bool verbose = false;
+	for (int i = 2; i < argc; ++i) {
+		if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) { runs = atoi(argv[++i]); }
+		else if (strcmp(argv[i], "-f") == 0 && i + 1 < argc) { flags = (int)strtol(argv[++i], nullptr, 0); }
+		else if (strcmp(argv[i], "-v") == 0) { verbose = true; }
+		else { return usage(); }
+	}
+	if (runs < 1) { return usage(); }
+
+	double load_start = platform::seconds_now();
+	sbt_input_snapshot snapshot;
+	sbt_return_t res = load_input_snapshot(snapshot_path, &snapshot);
+	if (res != SBT_OK) {
+		fprintf(stderr, "Couldn't load %s (error %i).\n", snapshot_path, (int)res);
+		return 1;
+	}
+	double load_time = platform::seconds_now() - load_start;
+	printf("%s", (fmt("Loaded %u elements and %u spaces in %.3f s.\n")
+		% snapshot.element_count % snapshot.space_count % load_time).str().c_str());
+
+	sb_calculation_options opts = snapshot.opts;
+	if (flags != -1) { opts.flags = flags; }
+	if (verbose) {
+		opts.notify_func = opts.warn_func = opts.error_func = &print;
+	}
+
+	run_summary summary;
+	boost::optional<unsigned long long> first_checksum;
+	bool checksums_match = true;
+	size_t sb_count = 0;
+	for (int run = 0; run < runs; ++run) {
+		space_boundary ** sbs;
+		res = calculate_space_boundaries(
+			snapshot.element_count,
+			snapshot.elements,
+			snapshot.space_count,
+			snapshot.spaces,
+			&sb_count,
+			&sbs,
+			opts);
+		if (res != SBT_OK) {
+			fprintf(stderr, "Run %i failed (error %i).\n", run + 1, (int)res);
+			release_input_snapshot(&snapshot);
+			return 1;
+		}
+		unsigned long long sum = checksum(sbs, sb_count);
+		release_space_boundaries(sbs, sb_count);
+		if (!first_checksum) { first_checksum = sum; }
+		else if (*first_checksum != sum) { checksums_match = false; }
+
+		summary.add_run();
+	}
+
+	printf("%s", (fmt("\n%-48s %12s %12s %12s\n") % "statistic" % "mean" % "min" % "max").str().c_str());
+	auto & stats = summary.statistics();
+	for (auto s = stats.begin(); s != stats.end(); ++s) {
+		printf("%s", (fmt("%-48s %12.4f %12.4f %12.4f\n")
+			% s->name % s->mean() % s->min % s->max).str().c_str());
+	}
+	printf("\n");
+	printf("%s", (fmt("runs:            %i\n") % runs).str().c_str());
+	printf("%s", (fmt("space boundaries: %u\n") % sb_count).str().c_str());
+	printf("%s", (fmt("peak RSS:        %.1f MiB\n")
+		% (platform::peak_resident_bytes() / (1024.0 * 1024.0))).str().c_str());
+	printf("%s", (fmt("checksum:        %016x%s\n")
+		% *first_checksum
+		% (checksums_match ? "" : " (MISMATCH BETWEEN RUNS)")).str().c_str());
+
+	release_input_snapshot(&snapshot);
+	return checksums_match ? 0 : 1;
+}
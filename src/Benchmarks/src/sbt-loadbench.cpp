@@ -0,0 +1,86 @@
+// sbt-loadbench: loads an IFC file through the IFC interface and reports how
+// long it took and how much memory it needed. The first pass does what the
+// IFC adapter does first (finding the building elements and spaces); the
+// second touches every element's placement and representation items, which
+// for a lazily-parsed model is where most of the parsing happens.
+//
+// This is built against the SPF wrapper. Built against the EDM wrapper
+// instead (in the Visual Studio solution) the same program measures EDM, so
+// the two can be compared on the same files.
+//
+// usage: sbt-loadbench <file.ifc>
+
+#include "precompiled.h"
+
+#include "../../Edm Wrapper/edm_wrapper_native_interface.h"
+
+#include "platform.h"
+
+namespace {
+
+typedef boost::format fmt;
+
+using namespace ifc_interface;
+
+double to_mib(size_t bytes) { return bytes / (1024.0 * 1024.0); }
+
+// Follows the placement chain and the representation items of an element,
+// returning how many objects were reached.
+size_t touch(const ifc_object & obj) {
+	size_t res = 0;
+	ifc_object * placement;
+	if (object_field(obj, "ObjectPlacement", &placement)) {
+		while (placement) {
+			++res;
+			ifc_object * relative;
+			object_field(*placement, "RelativePlacement", &relative);
+			ifc_object * parent = nullptr;
+			object_field(*placement, "PlacementRelTo", &parent);
+			placement = parent;
+		}
+	}
+	ifc_object * shape;
+	std::vector<ifc_object *> reps;
+	if (object_field(obj, "Representation", &shape) && shape && collection_field(*shape, "Representations", &reps)) {
+		for (auto r = reps.begin(); r != reps.end(); ++r) {
+			std::vector<ifc_object *> items;
+			if (collection_field(**r, "Items", &items)) { res += items.size(); }
+		}
+	}
+	return res;
+}
+
+} // namespace
+
+int main(int argc, char ** argv) {
+	if (argc != 2) {
+		fprintf(stderr, "usage: sbt-loadbench <file.ifc>\n");
+		return 1;
+	}
+
+	double load_start = platform::seconds_now();
+	model m(argv[1]);
+	if (!m.loaded_ok()) {
+		fprintf(stderr, "Couldn't load %s: %s\n", argv[1], m.last_error().c_str());
+		return 1;
+	}
+	std::vector<const ifc_object *> elements = m.building_elements();
+	std::vector<const ifc_object *> spaces = m.spaces();
+	double load_time = platform::seconds_now() - load_start;
+	size_t load_rss = platform::current_resident_bytes();
+
+	double walk_start = platform::seconds_now();
+	size_t touched = 0;
+	for (auto e = elements.begin(); e != elements.end(); ++e) { touched += touch(**e); }
+	for (auto s = spaces.begin(); s != spaces.end(); ++s) { touched += touch(**s); }
+	double walk_time = platform::seconds_now() - walk_start;
+
+	printf("%s", (fmt("elements:        %u\n") % elements.size()).str().c_str());
+	printf("%s", (fmt("spaces:          %u\n") % spaces.size()).str().c_str());
+	printf("%s", (fmt("objects touched: %u\n") % touched).str().c_str());
+	printf("%s", (fmt("load:            %.3f s\n") % load_time).str().c_str());
+	printf("%s", (fmt("walk:            %.3f s\n") % walk_time).str().c_str());
+	printf("%s", (fmt("RSS after load:  %.1f MiB\n") % to_mib(load_rss)).str().c_str());
+	printf("%s", (fmt("peak RSS:        %.1f MiB\n") % to_mib(platform::peak_resident_bytes())).str().c_str());
+	return 0;
+}
@@ -0,0 +1,409 @@
+// sbt-microbench: Google Benchmark suite for the 2D geometry operations that
+// dominate real runs. Every benchmark runs against synthetic polygons of
+// growing size; if SBT_MICROBENCH_SNAPSHOT names an input snapshot, the
+// faces of its elements are also projected into 2D and used as inputs for a
+// second, "captured/" set of benchmarks.
+//
+// Use --benchmark_repetitions and --benchmark_out to collect enough samples
+// to compare two builds (e.g. with compare.py from the Google Benchmark
+// tools).
+
+#include "precompiled.h"
+
+#include <benchmark/benchmark.h>
+#include <boost/random.hpp>
+
+#include "area.h"
+#include "cleanup_loop.h"
+#include "equality_context.h"
+#include "nef_polygon_util.h"
+#include "orientation.h"
+#include "oriented_area.h"
+#include "sbt-core.h"
+#include "wrapped_nef_polygon.h"
+
+extern sb_calculation_options g_opts;
+
+namespace {
+
+const double PI = 3.14159265358979323846;
+const double EPS = 0.01;
+
+polygon_2 regular_polygon(size_t n, double cx, double cy, double r) {
+	polygon_2 res;
+	for (size_t i = 0; i < n; ++i) {
+		double angle = 2 * PI * i / n;
+		res.push_back(point_2(cx + r * cos(angle), cy + r * sin(angle)));
+	}
+	return res;
+}
+
+// A non-convex polygon with n points.
+polygon_2 star_polygon(size_t points, double cx, double cy, double r) {
+	polygon_2 res;
+	for (size_t i = 0; i < points * 2; ++i) {
+		double angle = PI * i / points;
+		double radius = i % 2 == 0 ? r : r / 2;
+		res.push_back(point_2(cx + radius * cos(angle), cy + radius * sin(angle)));
+	}
+	return res;
+}
+
+// A simple area, and an area with a hole (which uses the Nef representation).
+area simple_area(size_t n, double offset) {
+	return area(regular_polygon(n, offset, 0, 10));
+}
+
+area nef_area(size_t n, double offset) {
+	std::vector<polygon_2> loops;
+	loops.push_back(regular_polygon(n, offset, 0, 10));
+	loops.push_back(regular_polygon(n, offset, 0, 3));
+	return area(loops);
+}
+
+// Captured inputs: element faces from a real model, projected onto the plane
+// their normal is closest to.
+std::vector<polygon_2> g_captured;
+
+void capture_loop(const polyloop & loop, equality_context * c) {
+	if (loop.vertex_count < 3) { return; }
+	double n[3] = { 0, 0, 0 };
+	for (size_t i = 0; i < loop.vertex_count; ++i) {
+		const point & a = loop.vertices[i];
+		const point & b = loop.vertices[(i + 1) % loop.vertex_count];
+		n[0] += (a.y - b.y) * (a.z + b.z);
+		n[1] += (a.z - b.z) * (a.x + b.x);
+		n[2] += (a.x - b.x) * (a.y + b.y);
+	}
+	int drop = fabs(n[0]) > fabs(n[1])
+		? (fabs(n[0]) > fabs(n[2]) ? 0 : 2)
+		: (fabs(n[1]) > fabs(n[2]) ? 1 : 2);
+	polygon_2 poly;
+	for (size_t i = 0; i < loop.vertex_count; ++i) {
+		double coords[3] = { loop.vertices[i].x, loop.vertices[i].y, loop.vertices[i].z };
+		poly.push_back(c->request_point(coords[drop == 0 ? 1 : 0], coords[drop == 2 ? 1 : 2]));
+	}
+	if (geometry_common::cleanup_loop(&poly, EPS) && poly.is_simple()) {
+		if (poly.is_clockwise_oriented()) { poly.reverse_orientation(); }
+		g_captured.push_back(poly);
+	}
+}
+
+void capture_snapshot(char * path) {
+	sbt_input_snapshot snapshot;
+	if (load_input_snapshot(path, &snapshot) != SBT_OK) {
+		fprintf(stderr, "Couldn't load %s; skipping the captured benchmarks.\n", path);
+		return;
+	}
+	equality_context c(EPS);
+	for (size_t i = 0; i < snapshot.element_count; ++i) {
+		const solid & s = snapshot.elements[i]->geometry;
+		if (s.rep_type == REP_EXT) {
+			capture_loop(s.rep.as_ext.area.outer_boundary, &c);
+		}
+		else if (s.rep_type == REP_BREP) {
+			for (size_t j = 0; j < s.rep.as_brep.face_count; ++j) {
+				capture_loop(s.rep.as_brep.faces[j].outer_boundary, &c);
+			}
+		}
+	}
+	release_input_snapshot(&snapshot);
+}
+
+// Each captured polygon is paired with a copy of itself shifted by a third of
+// its width, so that every pair overlaps.
+area shifted(const polygon_2 & poly) {
+	auto box = poly.bbox();
+	transformation_2 shift(CGAL::TRANSLATION, vector_2((box.xmax() - box.xmin()) / 3, 0));
+	return area(CGAL::transform(shift, poly));
+}
+
+void BM_area_intersect_simple(benchmark::State & state) {
+	area a = simple_area((size_t)state.range(0), 0);
+	area b = simple_area((size_t)state.range(0), 5);
+	while (state.KeepRunning()) {
+		area res(a);
+		res *= b;
+		benchmark::DoNotOptimize(res);
+	}
+}
+BENCHMARK(BM_area_intersect_simple)->RangeMultiplier(4)->Range(4, 256);
+
+void BM_area_intersect_nef(benchmark::State & state) {
+	area a = nef_area((size_t)state.range(0), 0);
+	area b = nef_area((size_t)state.range(0), 5);
+	while (state.KeepRunning()) {
+		area res(a);
+		res *= b;
+		benchmark::DoNotOptimize(res);
+	}
+}
+BENCHMARK(BM_area_intersect_nef)->RangeMultiplier(4)->Range(4, 256);
+
+void BM_area_subtract_simple(benchmark::State & state) {
+	area a = simple_area((size_t)state.range(0), 0);
+	area b = simple_area((size_t)state.range(0), 5);
+	while (state.KeepRunning()) {
+		area res(a);
+		res -= b;
+		benchmark::DoNotOptimize(res);
+	}
+}
+BENCHMARK(BM_area_subtract_simple)->RangeMultiplier(4)->Range(4, 256);
+
+void BM_area_subtract_nef(benchmark::State & state) {
+	area a = nef_area((size_t)state.range(0), 0);
+	area b = nef_area((size_t)state.range(0), 5);
+	while (state.KeepRunning()) {
+		area res(a);
+		res -= b;
+		benchmark::DoNotOptimize(res);
+	}
+}
+BENCHMARK(BM_area_subtract_nef)->RangeMultiplier(4)->Range(4, 256);
+
+void BM_area_union_simple(benchmark::State & state) {
+	area a = simple_area((size_t)state.range(0), 0);
+	area b = simple_area((size_t)state.range(0), 5);
+	while (state.KeepRunning()) {
+		area res(a);
+		res += b;
+		benchmark::DoNotOptimize(res);
+	}
+}
+BENCHMARK(BM_area_union_simple)->RangeMultiplier(4)->Range(4, 256);
+
+void BM_area_union_nef(benchmark::State & state) {
+	area a = nef_area((size_t)state.range(0), 0);
+	area b = nef_area((size_t)state.range(0), 5);
+	while (state.KeepRunning()) {
+		area res(a);
+		res += b;
+		benchmark::DoNotOptimize(res);
+	}
+}
+BENCHMARK(BM_area_union_nef)->RangeMultiplier(4)->Range(4, 256);
+
+// The copy that every operator benchmark above includes, for reference.
+void BM_area_copy_nef(benchmark::State & state) {
+	area a = nef_area((size_t)state.range(0), 0);
+	while (state.KeepRunning()) {
+		area res(a);
+		benchmark::DoNotOptimize(res);
+	}
+}
+BENCHMARK(BM_area_copy_nef)->RangeMultiplier(4)->Range(4, 256);
+
+void BM_area_to_simple_convex_pieces(benchmark::State & state) {
+	polygon_2 star = star_polygon((size_t)state.range(0), 0, 0, 10);
+	while (state.KeepRunning()) {
+		// Copies share the decomposition, so each iteration needs a new area.
+		state.PauseTiming();
+		area fresh(star);
+		state.ResumeTiming();
+		benchmark::DoNotOptimize(fresh.to_simple_convex_pieces());
+	}
+}
+BENCHMARK(BM_area_to_simple_convex_pieces)->RangeMultiplier(4)->Range(4, 256);
+
+void BM_nef_is_empty(benchmark::State & state) {
+	wrapped_nef_polygon nef(regular_polygon((size_t)state.range(0), 0, 0, 10));
+	nef -= wrapped_nef_polygon(regular_polygon((size_t)state.range(0), 0, 0, 3));
+	while (state.KeepRunning()) {
+		benchmark::DoNotOptimize(nef.is_empty());
+	}
+}
+BENCHMARK(BM_nef_is_empty)->RangeMultiplier(4)->Range(4, 256);
+
+void BM_nef_bbox(benchmark::State & state) {
+	wrapped_nef_polygon nef(regular_polygon((size_t)state.range(0), 0, 0, 10));
+	nef -= wrapped_nef_polygon(regular_polygon((size_t)state.range(0), 0, 0, 3));
+	while (state.KeepRunning()) {
+		benchmark::DoNotOptimize(nef.bbox());
+	}
+}
+BENCHMARK(BM_nef_bbox)->RangeMultiplier(4)->Range(4, 256);
+
+void BM_nef_clean(benchmark::State & state) {
+	// The union of overlapping polygons leaves plenty of redundant vertices
+	// for clean to remove.
+	size_t n = (size_t)state.range(0);
+	nef_polygon_2 nef = geometry_2d::nef_polygons::util::create_nef_polygon(regular_polygon(n, 0, 0, 10));
+	nef = nef.join(geometry_2d::nef_polygons::util::create_nef_polygon(regular_polygon(n, 5, 0, 10)));
+	while (state.KeepRunning()) {
+		benchmark::DoNotOptimize(geometry_2d::nef_polygons::util::clean(nef));
+	}
+}
+BENCHMARK(BM_nef_clean)->RangeMultiplier(4)->Range(4, 256);
+
+// A square face with range(0) square holes, as a wall face with that many
+// openings would be.
+void BM_nef_from_loops(benchmark::State & state) {
+	size_t holes = (size_t)state.range(0);
+	size_t per_row = (size_t)ceil(sqrt((double)holes));
+	std::vector<polygon_2> loops;
+	loops.push_back(regular_polygon(4, 0, 0, per_row * 10.0));
+	for (size_t i = 0; i < holes; ++i) {
+		double x = (double)(i % per_row) * 4 - per_row * 2.0 + 2;
+		double y = (double)(i / per_row) * 4 - per_row * 2.0 + 2;
+		loops.push_back(regular_polygon(4, x, y, 1));
+	}
+	while (state.KeepRunning()) {
+		benchmark::DoNotOptimize(wrapped_nef_polygon(loops));
+	}
+}
+BENCHMARK(BM_nef_from_loops)->Arg(1)->Arg(5)->Arg(10)->Arg(25)->Arg(50)->Arg(100)->Arg(200);
+
+// Requests points on a jittered grid, so that about half of the requests
+// snap to an existing value.
+void BM_request_point(benchmark::State & state) {
+	size_t count = (size_t)state.range(0);
+	std::vector<std::pair<double, double>> requests;
+	boost::mt19937 rng(42);
+	boost::uniform_real<> jitter(-EPS / 4, EPS / 4);
+	boost::uniform_int<> cell(0, (int)sqrt((double)count));
+	for (size_t i = 0; i < count; ++i) {
+		requests.push_back(std::make_pair(cell(rng) * 0.5 + jitter(rng), cell(rng) * 0.5 + jitter(rng)));
+	}
+	while (state.KeepRunning()) {
+		equality_context c(EPS);
+		for (auto r = requests.begin(); r != requests.end(); ++r) {
+			benchmark::DoNotOptimize(c.request_point(r->first, r->second));
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_request_point)->RangeMultiplier(8)->Range(64, 32768);
+
+// Requests slightly perturbed versions of range(0) distinct directions.
+void BM_request_orientation(benchmark::State & state) {
+	size_t distinct = (size_t)state.range(0);
+	std::vector<direction_3> requests;
+	boost::mt19937 rng(42);
+	boost::uniform_real<> jitter(-EPS / 100, EPS / 100);
+	for (size_t i = 0; i < distinct * 8; ++i) {
+		double angle = 2 * PI * (i % distinct) / distinct;
+		requests.push_back(direction_3(cos(angle) + jitter(rng), sin(angle) + jitter(rng), 0.1 + jitter(rng)));
+	}
+	while (state.KeepRunning()) {
+		equality_context c(EPS);
+		for (auto d = requests.begin(); d != requests.end(); ++d) {
+			benchmark::DoNotOptimize(c.request_orientation(*d));
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * requests.size());
+}
+BENCHMARK(BM_request_orientation)->RangeMultiplier(4)->Range(4, 256);
+
+// A polygon with a near-duplicate and a collinear point after every corner.
+void BM_cleanup_loop(benchmark::State & state) {
+	polygon_2 base = regular_polygon((size_t)state.range(0), 0, 0, 10);
+	polygon_2 noisy;
+	for (auto e = base.edges_begin(); e != base.edges_end(); ++e) {
+		noisy.push_back(e->source());
+		noisy.push_back(e->source() + vector_2(EPS / 10, 0));
+		noisy.push_back(CGAL::midpoint(e->source(), e->target()));
+	}
+	while (state.KeepRunning()) {
+		polygon_2 poly(noisy);
+		benchmark::DoNotOptimize(geometry_common::cleanup_loop(&poly, EPS));
+	}
+}
+BENCHMARK(BM_cleanup_loop)->RangeMultiplier(4)->Range(4, 256);
+
+// Flattens range(1) tilted quadrilaterals, intersects each with a shifted
+// copy of itself, and brings the result back into 3D. With range(0) set the
+// orientations are rational (SBT_RATIONAL_ORIENTATIONS).
+void BM_oriented_area_round_trip(benchmark::State & state) {
+	size_t count = (size_t)state.range(1);
+	std::vector<std::vector<point_3>> faces;
+	boost::mt19937 rng(42);
+	boost::uniform_real<> tilt(-1, 1);
+	for (size_t i = 0; i < count; ++i) {
+		double a = tilt(rng);
+		double b = tilt(rng);
+		std::vector<point_3> face;
+		face.push_back(point_3(0, 0, 0));
+		face.push_back(point_3(3, 0, 3 * a));
+		face.push_back(point_3(3, 2, 3 * a + 2 * b));
+		face.push_back(point_3(0, 2, 2 * b));
+		faces.push_back(face);
+	}
+	int old_flags = g_opts.flags;
+	g_opts.flags = state.range(0) ? SBT_RATIONAL_ORIENTATIONS : SBT_NONE;
+	while (state.KeepRunning()) {
+		equality_context c(EPS);
+		for (auto f = faces.begin(); f != faces.end(); ++f) {
+			oriented_area o(*f, &c);
+			area overlap(o.area_2d());
+			overlap *= shifted(o.area_2d().to_pwhs().front().outer());
+			benchmark::DoNotOptimize(oriented_area(o, overlap).to_3d(true));
+		}
+	}
+	g_opts.flags = old_flags;
+	state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_oriented_area_round_trip)->ArgPair(0, 16)->ArgPair(1, 16)->ArgPair(0, 64)->ArgPair(1, 64);
+
+template <typename Op>
+void run_captured(benchmark::State & state, Op op) {
+	std::vector<std::pair<area, area>> pairs;
+	for (auto p = g_captured.begin(); p != g_captured.end(); ++p) {
+		pairs.push_back(std::make_pair(area(*p), shifted(*p)));
+	}
+	while (state.KeepRunning()) {
+		for (auto p = pairs.begin(); p != pairs.end(); ++p) {
+			area res(p->first);
+			op(&res, p->second);
+			benchmark::DoNotOptimize(res);
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * pairs.size());
+}
+
+void register_captured_benchmarks() {
+	benchmark::RegisterBenchmark("captured/area_intersect", [](benchmark::State & state) {
+		run_captured(state, [](area * a, const area & b) { *a *= b; });
+	});
+	benchmark::RegisterBenchmark("captured/area_subtract", [](benchmark::State & state) {
+		run_captured(state, [](area * a, const area & b) { *a -= b; });
+	});
+	benchmark::RegisterBenchmark("captured/area_union", [](benchmark::State & state) {
+		run_captured(state, [](area * a, const area & b) { *a += b; });
+	});
+	benchmark::RegisterBenchmark("captured/to_simple_convex_pieces", [](benchmark::State & state) {
+		while (state.KeepRunning()) {
+			for (auto p = g_captured.begin(); p != g_captured.end(); ++p) {
+				benchmark::DoNotOptimize(area(*p).to_simple_convex_pieces());
+			}
+		}
+		state.SetItemsProcessed(state.iterations() * g_captured.size());
+	});
+	benchmark::RegisterBenchmark("captured/cleanup_loop", [](benchmark::State & state) {
+		while (state.KeepRunning()) {
+			for (auto p = g_captured.begin(); p != g_captured.end(); ++p) {
+				polygon_2 poly(*p);
+				benchmark::DoNotOptimize(geometry_common::cleanup_loop(&poly, EPS));
+			}
+		}
+		state.SetItemsProcessed(state.iterations() * g_captured.size());
+	});
+}
+
+} // namespace
+
+int main(int argc, char ** argv) {
+	// Nef polygon cleaning reads the tolerance from the global options, which
+	// are otherwise only set by calculate_space_boundaries. This is the
+	// tolerance sbt-scaling runs with.
+	g_opts.tolernace_in_meters = EPS;
+	char * snapshot = getenv("SBT_MICROBENCH_SNAPSHOT");
+	if (snapshot != nullptr) {
+		capture_snapshot(snapshot);
+		fprintf(stderr, "Captured %u polygons from %s.\n", (unsigned)g_captured.size(), snapshot);
+		if (!g_captured.empty()) { register_captured_benchmarks(); }
+	}
+	benchmark::Initialize(&argc, argv);
+	benchmark::RunSpecifiedBenchmarks();
+	return 0;
+}
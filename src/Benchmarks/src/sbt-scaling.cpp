@@ -0,0 +1,160 @@
+// sbt-scaling: runs the core against synthetic buildings (see
+// building_generator.h) of growing size and complexity and writes the
+// per-phase timings and memory use of each as CSV, one row per statistic, so
+// that they can be plotted against the swept parameter.
+//
+// usage: sbt-scaling [-s sweep] [-n runs] [-m max_steps]
+//
+// Sweeps: rooms, storeys, windows, columns, thickness, roof, or all (the
+// default).
+
+#include "precompiled.h"
+
+#include "building_generator.h"
+#include "run_summary.h"
+#include "sbt-core.h"
+
+using namespace building_generator;
+
+namespace {
+
+typedef boost::format fmt;
+
+struct sweep {
+	const char * name;
+	std::vector<double> values;
+	std::function<void(parameters *, double)> apply;
+};
+
+// Every sweep varies one thing about this building.
+parameters baseline() {
+	parameters p;
+	p.rooms_x = 3;
+	p.rooms_y = 3;
+	p.storeys = 1;
+	return p;
+}
+
+std::vector<sweep> all_sweeps() {
+	std::vector<sweep> res;
+	sweep s;
+
+	s.name = "rooms";
+	double rooms[] = { 1, 2, 3, 4, 6, 8, 12, 16 };
+	s.values.assign(rooms, rooms + sizeof(rooms) / sizeof(rooms[0]));
+	s.apply = [](parameters * p, double v) { p->rooms_x = p->rooms_y = (size_t)v; };
+	res.push_back(s);
+
+	s.name = "storeys";
+	double storeys[] = { 1, 2, 4, 8, 16, 32 };
+	s.values.assign(storeys, storeys + sizeof(storeys) / sizeof(storeys[0]));
+	s.apply = [](parameters * p, double v) { p->storeys = (size_t)v; };
+	res.push_back(s);
+
+	s.name = "windows";
+	double windows[] = { 0, 1, 2, 3, 4, 6 };
+	s.values.assign(windows, windows + sizeof(windows) / sizeof(windows[0]));
+	s.apply = [](parameters * p, double v) { p->windows_per_wall = (size_t)v; };
+	res.push_back(s);
+
+	// Column shape complexity, with a column at every grid intersection.
+	s.name = "columns";
+	double sides[] = { 4, 6, 8, 16, 32, 64 };
+	s.values.assign(sides, sides + sizeof(sides) / sizeof(sides[0]));
+	s.apply = [](parameters * p, double v) { p->column_spacing = 1; p->column_sides = (size_t)v; };
+	res.push_back(s);
+
+	s.name = "thickness";
+	double thicknesses[] = { 0.1, 0.2, 0.3, 0.4, 0.6 };
+	s.values.assign(thicknesses, thicknesses + sizeof(thicknesses) / sizeof(thicknesses[0]));
+	s.apply = [](parameters * p, double v) { p->wall_thickness = v; };
+	res.push_back(s);
+
+	s.name = "roof";
+	double pitches[] = { 0, 5, 15, 30, 45 };
+	s.values.assign(pitches, pitches + sizeof(pitches) / sizeof(pitches[0]));
+	s.apply = [](parameters * p, double v) { p->roof_pitch_degrees = v; };
+	res.push_back(s);
+
+	return res;
+}
+
+bool run_point(const sweep & s, double value, int runs) {
+	parameters p = baseline();
+	s.apply(&p, value);
+	building b = generate(p);
+
+	sb_calculation_options opts = create_default_options();
+	opts.tolernace_in_meters = 0.01;
+	run_summary summary;
+	size_t sb_count = 0;
+	for (int run = 0; run < runs; ++run) {
+		space_boundary ** sbs;
+		sbt_return_t res = calculate_space_boundaries(
+			b.elements.size(),
+			&b.elements.front(),
+			b.spaces.size(),
+			&b.spaces.front(),
+			&sb_count,
+			&sbs,
+			opts);
+		if (res != SBT_OK) {
+			fprintf(stderr, "%s = %g failed (error %i).\n", s.name, value, (int)res);
+			release(&b);
+			return false;
+		}
+		release_space_boundaries(sbs, sb_count);
+		summary.add_run();
+	}
+
+	auto & stats = summary.statistics();
+	for (auto stat = stats.begin(); stat != stats.end(); ++stat) {
+		printf("%s", (fmt("%s,%g,%u,%u,%u,%s,%.6f,%.6f,%.6f\n")
+			% s.name
+			% value
+			% b.elements.size()
+			% b.spaces.size()
+			% sb_count
+			% stat->name
+			% stat->mean()
+			% stat->min
+			% stat->max).str().c_str());
+	}
+	fflush(stdout);
+	release(&b);
+	return true;
+}
+
+int usage() {
+	fprintf(stderr, "usage: sbt-scaling [-s rooms|storeys|windows|columns|thickness|roof|all] [-n runs] [-m max_steps]\n");
+	return 2;
+}
+
+} // namespace
+
+int main(int argc, char ** argv) {
+	std::string which = "all";
+	int runs = 3;
+	size_t max_steps = std::numeric_limits<size_t>::max();
+	for (int i = 1; i < argc; ++i) {
+		if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) { which = argv[++i]; }
+		else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) { runs = atoi(argv[++i]); }
+		else if (strcmp(argv[i], "-m") == 0 && i + 1 < argc) { max_steps = (size_t)atoi(argv[++i]); }
+		else { return usage(); }
+	}
+	if (runs < 1) { return usage(); }
+
+	auto sweeps = all_sweeps();
+	bool found = false;
+	bool ok = true;
+	printf("sweep,value,elements,spaces,space_boundaries,statistic,mean,min,max\n");
+	for (auto s = sweeps.begin(); s != sweeps.end(); ++s) {
+		if (which != "all" && which != s->name) { continue; }
+		found = true;
+		for (size_t i = 0; i < s->values.size() && i < max_steps; ++i) {
+			ok = run_point(*s, s->values[i], runs) && ok;
+		}
+	}
+	if (!found) { return usage(); }
+	return ok ? 0 : 1;
+}
@@ -105,6 +105,93 @@ TEST(AreaIntersection, Subset) {
 	EXPECT_EQ(a_smaller, a_intr);
 }
 
+TEST(AreaCopy, ChangingCopyLeavesOriginal) {
+	point_2 square[] = {
+		point_2(0, 0),
+		point_2(2, 0),
+		point_2(2, 2),
+		point_2(0, 2)
+	};
+	point_2 corner[] = {
+		point_2(1, 1),
+		point_2(3, 1),
+		point_2(3, 3),
+		point_2(1, 3)
+	};
+	area original(polygon_2(square, square + 4));
+	area copy(original);
+	copy -= area(polygon_2(corner, corner + 4));
+	EXPECT_DOUBLE_EQ(4, CGAL::to_double(original.regular_area()));
+	EXPECT_DOUBLE_EQ(3, CGAL::to_double(copy.regular_area()));
+	area promoted(original);
+	promoted *= original;
+	EXPECT_DOUBLE_EQ(4, CGAL::to_double(original.regular_area()));
+	EXPECT_DOUBLE_EQ(4, CGAL::to_double(promoted.regular_area()));
+	copy.clear();
+	EXPECT_FALSE(original.is_empty());
+}
+
+TEST(AreaDeferredCleaning, EmptyIntermediateResults) {
+	point_2 outer[] = {
+		point_2(0, 0),
+		point_2(4, 0),
+		point_2(4, 4),
+		point_2(0, 4)
+	};
+	point_2 inner[] = {
+		point_2(1, 1),
+		point_2(2, 1),
+		point_2(2, 2),
+		point_2(1, 2)
+	};
+	area a(polygon_2(outer, outer + 4));
+	area b(polygon_2(inner, inner + 4));
+	area res = a + b;
+	res -= a;
+	res *= b;
+	EXPECT_TRUE(res.is_empty());
+	res += b;
+	EXPECT_EQ(b, res);
+	res ^= b;
+	EXPECT_TRUE(res.is_empty());
+}
+
+TEST(AreaCopy, MovedFromIsEmpty) {
+	point_2 pts[] = {
+		point_2(0, 0),
+		point_2(1, 0),
+		point_2(1, 1)
+	};
+	area original(polygon_2(pts, pts + 3));
+	area moved(std::move(original));
+	EXPECT_FALSE(moved.is_empty());
+	EXPECT_TRUE(original.is_empty());
+	original = moved;
+	EXPECT_FALSE(original.is_empty());
+}
+
+TEST(AreaToSimpleConvexPieces, SharedByCopies) {
+	point_2 pts[] = {
+		point_2(0, 0),
+		point_2(2, 0),
+		point_2(2, 1),
+		point_2(1, 1),
+		point_2(1, 2),
+		point_2(0, 2)
+	};
+	area a(polygon_2(pts, pts + 6));
+	area copy(a);
+	std::vector<polygon_2> pieces = a.to_simple_convex_pieces();
+	ASSERT_EQ(2, pieces.size());
+	EXPECT_TRUE(pieces[0].is_convex());
+	EXPECT_TRUE(pieces[1].is_convex());
+	EXPECT_DOUBLE_EQ(3, CGAL::to_double(pieces[0].area() + pieces[1].area()));
+	std::vector<polygon_2> copy_pieces = copy.to_simple_convex_pieces();
+	ASSERT_EQ(2, copy_pieces.size());
+	EXPECT_EQ(pieces[0].container(), copy_pieces[0].container());
+	EXPECT_EQ(pieces[1].container(), copy_pieces[1].container());
+}
+
 } // namespace
 
 } // namespace geometry_2d
\ No newline at end of file
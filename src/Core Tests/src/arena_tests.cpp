@@ -0,0 +1,38 @@
+#include "precompiled.h"
+
+#include <gtest/gtest.h>
+
+#include "arena.h"
+
+namespace memory {
+
+namespace {
+
+TEST(Arena, ContainersUseIt) {
+	arena a("test", 256);
+	std::list<int, arena_allocator<int>> lst((arena_allocator<int>(&a)));
+	for (int i = 0; i < 100; ++i) { lst.push_back(i); }
+	std::vector<int, arena_allocator<int>> copy(lst.begin(), lst.end(), lst.get_allocator());
+	EXPECT_EQ(100, copy.size());
+	EXPECT_EQ(99, copy.back());
+	EXPECT_EQ(&a, copy.get_allocator().source());
+}
+
+TEST(Arena, ResetReusesMemory) {
+	arena a("test", 1024);
+	void * first = a.allocate(100);
+	a.allocate(2000); // bigger than a chunk
+	a.reset();
+	EXPECT_EQ(first, a.allocate(100));
+}
+
+TEST(Arena, AllocatorWithoutArena) {
+	std::vector<double, arena_allocator<double>> v;
+	v.assign(1000, 1.5);
+	EXPECT_EQ(1.5, v[999]);
+	EXPECT_EQ(nullptr, v.get_allocator().source());
+}
+
+} // namespace
+
+} // namespace memory
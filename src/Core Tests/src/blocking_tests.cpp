@@ -417,6 +417,20 @@ TEST(SurfacePairHeightComparison, AngledAllEdgesConsistent) {
 	}
 }
 
+TEST(Blocking, BuildingBlocksReleasesElementGeometry) {
+	equality_context c(0.01);
+
+	std::vector<element> elements;
+	elements.push_back(element(create_dummy_element(), &c));
+	bbox_3 original_box = elements.front().bounding_box();
+
+	auto blocks = build_blocks(&elements, &c);
+	EXPECT_FALSE(blocks.empty());
+	EXPECT_FALSE(elements.front().has_geometry());
+	EXPECT_EQ(original_box, elements.front().bounding_box());
+	EXPECT_EQ(&elements.front(), &blocks.front().material_layer().layer_element());
+}
+
 } // namespace
 
 } // namespace impl
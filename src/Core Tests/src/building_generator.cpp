@@ -0,0 +1,370 @@
+#include "precompiled.h"
+
+#include "common.h"
+
+#include "building_generator.h"
+
+namespace building_generator {
+
+namespace {
+
+typedef std::vector<simple_point> loop_points;
+
+const double PI = 3.14159265358979323846;
+
+polyloop create_loop(const loop_points & points) {
+	polyloop res;
+	res.vertex_count = points.size();
+	res.vertices = (point *)malloc(sizeof(point) * res.vertex_count);
+	for (size_t i = 0; i < points.size(); ++i) {
+		res.vertices[i].x = points[i].x;
+		res.vertices[i].y = points[i].y;
+		res.vertices[i].z = points[i].z;
+	}
+	return res;
+}
+
+// The component of the loop's (Newell) normal along (dx, dy, dz).
+double normal_along(const loop_points & points, double dx, double dy, double dz) {
+	double nx = 0, ny = 0, nz = 0;
+	for (size_t i = 0; i < points.size(); ++i) {
+		const simple_point & a = points[i];
+		const simple_point & b = points[(i + 1) % points.size()];
+		nx += (a.y - b.y) * (a.z + b.z);
+		ny += (a.z - b.z) * (a.x + b.x);
+		nz += (a.x - b.x) * (a.y + b.y);
+	}
+	return nx * dx + ny * dy + nz * dz;
+}
+
+// Creates an extrusion whose base has its outer boundary wound around the
+// extrusion direction and its voids wound the other way.
+solid create_extrusion(
+	loop_points outer,
+	std::vector<loop_points> voids,
+	double dx,
+	double dy,
+	double dz,
+	double depth)
+{
+	if (normal_along(outer, dx, dy, dz) < 0) { std::reverse(outer.begin(), outer.end()); }
+	face f;
+	memset(&f, 0, sizeof(f));
+	f.outer_boundary = create_loop(outer);
+	f.void_count = voids.size();
+	if (!voids.empty()) {
+		f.voids = (polyloop *)malloc(sizeof(polyloop) * f.void_count);
+		for (size_t i = 0; i < voids.size(); ++i) {
+			if (normal_along(voids[i], dx, dy, dz) > 0) { std::reverse(voids[i].begin(), voids[i].end()); }
+			f.voids[i] = create_loop(voids[i]);
+		}
+	}
+	return create_ext(dx, dy, dz, depth, f);
+}
+
+solid create_extrusion(const loop_points & outer, double dx, double dy, double dz, double depth) {
+	return create_extrusion(outer, std::vector<loop_points>(), dx, dy, dz, depth);
+}
+
+loop_points rect_xy(double z, double x0, double x1, double y0, double y1) {
+	loop_points res;
+	res.push_back(simple_point(x0, y0, z));
+	res.push_back(simple_point(x1, y0, z));
+	res.push_back(simple_point(x1, y1, z));
+	res.push_back(simple_point(x0, y1, z));
+	return res;
+}
+
+// A quadrilateral in the plane y = y whose bottom is horizontal and whose top
+// may slope.
+loop_points trapezoid_xz(double y, double x0, double x1, double z_bottom, double z_top0, double z_top1) {
+	loop_points res;
+	res.push_back(simple_point(x0, y, z_bottom));
+	res.push_back(simple_point(x1, y, z_bottom));
+	res.push_back(simple_point(x1, y, z_top1));
+	res.push_back(simple_point(x0, y, z_top0));
+	return res;
+}
+
+loop_points rect_xz(double y, double x0, double x1, double z0, double z1) {
+	return trapezoid_xz(y, x0, x1, z0, z1, z1);
+}
+
+loop_points rect_yz(double x, double y0, double y1, double z0, double z1) {
+	loop_points res;
+	res.push_back(simple_point(x, y0, z0));
+	res.push_back(simple_point(x, y1, z0));
+	res.push_back(simple_point(x, y1, z1));
+	res.push_back(simple_point(x, y0, z1));
+	return res;
+}
+
+// Windows are described by where they are along their wall (a0 to a1) and
+// vertically (z0 to z1).
+struct window_extents {
+	double a0;
+	double a1;
+	double z0;
+	double z1;
+};
+
+class generator {
+public:
+	explicit generator(const parameters & p)
+		: p(p),
+		half_t(p.wall_thickness / 2),
+		x_min(-p.wall_thickness / 2),
+		x_max(p.rooms_x * p.room_width + p.wall_thickness / 2),
+		y_min(-p.wall_thickness / 2),
+		y_max(p.rooms_y * p.room_depth + p.wall_thickness / 2),
+		slope(tan(p.roof_pitch_degrees * PI / 180.0)),
+		next_element(1)
+	{ }
+
+	building run() {
+		for (size_t k = 0; k < p.storeys; ++k) {
+			add_slab(k);
+			add_x_walls(k);
+			add_y_walls(k);
+			add_columns(k);
+			add_spaces(k);
+		}
+		if (sloped()) { add_roof(); }
+		else { add_slab(p.storeys); }
+		return res;
+	}
+
+private:
+	const parameters & p;
+	double half_t;
+	double x_min;
+	double x_max;
+	double y_min;
+	double y_max;
+	double slope;
+	size_t next_element;
+	building res;
+
+	double grid_x(size_t i) const { return i * p.room_width; }
+	double grid_y(size_t j) const { return j * p.room_depth; }
+	bool sloped() const { return p.roof_pitch_degrees > 0; }
+	bool sloped_storey(size_t k) const { return sloped() && k + 1 == p.storeys; }
+	double storey_bottom(size_t k) const { return k * p.storey_height + p.slab_thickness; }
+	double storey_top(size_t k, double x) const {
+		return sloped_storey(k)
+			? p.storeys * p.storey_height + (x - x_min) * slope
+			: (k + 1) * p.storey_height;
+	}
+
+	void add_element(const char * kind, element_type type, element_id_t material, solid geometry) {
+		std::string name = (boost::format("%s %u") % kind % next_element++).str();
+		res.elements.push_back(create_element(name.c_str(), type, material, geometry));
+	}
+
+	// Evenly spaces the windows of one room's stretch of wall.
+	std::vector<window_extents> windows_between(double a0, double a1, double z_bottom, double z_top) const {
+		std::vector<window_extents> windows;
+		if (p.windows_per_wall == 0) { return windows; }
+		window_extents w;
+		w.z0 = z_bottom + p.sill_height;
+		w.z1 = w.z0 + p.window_height;
+		if (w.z1 >= z_top) { return windows; }
+		double slot = (a1 - a0) / p.windows_per_wall;
+		double width = std::min(p.window_width, slot * 0.8);
+		for (size_t n = 0; n < p.windows_per_wall; ++n) {
+			double center = a0 + slot * (n + 0.5);
+			w.a0 = center - width / 2;
+			w.a1 = center + width / 2;
+			windows.push_back(w);
+		}
+		return windows;
+	}
+
+	void add_slab(size_t level) {
+		add_element("slab", SLAB, SLAB_MATERIAL, create_extrusion(
+			rect_xy(level * p.storey_height, x_min, x_max, y_min, y_max),
+			0, 0, 1, p.slab_thickness));
+	}
+
+	void add_roof() {
+		double z_low = p.storeys * p.storey_height;
+		double z_high = z_low + (x_max - x_min) * slope;
+		loop_points profile;
+		profile.push_back(simple_point(x_min, y_min, z_low));
+		profile.push_back(simple_point(x_max, y_min, z_high));
+		profile.push_back(simple_point(x_max, y_min, z_high + p.slab_thickness));
+		profile.push_back(simple_point(x_min, y_min, z_low + p.slab_thickness));
+		add_element("roof", SLAB, ROOF_MATERIAL, create_extrusion(profile, 0, 1, 0, y_max - y_min));
+	}
+
+	// The walls along the x axis run the full length of the building.
+	void add_x_walls(size_t k) {
+		double z_bottom = storey_bottom(k);
+		for (size_t j = 0; j <= p.rooms_y; ++j) {
+			double y = grid_y(j) - half_t;
+			std::vector<loop_points> voids;
+			if (j == 0 || j == p.rooms_y) {
+				for (size_t i = 0; i < p.rooms_x; ++i) {
+					double a0 = grid_x(i) + half_t;
+					double a1 = grid_x(i + 1) - half_t;
+					auto windows = windows_between(a0, a1, z_bottom, std::min(storey_top(k, a0), storey_top(k, a1)));
+					for (auto w = windows.begin(); w != windows.end(); ++w) {
+						voids.push_back(rect_xz(y, w->a0, w->a1, w->z0, w->z1));
+						add_element("window", WINDOW, WINDOW_MATERIAL, create_extrusion(
+							rect_xz(y, w->a0, w->a1, w->z0, w->z1),
+							0, 1, 0, p.wall_thickness));
+					}
+				}
+			}
+			add_element("wall", WALL, WALL_MATERIAL, create_extrusion(
+				trapezoid_xz(y, x_min, x_max, z_bottom, storey_top(k, x_min), storey_top(k, x_max)),
+				voids,
+				0, 1, 0, p.wall_thickness));
+		}
+	}
+
+	// The walls along the y axis fit between the x walls. Under a sloped roof
+	// they're extruded along their length so that their tops can follow the
+	// roof, which means that the gable ends don't get windows.
+	void add_y_walls(size_t k) {
+		double z_bottom = storey_bottom(k);
+		for (size_t i = 0; i <= p.rooms_x; ++i) {
+			double x = grid_x(i);
+			for (size_t j = 0; j < p.rooms_y; ++j) {
+				double y0 = grid_y(j) + half_t;
+				double y1 = grid_y(j + 1) - half_t;
+				if (sloped_storey(k)) {
+					add_element("wall", WALL, WALL_MATERIAL, create_extrusion(
+						trapezoid_xz(y0, x - half_t, x + half_t, z_bottom, storey_top(k, x - half_t), storey_top(k, x + half_t)),
+						0, 1, 0, y1 - y0));
+					continue;
+				}
+				double z_top = storey_top(k, x);
+				std::vector<loop_points> voids;
+				if (i == 0 || i == p.rooms_x) {
+					auto windows = windows_between(y0, y1, z_bottom, z_top);
+					for (auto w = windows.begin(); w != windows.end(); ++w) {
+						voids.push_back(rect_yz(x - half_t, w->a0, w->a1, w->z0, w->z1));
+						add_element("window", WINDOW, WINDOW_MATERIAL, create_extrusion(
+							rect_yz(x - half_t, w->a0, w->a1, w->z0, w->z1),
+							1, 0, 0, p.wall_thickness));
+					}
+				}
+				add_element("wall", WALL, WALL_MATERIAL, create_extrusion(
+					rect_yz(x - half_t, y0, y1, z_bottom, z_top),
+					voids,
+					1, 0, 0, p.wall_thickness));
+			}
+		}
+	}
+
+	// Columns are regular polygons whose inscribed circle has a diameter of
+	// column_width, so four-sided columns are axis-aligned squares.
+	void add_columns(size_t k) {
+		if (p.column_spacing == 0 || p.column_sides < 3) { return; }
+		double z_bottom = storey_bottom(k);
+		double inradius = p.column_width / 2;
+		double circumradius = inradius / cos(PI / p.column_sides);
+		for (size_t i = 0; i <= p.rooms_x; i += p.column_spacing) {
+			for (size_t j = 0; j <= p.rooms_y; j += p.column_spacing) {
+				double cx = grid_x(i);
+				double cy = grid_y(j);
+				loop_points profile;
+				for (size_t n = 0; n < p.column_sides; ++n) {
+					double angle = PI / p.column_sides + 2 * PI * n / p.column_sides;
+					profile.push_back(simple_point(
+						cx + circumradius * cos(angle),
+						cy + circumradius * sin(angle),
+						z_bottom));
+				}
+				double z_top = storey_top(k, cx - circumradius);
+				add_element("column", COLUMN, COLUMN_MATERIAL, create_extrusion(
+					profile, 0, 0, 1, z_top - z_bottom));
+			}
+		}
+	}
+
+	void add_spaces(size_t k) {
+		double z_bottom = storey_bottom(k);
+		for (size_t i = 0; i < p.rooms_x; ++i) {
+			double x0 = grid_x(i) + half_t;
+			double x1 = grid_x(i + 1) - half_t;
+			for (size_t j = 0; j < p.rooms_y; ++j) {
+				double y0 = grid_y(j) + half_t;
+				double y1 = grid_y(j + 1) - half_t;
+				std::string name = (boost::format("space %u.%u.%u") % k % i % j).str();
+				solid geometry = sloped_storey(k)
+					? create_extrusion(
+						trapezoid_xz(y0, x0, x1, z_bottom, storey_top(k, x0), storey_top(k, x1)),
+						0, 1, 0, y1 - y0)
+					: create_extrusion(
+						rect_xy(z_bottom, x0, x1, y0, y1),
+						0, 0, 1, storey_top(k, x0) - z_bottom);
+				res.spaces.push_back(create_space(name.c_str(), geometry));
+			}
+		}
+	}
+
+	generator(const generator &);
+	generator & operator = (const generator &);
+};
+
+void release_face(face * f) {
+	free(f->outer_boundary.vertices);
+	for (size_t i = 0; i < f->void_count; ++i) {
+		free(f->voids[i].vertices);
+	}
+	free(f->voids);
+}
+
+void release_solid(solid * s) {
+	if (s->rep_type == REP_EXT) {
+		release_face(&s->rep.as_ext.area);
+	}
+	else if (s->rep_type == REP_BREP) {
+		for (size_t i = 0; i < s->rep.as_brep.face_count; ++i) {
+			release_face(&s->rep.as_brep.faces[i]);
+		}
+		free(s->rep.as_brep.faces);
+	}
+}
+
+} // namespace
+
+parameters::parameters()
+	: rooms_x(2),
+	rooms_y(2),
+	storeys(1),
+	room_width(5.0),
+	room_depth(4.0),
+	storey_height(3.0),
+	wall_thickness(0.3),
+	slab_thickness(0.3),
+	windows_per_wall(1),
+	window_width(1.2),
+	window_height(1.5),
+	sill_height(0.9),
+	column_spacing(0),
+	column_sides(4),
+	column_width(0.4),
+	roof_pitch_degrees(0)
+{ }
+
+building generate(const parameters & p) {
+	return generator(p).run();
+}
+
+void release(building * b) {
+	for (auto e = b->elements.begin(); e != b->elements.end(); ++e) {
+		release_solid(&(*e)->geometry);
+		free(*e);
+	}
+	for (auto s = b->spaces.begin(); s != b->spaces.end(); ++s) {
+		release_solid(&(*s)->geometry);
+		free(*s);
+	}
+	b->elements.clear();
+	b->spaces.clear();
+}
+
+} // namespace building_generator
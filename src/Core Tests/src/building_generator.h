@@ -0,0 +1,62 @@
+#pragma once
+
+#include "precompiled.h"
+
+#include "sbt-core.h"
+
+// Parametric synthetic buildings, for tests and scaling benchmarks. A
+// building is a rectangular grid of rooms_x by rooms_y rooms repeated over
+// some number of storeys:
+//  - every storey sits on a slab covering the whole footprint,
+//  - walls are centered on the grid lines, with the walls running along the
+//    x axis continuous and the ones running along the y axis split between
+//    them,
+//  - exterior walls get windows_per_wall windows per room (except for the
+//    gable ends of a sloped roof),
+//  - columns of column_sides sides stand at every column_spacing-th grid
+//    intersection (none if column_spacing is 0), and
+//  - the building is capped either by a flat slab or by a roof that rises
+//    along the x axis, in which case the top storey's spaces and walls
+//    follow the slope.
+// Everything is in meters.
+
+namespace building_generator {
+
+struct parameters {
+	size_t rooms_x;
+	size_t rooms_y;
+	size_t storeys;
+	double room_width;
+	double room_depth;
+	double storey_height;
+	double wall_thickness;
+	double slab_thickness;
+	size_t windows_per_wall;
+	double window_width;
+	double window_height;
+	double sill_height;
+	size_t column_spacing;
+	size_t column_sides;
+	double column_width;
+	double roof_pitch_degrees; // 0 for a flat roof
+	parameters();
+};
+
+struct building {
+	std::vector<element_info *> elements;
+	std::vector<space_info *> spaces;
+};
+
+// Element IDs (i.e. materials) of the generated elements.
+const element_id_t WALL_MATERIAL = 1;
+const element_id_t SLAB_MATERIAL = 2;
+const element_id_t WINDOW_MATERIAL = 3;
+const element_id_t COLUMN_MATERIAL = 4;
+const element_id_t ROOF_MATERIAL = 5;
+
+building generate(const parameters & p);
+
+// Frees everything generate allocated.
+void release(building * b);
+
+} // namespace building_generator
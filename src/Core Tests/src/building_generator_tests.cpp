@@ -0,0 +1,87 @@
+#include "precompiled.h"
+
+#include "building_generator.h"
+#include "common.h"
+
+namespace building_generator {
+
+namespace {
+
+size_t count_of(const building & b, element_type type) {
+	return std::count_if(b.elements.begin(), b.elements.end(), [type](element_info * e) {
+		return e->type == type;
+	});
+}
+
+std::map<std::string, size_t> boundaries_per_space(building & b) {
+	sb_calculation_options opts = create_default_options();
+	opts.tolernace_in_meters = 0.01;
+	size_t count;
+	space_boundary ** sbs;
+	EXPECT_EQ(SBT_OK, calculate_space_boundaries(
+		b.elements.size(),
+		&b.elements.front(),
+		b.spaces.size(),
+		&b.spaces.front(),
+		&count,
+		&sbs,
+		opts));
+	std::map<std::string, size_t> res;
+	for (size_t i = 0; i < count; ++i) {
+		if (sbs[i]->parent == nullptr) {
+			++res[sbs[i]->bounded_space->id];
+		}
+	}
+	release_space_boundaries(sbs, count);
+	return res;
+}
+
+TEST(BuildingGenerator, ElementCounts) {
+	parameters p;
+	p.rooms_x = 3;
+	p.rooms_y = 2;
+	p.storeys = 2;
+	p.windows_per_wall = 2;
+	p.column_spacing = 1;
+	building b = generate(p);
+	EXPECT_EQ(3 * 2 * 2, b.spaces.size());
+	EXPECT_EQ(3, count_of(b, SLAB));
+	// Per storey: three long walls and four rows of two short ones.
+	EXPECT_EQ(2 * (3 + 4 * 2), count_of(b, WALL));
+	// Per storey: ten exterior room walls with two windows each.
+	EXPECT_EQ(2 * 10 * 2, count_of(b, WINDOW));
+	EXPECT_EQ(2 * 4 * 3, count_of(b, COLUMN));
+	release(&b);
+}
+
+TEST(BuildingGenerator, GableEndsHaveNoWindows) {
+	parameters p;
+	p.rooms_x = 1;
+	p.rooms_y = 1;
+	p.roof_pitch_degrees = 15;
+	building b = generate(p);
+	EXPECT_EQ(2, count_of(b, SLAB)); // the floor slab and the roof
+	EXPECT_EQ(2, count_of(b, WINDOW));
+	release(&b);
+}
+
+TEST(BuildingGenerator, EveryRoomIsEnclosed) {
+	parameters p;
+	p.rooms_x = 2;
+	p.rooms_y = 1;
+	p.storeys = 2;
+	p.column_spacing = 2;
+	p.column_sides = 6;
+	p.roof_pitch_degrees = 10;
+	building b = generate(p);
+	auto counts = boundaries_per_space(b);
+	EXPECT_EQ(b.spaces.size(), counts.size());
+	for (auto c = counts.begin(); c != counts.end(); ++c) {
+		EXPECT_LE(6, c->second) << c->first;
+	}
+	release(&b);
+}
+
+} // namespace
+
+} // namespace building_generator
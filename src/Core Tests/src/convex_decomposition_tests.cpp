@@ -0,0 +1,145 @@
+#include "precompiled.h"
+
+#include <gtest/gtest.h>
+
+#include "convex_decomposition.h"
+
+namespace geometry_2d {
+
+namespace convex_decomposition {
+
+namespace {
+
+NT total_area(const std::vector<polygon_2> & pieces) {
+	NT res = 0;
+	for (auto p = pieces.begin(); p != pieces.end(); ++p) {
+		res += p->area();
+	}
+	return res;
+}
+
+TEST(ConvexDecomposition, LShape) {
+	point_2 pts[] = {
+		point_2(0, 0),
+		point_2(2, 0),
+		point_2(2, 1),
+		point_2(1, 1),
+		point_2(1, 2),
+		point_2(0, 2)
+	};
+	auto pieces = decompose(polygon_2(pts, pts + 6));
+	ASSERT_TRUE(pieces);
+	EXPECT_EQ(2, pieces->size());
+	for (auto p = pieces->begin(); p != pieces->end(); ++p) {
+		EXPECT_TRUE(p->is_convex());
+		EXPECT_EQ(CGAL::COUNTERCLOCKWISE, p->orientation());
+	}
+	EXPECT_DOUBLE_EQ(3, CGAL::to_double(total_area(*pieces)));
+}
+
+TEST(ConvexDecomposition, ClockwiseComb) {
+	// three teeth pointing up, listed clockwise
+	point_2 pts[] = {
+		point_2(0, 0),
+		point_2(0, 3),
+		point_2(1, 3),
+		point_2(1, 1),
+		point_2(2, 1),
+		point_2(2, 3),
+		point_2(3, 3),
+		point_2(3, 1),
+		point_2(4, 1),
+		point_2(4, 3),
+		point_2(5, 3),
+		point_2(5, 0)
+	};
+	auto pieces = decompose(polygon_2(pts, pts + 12));
+	ASSERT_TRUE(pieces);
+	EXPECT_LE(4, pieces->size());
+	EXPECT_GE(16, pieces->size());
+	for (auto p = pieces->begin(); p != pieces->end(); ++p) {
+		EXPECT_TRUE(p->is_convex());
+		EXPECT_EQ(CGAL::COUNTERCLOCKWISE, p->orientation());
+	}
+	EXPECT_DOUBLE_EQ(11, CGAL::to_double(total_area(*pieces)));
+}
+
+TEST(ConvexDecomposition, CollinearVerticesKept) {
+	point_2 pts[] = {
+		point_2(0, 0),
+		point_2(1, 0),
+		point_2(2, 0),
+		point_2(2, 2),
+		point_2(0, 2),
+		point_2(0, 1)
+	};
+	auto pieces = decompose(polygon_2(pts, pts + 6));
+	ASSERT_TRUE(pieces);
+	ASSERT_EQ(1, pieces->size());
+	EXPECT_EQ(6, pieces->front().size());
+}
+
+TEST(ConvexDecomposition, CollinearVerticesKeptInTheirPieces) {
+	point_2 pts[] = {
+		point_2(0, 0),
+		point_2(1, 0),
+		point_2(2, 0),
+		point_2(2, 1),
+		point_2(1, 1),
+		point_2(1, 2),
+		point_2(0, 2),
+		point_2(0, 1)
+	};
+	auto pieces = decompose(polygon_2(pts, pts + 8));
+	ASSERT_TRUE(pieces);
+	EXPECT_EQ(2, pieces->size());
+	size_t with_bottom_midpoint = 0;
+	size_t with_left_midpoint = 0;
+	for (auto p = pieces->begin(); p != pieces->end(); ++p) {
+		EXPECT_TRUE(p->is_convex());
+		with_bottom_midpoint += std::count(p->vertices_begin(), p->vertices_end(), point_2(1, 0));
+		with_left_midpoint += std::count(p->vertices_begin(), p->vertices_end(), point_2(0, 1));
+	}
+	EXPECT_EQ(1, with_bottom_midpoint);
+	EXPECT_EQ(1, with_left_midpoint);
+	EXPECT_DOUBLE_EQ(3, CGAL::to_double(total_area(*pieces)));
+}
+
+TEST(ConvexDecomposition, RepeatedVerticesKeptOnce) {
+	point_2 pts[] = {
+		point_2(0, 0),
+		point_2(1, 0),
+		point_2(1, 0),
+		point_2(2, 0),
+		point_2(2, 1),
+		point_2(1, 1),
+		point_2(1, 2),
+		point_2(0, 2),
+		point_2(0, 2)
+	};
+	auto pieces = decompose(polygon_2(pts, pts + 9));
+	ASSERT_TRUE(pieces);
+	EXPECT_EQ(2, pieces->size());
+	for (auto p = pieces->begin(); p != pieces->end(); ++p) {
+		for (size_t i = 0; i < p->size(); ++i) {
+			EXPECT_NE((*p)[i], (*p)[(i + 1) % p->size()]);
+		}
+	}
+	EXPECT_DOUBLE_EQ(3, CGAL::to_double(total_area(*pieces)));
+}
+
+TEST(ConvexDecomposition, NotSimple) {
+	point_2 pts[] = {
+		point_2(0, 0),
+		point_2(1, 1),
+		point_2(1, 0),
+		point_2(0, 1)
+	};
+	EXPECT_FALSE(decompose(polygon_2(pts, pts + 4)));
+}
+
+} // namespace
+
+} // namespace convex_decomposition
+
+} // namespace geometry_2d
@@ -0,0 +1,86 @@
+#include "precompiled.h"
+
+#include <fstream>
+
+#include "sbt-core.h"
+
+#include "common.h"
+
+namespace {
+
+char snapshot_filename[] = "input_snapshot_test.sbtsnap";
+
+TEST(InputSnapshot, RoundTrip) {
+	face f = create_face(4,
+		simple_point(0, 0, 0),
+		simple_point(1, 0, 0),
+		simple_point(1, 1, 0),
+		simple_point(0, 1, 0));
+	face g = create_face(3,
+		simple_point(0, 0, 0),
+		simple_point(1, 0, 1),
+		simple_point(1, 1, 1));
+	element_info * e = create_element("wall", WALL, 7, create_brep(2, f, g));
+	space_info * s = create_space("space", create_ext(0, 0, 1, 3, f));
+
+	char space_name[] = "space";
+	char * space_filter[] = { space_name };
+	sb_calculation_options opts = create_default_options();
+	opts.length_units_per_meter = 1000.0;
+	opts.tolernace_in_meters = 0.01;
+	opts.space_filter = space_filter;
+	opts.space_filter_count = 1;
+
+	ASSERT_EQ(SBT_OK, write_input_snapshot(
+		snapshot_filename, 1, &e, 1, &s, opts));
+
+	sbt_input_snapshot snapshot;
+	ASSERT_EQ(SBT_OK, load_input_snapshot(snapshot_filename, &snapshot));
+
+	ASSERT_EQ(1, snapshot.element_count);
+	const element_info & e2 = *snapshot.elements[0];
+	EXPECT_STREQ("wall", e2.name);
+	EXPECT_EQ(WALL, e2.type);
+	EXPECT_EQ(7, e2.id);
+	ASSERT_EQ(REP_BREP, e2.geometry.rep_type);
+	ASSERT_EQ(2, e2.geometry.rep.as_brep.face_count);
+	const polyloop & loop = e2.geometry.rep.as_brep.faces[1].outer_boundary;
+	ASSERT_EQ(3, loop.vertex_count);
+	EXPECT_EQ(1.0, loop.vertices[2].y);
+	EXPECT_EQ(1.0, loop.vertices[2].z);
+
+	ASSERT_EQ(1, snapshot.space_count);
+	const space_info & s2 = *snapshot.spaces[0];
+	EXPECT_STREQ("space", s2.id);
+	ASSERT_EQ(REP_EXT, s2.geometry.rep_type);
+	EXPECT_EQ(3.0, s2.geometry.rep.as_ext.extrusion_depth);
+	EXPECT_EQ(4, s2.geometry.rep.as_ext.area.outer_boundary.vertex_count);
+	EXPECT_EQ(0, s2.geometry.rep.as_ext.area.void_count);
+
+	EXPECT_EQ(1000.0, snapshot.opts.length_units_per_meter);
+	EXPECT_EQ(0.01, snapshot.opts.tolernace_in_meters);
+	ASSERT_EQ(1, snapshot.opts.space_filter_count);
+	EXPECT_STREQ("space", snapshot.opts.space_filter[0]);
+	EXPECT_EQ(0, snapshot.opts.element_filter_count);
+
+	release_input_snapshot(&snapshot);
+	remove(snapshot_filename);
+}
+
+TEST(InputSnapshot, RejectsGarbage) {
+	std::ofstream out(snapshot_filename, std::ios::out | std::ios::binary);
+	out << "This is not a snapshot.";
+	out.close();
+
+	sbt_input_snapshot snapshot;
+	EXPECT_EQ(SBT_BAD_SNAPSHOT, load_input_snapshot(snapshot_filename, &snapshot));
+	remove(snapshot_filename);
+}
+
+TEST(InputSnapshot, MissingFile) {
+	char missing[] = "no such file";
+	sbt_input_snapshot snapshot;
+	EXPECT_EQ(SBT_IO_ERROR, load_input_snapshot(missing, &snapshot));
+}
+
+} // namespace
@@ -0,0 +1,51 @@
+#include "precompiled.h"
+
+#include <gtest/gtest.h>
+
+#include "layer_stack.h"
+
+#include "common.h"
+#include "element.h"
+#include "equality_context.h"
+
+namespace {
+
+TEST(LayerStack, EqualStacksAreShared) {
+	equality_context c(0.01);
+	element e1(create_dummy_element(), &c);
+	element e2(create_dummy_element(), &c);
+
+	std::vector<layer_information> layers;
+	layers.push_back(layer_information(0, 1, e1));
+	layers.push_back(layer_information(1, 3, e2));
+
+	layer_stack::ptr a = layer_stack::intern(layers);
+	layer_stack::ptr b = layer_stack::intern(layers);
+	EXPECT_EQ(a.get(), b.get());
+	ASSERT_EQ(2, a->size());
+	EXPECT_EQ(&e1, &a->front().layer_element());
+
+	layers.back() = layer_information(1, 4, e2);
+	layer_stack::ptr thicker = layer_stack::intern(layers);
+	EXPECT_NE(a.get(), thicker.get());
+}
+
+TEST(LayerStack, Reversed) {
+	equality_context c(0.01);
+	element e1(create_dummy_element(), &c);
+	element e2(create_dummy_element(), &c);
+
+	std::vector<layer_information> layers;
+	layers.push_back(layer_information(0, 1, e1));
+	layers.push_back(layer_information(1, 3, e2));
+	layer_stack::ptr forward = layer_stack::intern(layers);
+
+	layer_stack::ptr backward = forward->reversed();
+	ASSERT_EQ(2, backward->size());
+	EXPECT_EQ(&e2, &backward->front().layer_element());
+	EXPECT_EQ(&e1, &backward->back().layer_element());
+	EXPECT_EQ(forward.get(), backward->reversed().get());
+	EXPECT_EQ(backward.get(), layer_stack::intern(layers | boost::adaptors::reversed).get());
+}
+
+} // namespace
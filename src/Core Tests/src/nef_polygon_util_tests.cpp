@@ -38,6 +38,30 @@ TEST(NefPolygonUtilClean, ShortEdge) {
 	EXPECT_EQ(6, vertex_count(cleaned));
 }
 
+TEST(NefPolygonUtilSymmetricDifference, ManyHoles) {
+	auto square = [](double x, double y, double size) -> nef_polygon_2 {
+		point_2 pts[] = {
+			point_2(x, y),
+			point_2(x + size, y),
+			point_2(x + size, y + size),
+			point_2(x, y + size)
+		};
+		return create_naive_nef_polygon(polygon_2(pts, pts + 4));
+	};
+	std::vector<nef_polygon_2> loops;
+	loops.push_back(square(0, 0, 100));
+	for (int i = 0; i < 7; ++i) {
+		loops.push_back(square(10 + i * 10, 10, 5));
+	}
+	nef_polygon_2 sequential = loops.front();
+	for (size_t i = 1; i < loops.size(); ++i) {
+		sequential ^= loops[i];
+	}
+	EXPECT_EQ(sequential, symmetric_difference(loops));
+	EXPECT_EQ(loops.front(), symmetric_difference(std::vector<nef_polygon_2>(1, loops.front())));
+	EXPECT_TRUE(symmetric_difference(std::vector<nef_polygon_2>()).is_empty());
+}
+
 } // namespace
 
 } // namespace util
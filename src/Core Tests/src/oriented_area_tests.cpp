@@ -4,9 +4,13 @@
 
 #include "common.h"
 #include "equality_context.h"
+#include "orientation.h"
 #include "oriented_area.h"
+#include "sbt-core.h"
 #include "simple_face.h"
 
+extern sb_calculation_options g_opts;
+
 namespace {
 
 TEST(OrientedAreaFreeIntersection, CoplanarNonIntersectingIsSetAndEmpty) {
@@ -211,4 +215,74 @@ TEST(OrientedArea, MultipleConvexNonAxisFacesToPieces) {
 	EXPECT_EQ(2, pieces.size());
 }
 
+TEST(OrientedArea, ApproximateUnflatteningMatchesExact) {
+	equality_context c(0.01);
+	oriented_area o(simple_face(create_face(4,
+		simple_point(0, 0, 0),
+		simple_point(3, 0, 4),
+		simple_point(3, 2, 4),
+		simple_point(0, 2, 0)), false, &c), &c);
+
+	auto exact = o.to_3d().front().outer();
+	polygon_2 outer = o.area_2d().to_pwhs().front().outer();
+	std::vector<double> xs, ys, zs;
+	for (auto p = outer.vertices_begin(); p != outer.vertices_end(); ++p) {
+		xs.push_back(CGAL::to_double(p->x()));
+		ys.push_back(CGAL::to_double(p->y()));
+		zs.push_back(CGAL::to_double(o.height()));
+	}
+	o.orientation().unflatten_approximately(&xs.front(), &ys.front(), &zs.front(), xs.size());
+
+	ASSERT_EQ(exact.size(), xs.size());
+	for (size_t i = 0; i < exact.size(); ++i) {
+		EXPECT_NEAR(CGAL::to_double(exact[i].x()), xs[i], 1e-9);
+		EXPECT_NEAR(CGAL::to_double(exact[i].y()), ys[i], 1e-9);
+		EXPECT_NEAR(CGAL::to_double(exact[i].z()), zs[i], 1e-9);
+	}
+}
+
+TEST(Orientation, RationalFlattenerIsARotation) {
+	orientation o(direction_3(3, -2, 5), true);
+	EXPECT_TRUE(o.is_rational());
+	EXPECT_EQ(vector_3(0, 0, 1), o.unit_normal().transform(o.flattener()));
+	EXPECT_EQ(NT(1), o.unit_normal().squared_length());
+
+	double len = sqrt(3.0 * 3.0 + 2.0 * 2.0 + 5.0 * 5.0);
+	EXPECT_NEAR(3.0 / len, CGAL::to_double(o.unit_normal().x()), 1e-8);
+	EXPECT_NEAR(-2.0 / len, CGAL::to_double(o.unit_normal().y()), 1e-8);
+	EXPECT_NEAR(5.0 / len, CGAL::to_double(o.unit_normal().z()), 1e-8);
+
+	orientation down(direction_3(0, 0, -1), true);
+	EXPECT_EQ(vector_3(0, 0, -1), down.unit_normal());
+}
+
+TEST(OrientedArea, RationalOrientationsMatchExact) {
+	auto build = [](equality_context * c) {
+		return oriented_area(simple_face(create_face(4,
+			simple_point(1, 0, 0),
+			simple_point(4, 1, 4),
+			simple_point(4, 3, 4),
+			simple_point(1, 2, 0)), false, c), c);
+	};
+
+	equality_context exact_c(0.01);
+	oriented_area exact = build(&exact_c);
+
+	int old_flags = g_opts.flags;
+	g_opts.flags |= SBT_RATIONAL_ORIENTATIONS;
+	equality_context rational_c(0.01);
+	oriented_area rational = build(&rational_c);
+	g_opts.flags = old_flags;
+
+	ASSERT_TRUE(rational.orientation().is_rational());
+	EXPECT_NEAR(CGAL::to_double(exact.height()), CGAL::to_double(rational.height()), 1e-6);
+
+	auto exact_loop = exact.to_3d().front().outer();
+	auto rational_loop = rational.to_3d().front().outer();
+	ASSERT_EQ(exact_loop.size(), rational_loop.size());
+	for (size_t i = 0; i < exact_loop.size(); ++i) {
+		EXPECT_LT(CGAL::to_double(CGAL::squared_distance(exact_loop[i], rational_loop[i])), 0.01 * 0.01);
+	}
+}
+
 } // namespace
\ No newline at end of file
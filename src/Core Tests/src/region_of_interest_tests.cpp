@@ -0,0 +1,138 @@
+#include "precompiled.h"
+
+#include "common.h"
+#include "guid_filter.h"
+#include "region_of_interest.h"
+
+namespace region_of_interest {
+
+namespace {
+
+solid create_box(double x1, double y1, double z1, double x2, double y2, double z2) {
+	return create_ext(0, 0, 1, z2 - z1, create_face(4,
+		simple_point(x1, y1, z1),
+		simple_point(x2, y1, z1),
+		simple_point(x2, y2, z1),
+		simple_point(x1, y2, z1)));
+}
+
+struct roi_model {
+	std::vector<element_info *> elements;
+	std::vector<space_info *> spaces;
+	roi_model() {
+		// Space "near" has a long wall on its east side. A column is
+		// embedded in that wall well outside the space's neighborhood, and a
+		// slab sits on top of the column. Space "far" and its wall are on the
+		// other side of the building.
+		spaces.push_back(create_space("near", create_box(0, 0, 0, 10, 10, 3)));
+		spaces.push_back(create_space("far", create_box(100, 0, 0, 110, 10, 3)));
+		elements.push_back(create_element("near wall", WALL, 1, create_box(10, 0, 0, 10.3, 50, 3)));
+		elements.push_back(create_element("column", COLUMN, 2, create_box(9.9, 40, 0, 10.4, 40.5, 3)));
+		elements.push_back(create_element("slab", SLAB, 3, create_box(9, 39, 3, 12, 42, 3.3)));
+		elements.push_back(create_element("far wall", WALL, 4, create_box(110, 0, 0, 110.3, 10, 3)));
+	}
+};
+
+std::vector<std::string> names(const std::vector<element_info *> & infos) {
+	std::vector<std::string> res;
+	for (auto e = infos.begin(); e != infos.end(); ++e) {
+		res.push_back((*e)->name);
+	}
+	return res;
+}
+
+TEST(RegionOfInterest, CullsDistantElements) {
+	roi_model m;
+	std::vector<space_info *> selected(1, m.spaces[0]);
+	auto kept = cull_elements(
+		&m.elements.front(),
+		m.elements.size(),
+		selected,
+		create_guid_filter(nullptr, 0),
+		0.5,
+		0.01);
+	std::vector<std::string> expected;
+	expected.push_back("near wall");
+	expected.push_back("column");
+	expected.push_back("slab");
+	EXPECT_EQ(expected, names(kept));
+}
+
+TEST(RegionOfInterest, RespectsElementFilter) {
+	roi_model m;
+	std::vector<space_info *> selected(1, m.spaces[0]);
+	char wall_name[] = "near wall";
+	char * filter[] = { wall_name };
+	auto kept = cull_elements(
+		&m.elements.front(),
+		m.elements.size(),
+		selected,
+		create_guid_filter(filter, 1),
+		0.5,
+		0.01);
+	ASSERT_EQ(1, kept.size());
+	EXPECT_STREQ("near wall", kept.front()->name);
+}
+
+TEST(RegionOfInterest, MatchesFullRun) {
+	roi_model m;
+	char space_name[] = "near";
+	char * space_filter[] = { space_name };
+	sb_calculation_options opts = create_default_options();
+	opts.tolernace_in_meters = 0.01;
+	opts.space_filter = space_filter;
+	opts.space_filter_count = 1;
+
+	// Each boundary as its element and space, then its normal and
+	// vertices.
+	typedef std::pair<std::string, std::vector<double>> description;
+	auto describe = [&](int flags) -> std::vector<description> {
+		opts.flags = flags;
+		size_t count;
+		space_boundary ** sbs;
+		EXPECT_EQ(SBT_OK, calculate_space_boundaries(
+			m.elements.size(),
+			&m.elements.front(),
+			m.spaces.size(),
+			&m.spaces.front(),
+			&count,
+			&sbs,
+			opts));
+		std::vector<description> res;
+		for (size_t i = 0; i < count; ++i) {
+			description desc;
+			desc.first = std::string(sbs[i]->element_name) + " " + sbs[i]->bounded_space->id;
+			desc.second.push_back(sbs[i]->normal_x);
+			desc.second.push_back(sbs[i]->normal_y);
+			desc.second.push_back(sbs[i]->normal_z);
+			for (size_t j = 0; j < sbs[i]->geometry.vertex_count; ++j) {
+				const point & p = sbs[i]->geometry.vertices[j];
+				desc.second.push_back(p.x);
+				desc.second.push_back(p.y);
+				desc.second.push_back(p.z);
+			}
+			res.push_back(desc);
+		}
+		release_space_boundaries(sbs, count);
+		std::sort(res.begin(), res.end());
+		return res;
+	};
+
+	// Culled elements can't attract the remaining coordinates when they're
+	// snapped, so the results only agree to within the tolerance.
+	auto full = describe(SBT_NONE);
+	auto culled = describe(SBT_REGION_OF_INTEREST);
+	EXPECT_FALSE(full.empty());
+	ASSERT_EQ(full.size(), culled.size());
+	for (size_t i = 0; i < full.size(); ++i) {
+		EXPECT_EQ(full[i].first, culled[i].first);
+		ASSERT_EQ(full[i].second.size(), culled[i].second.size());
+		for (size_t j = 0; j < full[i].second.size(); ++j) {
+			EXPECT_NEAR(full[i].second[j], culled[i].second[j], opts.tolernace_in_meters);
+		}
+	}
+}
+
+} // namespace
+
+} // namespace region_of_interest
@@ -4,8 +4,11 @@
 
 #include "sbt-core.h"
 
+// The static (non-Windows) core library defines these itself.
+#ifndef SBT_CORE_STATIC
 sb_calculation_options g_opts;
 char g_msgbuf[256];
+#endif
 
 void do_nothing(char *) { }
 
@@ -0,0 +1,37 @@
+#include "precompiled.h"
+
+#include <gtest/gtest.h>
+
+#include "vertex_welding.h"
+
+namespace vertex_welding {
+
+namespace {
+
+TEST(VertexWelding, EqualPointsWeldTogether) {
+	vertex_welder<point_3> w;
+	EXPECT_EQ(0, w.weld(point_3(0, 0, 0)));
+	EXPECT_EQ(1, w.weld(point_3(1, 2, 3)));
+	EXPECT_EQ(0, w.weld(point_3(NT(-0.0), 0, 0)));
+	EXPECT_EQ(1, w.weld(point_3(NT(2) / 2, 2, 3)));
+	EXPECT_EQ(2, w.points().size());
+	EXPECT_TRUE(w.contains(point_3(1, 2, 3)));
+	EXPECT_FALSE(w.contains(point_3(3, 2, 1)));
+}
+
+TEST(VertexWelding, EdgesFindTheirFirstFace) {
+	edge_adjacency edges;
+	size_t other;
+	bool opposite;
+	EXPECT_FALSE(edges.share(0, 1, 0, &other, &opposite));
+	ASSERT_TRUE(edges.share(1, 0, 1, &other, &opposite));
+	EXPECT_EQ(0, other);
+	EXPECT_TRUE(opposite);
+	ASSERT_TRUE(edges.share(0, 1, 2, &other, &opposite));
+	EXPECT_EQ(0, other);
+	EXPECT_FALSE(opposite);
+}
+
+} // namespace
+
+} // namespace vertex_welding
@@ -161,6 +161,77 @@ TEST(WrappedNefPolygonIsValid, SimpleRectangle) {
 	EXPECT_TRUE(nef.is_valid(c));
 }
 
+TEST(WrappedNefPolygonSummary, UpdatedByOperations) {
+	point_2 pts[] = {
+		point_2(0, 0),
+		point_2(10, 0),
+		point_2(10, 4),
+		point_2(0, 4)
+	};
+	point_2 right_half[] = {
+		point_2(5, -1),
+		point_2(11, -1),
+		point_2(11, 5),
+		point_2(5, 5)
+	};
+	wrapped_nef_polygon nef(polygon_2(pts, pts + 4));
+	wrapped_nef_polygon copy(nef);
+	EXPECT_DOUBLE_EQ(10, nef.bbox().xmax());
+	EXPECT_DOUBLE_EQ(40, CGAL::to_double(nef.outer_regular_area()));
+	nef -= wrapped_nef_polygon(polygon_2(right_half, right_half + 4));
+	EXPECT_DOUBLE_EQ(5, nef.bbox().xmax());
+	EXPECT_DOUBLE_EQ(20, CGAL::to_double(nef.outer_regular_area()));
+	EXPECT_EQ(4, nef.vertex_count());
+	EXPECT_DOUBLE_EQ(10, copy.bbox().xmax());
+	nef.clear();
+	EXPECT_TRUE(nef.is_empty());
+	EXPECT_EQ(0, nef.face_count());
+	EXPECT_FALSE(copy.is_empty());
+}
+
+TEST(WrappedNefPolygonDeferredCleaning, CleanedWhenQueried) {
+	point_2 left[] = {
+		point_2(0, 0),
+		point_2(2, 0),
+		point_2(2, 1),
+		point_2(0, 1)
+	};
+	point_2 right[] = {
+		point_2(2, 0),
+		point_2(4, 0),
+		point_2(4, 1),
+		point_2(2, 1)
+	};
+	wrapped_nef_polygon nef(polygon_2(left, left + 4));
+	nef += wrapped_nef_polygon(polygon_2(right, right + 4));
+	wrapped_nef_polygon copy(nef);
+	EXPECT_DOUBLE_EQ(4, nef.bbox().xmax());
+	EXPECT_EQ(4, nef.vertex_count());
+	EXPECT_EQ(1, copy.face_count());
+	EXPECT_EQ(nef, copy);
+}
+
+TEST(WrappedNefPolygonDeferredCleaning, MovedFromResultIsEmpty) {
+	point_2 left[] = {
+		point_2(0, 0),
+		point_2(2, 0),
+		point_2(2, 1),
+		point_2(0, 1)
+	};
+	point_2 right[] = {
+		point_2(2, 0),
+		point_2(4, 0),
+		point_2(4, 1),
+		point_2(2, 1)
+	};
+	wrapped_nef_polygon nef(polygon_2(left, left + 4));
+	nef += wrapped_nef_polygon(polygon_2(right, right + 4));
+	wrapped_nef_polygon moved(std::move(nef));
+	EXPECT_TRUE(nef.is_empty());
+	EXPECT_EQ(0, nef.face_count());
+	EXPECT_EQ(1, moved.face_count());
+}
+
 } // namespace
 
 } // namespace geometry_2d
\ No newline at end of file
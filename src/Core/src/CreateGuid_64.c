@@ -17,14 +17,56 @@
 //#pragma warning (disable: 4115)
 #endif
 
+#if defined _WIN32
 #include    <Windows.h>
+#else
+#include    <stdio.h>
+#include    <string.h>
+
+typedef struct _GUID {          // size is 16
+   unsigned int Data1;
+   unsigned short  Data2;
+   unsigned short  Data3;
+   unsigned char Data4[8];
+} GUID;
+
+typedef long BOOL;
+
+#define FALSE    0
+#define TRUE     1
+
+static const GUID GUID_NULL = { 0, 0, 0, { 0, 0, 0, 0, 0, 0, 0, 0 } };
+
+// A version 4 (random) GUID from the system's entropy pool.
+static long CoCreateGuid( GUID   *pGuid )
+{
+    unsigned char bytes[16];
+    FILE * f = fopen ("/dev/urandom", "rb");
+    size_t read = 0;
+    if (f != NULL) {
+        read = fread (bytes, 1, sizeof (bytes), f);
+        fclose (f);
+    }
+    if (read != sizeof (bytes)) {
+        return -1;
+    }
+    bytes[6] = (unsigned char)((bytes[6] & 0x0F) | 0x40);
+    bytes[8] = (unsigned char)((bytes[8] & 0x3F) | 0x80);
+    pGuid->Data1 = ((unsigned int)bytes[0] << 24) | ((unsigned int)bytes[1] << 16) |
+                   ((unsigned int)bytes[2] << 8) | (unsigned int)bytes[3];
+    pGuid->Data2 = (unsigned short)((bytes[4] << 8) | bytes[5]);
+    pGuid->Data3 = (unsigned short)((bytes[6] << 8) | bytes[7]);
+    memcpy (pGuid->Data4, bytes + 8, 8);
+    return 0;
+}
+#endif
 
 #if defined _MSC_VER
 //#pragma warning (default: 4115)
 #endif
 
-#include    <StdIO.h>
-#include    <String.h>
+#include    <stdio.h>
+#include    <string.h>
 
 #include    "CreateGuid_64.h"
 
@@ -2,62 +2,94 @@
 
 #include "area.h"
 
+#include "convex_decomposition.h"
 #include "equality_context.h"
 #include "geometry_common.h"
+#include "statistics.h"
 #include "stringification.h"
 
 namespace geometry_2d {
 
-area::area(const std::vector<std::vector<point_2>> & loops) : use_nef(loops.size() > 1) {
-	if (use_nef) {
-		nef_rep = wrapped_nef_polygon(loops);
+namespace {
+
+// Each of these copies would be a deep copy of a polygon or a Nef polygon if
+// representations weren't shared.
+statistics::counter g_shared_copies("area: shared copies");
+statistics::counter g_representations("area: representations created");
+statistics::counter g_convex_pieces_reused("area: convex decompositions reused");
+statistics::counter g_fast_decompositions("area: convex decompositions without nef");
+statistics::counter g_nef_decompositions("area: convex decompositions with nef");
+
+} // namespace
+
+std::shared_ptr<area::representation> area::create_rep() {
+	g_representations.increment();
+	return std::make_shared<representation>();
+}
+
+std::shared_ptr<area::representation> area::create_rep(const polygon_2 & poly) {
+	g_representations.increment();
+	return std::make_shared<representation>(poly);
+}
+
+std::shared_ptr<area::representation> area::create_rep(polygon_2 && poly) {
+	g_representations.increment();
+	return std::make_shared<representation>(std::move(poly));
+}
+
+std::shared_ptr<area::representation> area::create_rep(wrapped_nef_polygon && nef) {
+	g_representations.increment();
+	return std::make_shared<representation>(std::move(nef));
+}
+
+area::area(const std::vector<std::vector<point_2>> & loops) {
+	if (loops.size() > 1) {
+		rep = create_rep(wrapped_nef_polygon(loops));
 	}
 	else {
-		simple_rep = polygon_2(loops.front().begin(), loops.front().end());
+		rep = create_rep(polygon_2(loops.front().begin(), loops.front().end()));
 		ensure_counterclockwise();
-		assert(simple_rep.is_empty() || simple_rep.is_simple());
+		assert(rep->simple_rep.is_empty() || rep->simple_rep.is_simple());
 	}
 }
 
-area::area(const std::vector<polygon_2> & loops) : use_nef(loops.size() > 1) {
-	if (use_nef) {
-		nef_rep = wrapped_nef_polygon(loops);
+area::area(const std::vector<polygon_2> & loops) {
+	if (loops.size() > 1) {
+		rep = create_rep(wrapped_nef_polygon(loops));
 	}
 	else {
-		simple_rep = loops.front();
+		rep = create_rep(loops.front());
 		ensure_counterclockwise();
-		assert(simple_rep.is_empty() || simple_rep.is_simple());
+		assert(rep->simple_rep.is_empty() || rep->simple_rep.is_simple());
 	}
 }
 
 area & area::operator = (const area & src) {
 	if (&src != this) {
-		use_nef = src.use_nef;
-		if (!use_nef) { simple_rep = src.simple_rep; }
-		else { nef_rep = src.nef_rep; }
+		rep = src.rep;
+		g_shared_copies.increment();
 	}
 	return *this;
 }
 
 area & area::operator = (area && src) {
-	if (&src != this) {
-		use_nef = src.use_nef;
-		if (!use_nef) { simple_rep = std::move(src.simple_rep); }
-		else { nef_rep = std::move(src.nef_rep); }
-	}
+	if (&src != this) { rep.swap(src.rep); }
 	return *this;
 }
 
+// Promotion changes the (possibly shared) representation in place, but
+// that's invisible to everything sharing it.
 void area::promote() const {
-	if (!use_nef) {
-		use_nef = true;
-		nef_rep = wrapped_nef_polygon(simple_rep);
+	if (!rep->use_nef) {
+		rep->nef_rep = wrapped_nef_polygon(rep->simple_rep);
+		rep->use_nef = true;
 	}
 }
 
+// Only called during construction, before the representation is shared.
 void area::ensure_counterclockwise() {
-	if (!use_nef && simple_rep.is_clockwise_oriented()) {
-		simple_rep.reverse_orientation();
+	if (!rep->use_nef && rep->simple_rep.is_clockwise_oriented()) {
+		rep->simple_rep.reverse_orientation();
 	}
 }
 
@@ -66,117 +98,146 @@ boost::optional<polygon_2> area::outer_bound() const {
 	return pwhs.size() == 1 ? pwhs.front().outer() : boost::optional<polygon_2>();
 }
 
+// Simple polygons are decomposed directly (falling back to a Nef
+// decomposition if that fails); either way the result is kept with the
+// representation.
 std::vector<polygon_2> area::to_simple_convex_pieces() const {
-	if (!use_nef && simple_rep.is_convex()) { return std::vector<polygon_2>(1, simple_rep); }
-	else {
+	if (rep->convex_pieces) {
+		g_convex_pieces_reused.increment();
+		return *rep->convex_pieces;
+	}
+	if (!rep->use_nef) {
+		if (rep->simple_rep.is_convex()) { 
+			rep->convex_pieces = std::vector<polygon_2>(1, rep->simple_rep); 
+		}
+		else if (auto pieces = convex_decomposition::decompose(rep->simple_rep)) {
+			g_fast_decompositions.increment();
+			rep->convex_pieces = std::move(pieces);
+		}
+	}
+	if (!rep->convex_pieces) {
+		g_nef_decompositions.increment();
 		promote();
-		return nef_rep.to_simple_convex_pieces();
+		rep->convex_pieces = rep->nef_rep.to_simple_convex_pieces();
 	}
+	return *rep->convex_pieces;
 }
 
 bool area::any_points_satisfy_predicate(const std::function<bool(point_2)> & pred) const {
-	if (!use_nef) {
-		return std::find_if(simple_rep.vertices_begin(), simple_rep.vertices_end(), pred) != simple_rep.vertices_end();
+	if (!rep->use_nef) {
+		return std::find_if(rep->simple_rep.vertices_begin(), rep->simple_rep.vertices_end(), pred) != rep->simple_rep.vertices_end();
 	}
 	else {
-		return nef_rep.any_points_satisfy_predicate(pred);
+		return rep->nef_rep.any_points_satisfy_predicate(pred);
 	}
 }
 
 std::string area::to_string() const {
-	if (use_nef) { return nef_rep.to_string(); }
-	else { return reporting::to_string(simple_rep); }
+	if (rep->use_nef) { return rep->nef_rep.to_string(); }
+	else { return reporting::to_string(rep->simple_rep); }
 }
 
+// The boolean operations only skip operands that are empty without
+// cleaning them, so that a chain of operations doesn't clean every
+// intermediate result (see wrapped_nef_polygon). An operand that's only
+// empty once it's cleaned is noise that cleaning the result removes again.
 area & area::operator += (const area & other) {
-	if (is_empty()) { *this = other; }
-	else if (!other.is_empty()) {
+	if (is_empty_without_cleaning()) { *this = other; }
+	else if (!other.is_empty_without_cleaning()) {
 		promote_both(*this, other);
-		nef_rep += other.nef_rep;
+		wrapped_nef_polygon res(rep->nef_rep);
+		res += other.rep->nef_rep;
+		set_nef(std::move(res));
 	}
 	return *this;
 }
 
 area & area::operator -= (const area & other) {
-	if (!is_empty() && !other.is_empty()) {
+	if (!is_empty_without_cleaning() && !other.is_empty_without_cleaning()) {
 		promote_both(*this, other);
-		nef_rep -= other.nef_rep;
+		wrapped_nef_polygon res(rep->nef_rep);
+		res -= other.rep->nef_rep;
+		set_nef(std::move(res));
 	}
 	return *this;
 }
 
 area & area::operator *= (const area & other) {
-	if (is_empty() || 
-		other.is_empty() || 
+	if (is_empty_without_cleaning() || 
+		other.is_empty_without_cleaning() || 
 		!CGAL::do_overlap(bbox(), other.bbox())) 
 	{ 
 		clear(); 
 	}
 	else {
 		promote_both(*this, other);
-		nef_rep *= other.nef_rep;
+		wrapped_nef_polygon res(rep->nef_rep);
+		res *= other.rep->nef_rep;
+		set_nef(std::move(res));
 	}
 	return *this;
 }
 
 area & area::operator ^= (const area & other) {
-	if (is_empty()) { *this = other; }
-	else if (!other.is_empty()) {
+	if (is_empty_without_cleaning()) { *this = other; }
+	else if (!other.is_empty_without_cleaning()) {
 		promote_both(*this, other);
-		nef_rep ^= other.nef_rep;
+		wrapped_nef_polygon res(rep->nef_rep);
+		res ^= other.rep->nef_rep;
+		set_nef(std::move(res));
 	}
 	return *this;
 }
 
 bool area::do_intersect(const area & a, const area & b) {
 	if (a.is_empty() || b.is_empty() || !CGAL::do_overlap(a.bbox(), b.bbox())) { return false; }
-	if (!a.use_nef && !b.use_nef && a.simple_rep == b.simple_rep) { return true; }
+	if (a.rep == b.rep) { return true; }
+	if (!a.rep->use_nef && !b.rep->use_nef && a.rep->simple_rep == b.rep->simple_rep) { return true; }
 	promote_both(a, b);
-	return wrapped_nef_polygon::do_intersect(a.nef_rep, b.nef_rep);
+	return wrapped_nef_polygon::do_intersect(a.rep->nef_rep, b.rep->nef_rep);
 }
 
 bool operator == (const area & a, const area & b) {
+	if (a.rep == b.rep) { return true; }
 	if (a.is_empty() && b.is_empty()) { return true; }
-	if (!a.use_nef && !b.use_nef) { return a.simple_rep == b.simple_rep; }
+	if (!a.rep->use_nef && !b.rep->use_nef) { return a.rep->simple_rep == b.rep->simple_rep; }
 	area::promote_both(a, b);
-	return a.nef_rep == b.nef_rep;
+	return a.rep->nef_rep == b.rep->nef_rep;
 }
 
 bool operator >= (const area & a, const area & b) {
 	if (b.is_empty()) { return true; }
 	if (a.is_empty()) { return false; }
 	area::promote_both(a, b);
-	return a.nef_rep >= b.nef_rep;
+	return a.rep->nef_rep >= b.rep->nef_rep;
 }
 
 void area::clear() {
-	simple_rep.clear();
-	nef_rep.clear();
-	use_nef = false;
+	rep = create_rep();
 }
 
 std::vector<polygon_with_holes_2> area::to_pwhs() const {
-	if (!use_nef) { 
-		return std::vector<polygon_with_holes_2>(1, polygon_with_holes_2(std::vector<point_2>(simple_rep.vertices_begin(), simple_rep.vertices_end()), std::vector<std::vector<point_2>>()));
+	if (!rep->use_nef) { 
+		return std::vector<polygon_with_holes_2>(1, polygon_with_holes_2(std::vector<point_2>(rep->simple_rep.vertices_begin(), rep->simple_rep.vertices_end()), std::vector<std::vector<point_2>>()));
 	}
 	else {
-		return nef_rep.to_pwhs();
+		return rep->nef_rep.to_pwhs();
 	}
 }
 
 NT area::regular_area() const {
-	if (use_nef) { return nef_rep.outer_regular_area(); }
-	else { return geometry_common::regular_area(simple_rep); }
+	if (rep->use_nef) { return rep->nef_rep.outer_regular_area(); }
+	else { return geometry_common::regular_area(rep->simple_rep); }
 }
 
 area area::snap(equality_context * c) const {
-	if (use_nef) {
-		auto snapped = nef_rep.update_all([c](const point_2 & p) {
+	if (rep->use_nef) {
+		auto snapped = rep->nef_rep.update_all([c](const point_2 & p) {
 			return c->snap(p);
 		});
 		return snapped.is_valid(*c) ? area(std::move(snapped)) : area();
 	}
-	else { return area(c->snap(simple_rep)); }
+	else { return area(c->snap(rep->simple_rep)); }
 }
 
 } // namespace geometry_2d
\ No newline at end of file
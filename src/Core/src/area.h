@@ -12,49 +12,69 @@ namespace geometry_2d {
 
 class area {
 private:
-	polygon_2 simple_rep;
-	mutable wrapped_nef_polygon nef_rep;
-	mutable bool use_nef;
+	// Areas are copied all the time, so copies share a representation. A
+	// shared representation is never modified (except to promote it, which
+	// doesn't change what it represents); operations that change an area
+	// give it a new one instead.
+	struct representation {
+		polygon_2 simple_rep;
+		wrapped_nef_polygon nef_rep;
+		bool use_nef;
+		// Filled in the first time the area is split into convex pieces; the
+		// two sides of a boundary share it.
+		boost::optional<std::vector<polygon_2>> convex_pieces;
+		representation() : use_nef(false) { }
+		explicit representation(const polygon_2 & poly) : simple_rep(poly), use_nef(false) { }
+		explicit representation(polygon_2 && poly) : simple_rep(std::move(poly)), use_nef(false) { }
+		explicit representation(wrapped_nef_polygon && nef) : nef_rep(std::move(nef)), use_nef(true) { }
+	};
+
+	std::shared_ptr<representation> rep;
+
+	static std::shared_ptr<representation> create_rep();
+	static std::shared_ptr<representation> create_rep(const polygon_2 & poly);
+	static std::shared_ptr<representation> create_rep(polygon_2 && poly);
+	static std::shared_ptr<representation> create_rep(wrapped_nef_polygon && nef);
 
 	void promote() const;
 	void ensure_counterclockwise();
+	void set_nef(wrapped_nef_polygon && nef) { rep = create_rep(std::move(nef)); }
 
 	static void promote_both(const area & a, const area & b) { a.promote(); b.promote(); }
 
+	bool is_empty_without_cleaning() const { return rep->use_nef ? rep->nef_rep.is_empty_without_cleaning() : rep->simple_rep.is_empty(); }
+
 public:
-	area() : use_nef(false) { }
-	explicit area(const polygon_2 & poly) : simple_rep(poly), use_nef(false) { 
-		assert(simple_rep.is_empty() || simple_rep.is_simple());
+	area() : rep(create_rep()) { }
+	explicit area(const polygon_2 & poly) : rep(create_rep(poly)) { 
+		assert(rep->simple_rep.is_empty() || rep->simple_rep.is_simple());
 	}
-	explicit area(polygon_2 && poly) 
-		: simple_rep(std::move(poly)), 
-		  use_nef(false) 
-	{	
-		assert(simple_rep.is_empty() || simple_rep.is_simple());
+	explicit area(polygon_2 && poly) : rep(create_rep(std::move(poly))) {	
+		assert(rep->simple_rep.is_empty() || rep->simple_rep.is_simple());
 	}
 	explicit area(const std::vector<std::vector<point_2>> & loops);
 	explicit area(const std::vector<polygon_2> & loops);
-	explicit area(wrapped_nef_polygon && nef) : nef_rep(std::move(nef)), use_nef(true) { }
+	explicit area(wrapped_nef_polygon && nef) : rep(create_rep(std::move(nef))) { }
 	
 	area(const area & src) { *this = src; }
-	area(area && src) { *this = std::move(src); }
+	area(area && src) : rep(create_rep()) { rep.swap(src.rep); }
 	
 	area & operator = (const area & src);
 	area & operator = (area && src);
 	
 	bool								any_points_satisfy_predicate(const std::function<bool(point_2)> & pred) const;
-	bbox_2								bbox() const { return use_nef ? nef_rep.bbox() : simple_rep.bbox(); }
-	bool								is_empty() const { return use_nef ? nef_rep.is_empty() : simple_rep.is_empty(); }
+	bbox_2								bbox() const { return rep->use_nef ? rep->nef_rep.bbox() : rep->simple_rep.bbox(); }
+	bool								is_empty() const { return rep->use_nef ? rep->nef_rep.is_empty() : rep->simple_rep.is_empty(); }
 	boost::optional<polygon_2>			outer_bound() const;
 	std::vector<polygon_2>				to_simple_convex_pieces() const;
 	std::vector<polygon_with_holes_2>	to_pwhs() const;
-	size_t								vertex_count() const { return use_nef ? nef_rep.vertex_count() : simple_rep.size(); }
+	size_t								vertex_count() const { return rep->use_nef ? rep->nef_rep.vertex_count() : rep->simple_rep.size(); }
 	NT									regular_area() const;
 	area								snap(equality_context * c) const;
 
 	void clear();
 
-	bool is_valid(double eps) const { return use_nef ? nef_rep.is_valid(eps) : geometry_common::is_valid(simple_rep, eps); }
+	bool is_valid(double eps) const { return rep->use_nef ? rep->nef_rep.is_valid(eps) : geometry_common::is_valid(rep->simple_rep, eps); }
 
 	std::string to_string() const;
 	
@@ -0,0 +1,66 @@
+#include "precompiled.h"
+
+#include "statistics.h"
+
+#include "arena.h"
+
+namespace memory {
+
+namespace {
+
+// Every allocation is aligned for anything.
+const size_t ALIGNMENT = 16;
+
+size_t aligned(size_t bytes) {
+	return (bytes + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+}
+
+} // namespace
+
+arena::arena(const char * name, size_t chunk_size)
+	: name(name),
+	  chunk_size(chunk_size),
+	  current_chunk(0),
+	  used_in_current(0),
+	  in_use(0),
+	  peak_in_use(0),
+	  reserved(0),
+	  total(0)
+{ }
+
+arena::~arena() {
+	statistics::add(("arena: " + name + " bytes").c_str(), (double)total);
+	statistics::record_max(("arena: " + name + " peak bytes").c_str(), (double)peak_in_use);
+	statistics::record_max(("arena: " + name + " reserved bytes").c_str(), (double)reserved);
+	boost::for_each(chunks, [](const chunk & c) { ::operator delete(c.memory); });
+}
+
+void * arena::allocate(size_t bytes) {
+	bytes = aligned(bytes);
+	while (current_chunk < chunks.size() && used_in_current + bytes > chunks[current_chunk].size) {
+		++current_chunk;
+		used_in_current = 0;
+	}
+	if (current_chunk == chunks.size()) {
+		chunk c;
+		c.size = std::max(chunk_size, bytes);
+		c.memory = static_cast<char *>(::operator new(c.size));
+		chunks.push_back(c);
+		reserved += c.size;
+		used_in_current = 0;
+	}
+	void * res = chunks[current_chunk].memory + used_in_current;
+	used_in_current += bytes;
+	in_use += bytes;
+	total += bytes;
+	peak_in_use = std::max(peak_in_use, in_use);
+	return res;
+}
+
+void arena::reset() {
+	current_chunk = 0;
+	used_in_current = 0;
+	in_use = 0;
+}
+
+} // namespace memory
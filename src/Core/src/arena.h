@@ -0,0 +1,95 @@
+#pragma once
+
+#include "precompiled.h"
+
+// Monotonic allocation for intermediates that all die together at the end of
+// a phase (one element's blocking, one orientation's traversal). Freeing
+// something allocated from an arena does nothing; the memory comes back all
+// at once when the arena is reset or destroyed.
+
+namespace memory {
+
+class arena {
+public:
+	// The name is used for the arena's statistics: "arena: <name> bytes" (the
+	// total handed out), "arena: <name> peak bytes" (the most in use between
+	// resets), and "arena: <name> reserved bytes" (the most ever held).
+	explicit arena(const char * name, size_t chunk_size = 64 * 1024);
+	~arena();
+
+	void * allocate(size_t bytes);
+	void deallocate(void * /*p*/, size_t /*bytes*/) { }
+
+	// Makes all of the arena's memory available again without giving it back
+	// to the system. Everything allocated from the arena must already be
+	// gone.
+	void reset();
+
+private:
+	struct chunk {
+		char * memory;
+		size_t size;
+	};
+
+	std::string name;
+	size_t chunk_size;
+	std::vector<chunk> chunks;
+	size_t current_chunk;
+	size_t used_in_current;
+	size_t in_use;
+	size_t peak_in_use;
+	size_t reserved;
+	size_t total;
+
+	arena(const arena & disabled);
+	arena & operator = (const arena & disabled);
+};
+
+// A standard allocator that allocates from an arena, or from the heap if it
+// doesn't have one (so that containers using it work without an arena too).
+template <typename T>
+class arena_allocator {
+public:
+	typedef T					value_type;
+	typedef T *					pointer;
+	typedef const T *			const_pointer;
+	typedef T &					reference;
+	typedef const T &			const_reference;
+	typedef size_t				size_type;
+	typedef ptrdiff_t			difference_type;
+
+	template <typename U>
+	struct rebind { typedef arena_allocator<U> other; };
+
+	arena_allocator() : a(nullptr) { }
+	explicit arena_allocator(arena * a) : a(a) { }
+	template <typename U>
+	arena_allocator(const arena_allocator<U> & src) : a(src.source()) { }
+
+	pointer			address(reference r) const { return &r; }
+	const_pointer	address(const_reference r) const { return &r; }
+	size_type		max_size() const { return static_cast<size_type>(-1) / sizeof(T); }
+	arena *			source() const { return a; }
+
+	pointer allocate(size_type n, const void * /*hint*/ = nullptr) {
+		return static_cast<pointer>(a ? a->allocate(n * sizeof(T)) : ::operator new(n * sizeof(T)));
+	}
+	void deallocate(pointer p, size_type n) {
+		if (a) { a->deallocate(p, n * sizeof(T)); }
+		else { ::operator delete(p); }
+	}
+
+	template <typename U>
+	void construct(pointer p, U && val) { new (static_cast<void *>(p)) T(std::forward<U>(val)); }
+	void destroy(pointer p) { p->~T(); }
+
+private:
+	arena * a;
+};
+
+template <typename T, typename U>
+bool operator == (const arena_allocator<T> & lhs, const arena_allocator<U> & rhs) { return lhs.source() == rhs.source(); }
+template <typename T, typename U>
+bool operator != (const arena_allocator<T> & lhs, const arena_allocator<U> & rhs) { return lhs.source() != rhs.source(); }
+
+} // namespace memory
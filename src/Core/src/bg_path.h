@@ -2,6 +2,7 @@
 
 #include "precompiled.h"
 
+#include "arena.h"
 #include "building_graph.h"
 #include "layer_information.h"
 #include "vertex_wrapper.h"
@@ -12,14 +13,20 @@ namespace impl {
 
 class bg_path {
 private:
+	typedef building_graph::vertex_descriptor vertex_descriptor;
+	typedef building_graph::edge_descriptor edge_descriptor;
+
 	const building_graph & g_;
-	std::vector<building_graph::vertex_descriptor> vertices_;
-	std::vector<building_graph::edge_descriptor> edges_;
+	// Paths are copied at every step of a traversal, so their storage comes
+	// from the traversal's scratch arena (if it has one).
+	std::vector<vertex_descriptor, memory::arena_allocator<vertex_descriptor>> vertices_;
+	std::vector<edge_descriptor, memory::arena_allocator<edge_descriptor>> edges_;
 	const equality_context & c_;
 public:
-	explicit bg_path(vertex_wrapper start)
+	explicit bg_path(vertex_wrapper start, memory::arena * scratch = nullptr)
 		: g_(*start.g_),
-		  vertices_(1, start.v_),
+		  vertices_(1, start.v_, memory::arena_allocator<vertex_descriptor>(scratch)),
+		  edges_(memory::arena_allocator<edge_descriptor>(scratch)),
 		  c_(*start.c_)
 	{ }
 
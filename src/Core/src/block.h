@@ -32,6 +32,13 @@ public:
 		base_sense(halfblock_a.sense())
 	{ }
 
+	block(const block & src)
+		: o(src.o),
+		a(src.a),
+		layer(src.layer),
+		base_sense(src.base_sense)
+	{ }
+
 	block(block && src)
 		: o(src.o),
 		a(std::move(src.a)),
@@ -39,6 +46,16 @@ public:
 		base_sense(src.base_sense)
 	{ }
 
+	block & operator = (const block & src) {
+		if (&src != this) {
+			o = src.o;
+			a = src.a;
+			layer = src.layer;
+			base_sense = src.base_sense;
+		}
+		return *this;
+	}
+
 	block & operator = (block && src) {
 		if (&src != this) {
 			o = src.o;
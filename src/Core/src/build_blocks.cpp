@@ -1,5 +1,6 @@
 #include "precompiled.h"
 
+#include "arena.h"
 #include "block.h"
 #include "exceptions.h"
 #include "halfblocks_for_base.h"
@@ -7,6 +8,7 @@
 #include "is_right_cuboid.h"
 #include "link_halfblocks.h"
 #include "oriented_area.h"
+#include "platform.h"
 #include "report.h"
 #include "surface_pair.h"
 
@@ -20,12 +22,19 @@ namespace impl {
 
 namespace {
 
-std::vector<surface_pair::envelope_contribution> gather_contributions(
+typedef std::vector<
+	surface_pair::envelope_contribution, 
+	memory::arena_allocator<surface_pair::envelope_contribution>
+> contribution_list;
+typedef std::list<oriented_area, memory::arena_allocator<oriented_area>> halfblock_list;
+
+contribution_list gather_contributions(
 	const relations_grid & surf_rels, 
 	size_t face_count,
-	size_t base_index)
+	size_t base_index,
+	memory::arena * scratch)
 {
-	std::vector<surface_pair::envelope_contribution> res;
+	contribution_list res((memory::arena_allocator<surface_pair::envelope_contribution>(scratch)));
 	for (size_t i = 0; i < face_count; ++i) {
 		auto c = surf_rels[base_index][i].contributes_to_envelope();
 		if (c != surface_pair::NONE) { res.push_back(c); }
@@ -39,16 +48,17 @@ void general_case(
 	size_t face_count,
 	const element & e, 
 	equality_context * c, 
+	memory::arena * scratch,
 	FinalHalfblockOutputIterator oi)
 {
 	typedef relations_grid::index_range array_range;
 	typedef relations_grid::index_gen indices;
 	typedef surface_pair::envelope_contribution ec;
 
-	std::list<oriented_area> linkable;
+	halfblock_list linkable((memory::arena_allocator<oriented_area>(scratch)));
 
 	for (size_t i = 0; i < face_count; ++i) {
-		auto contribs = gather_contributions(surf_rels, face_count, i);
+		auto contribs = gather_contributions(surf_rels, face_count, i, scratch);
 		auto parallel_count = boost::count_if(
 			contribs, 
 			[](ec contr) { return contr == surface_pair::PARALLEL; });
@@ -75,7 +85,8 @@ void general_case(
 std::vector<block> build_blocks_for(
 	const element & e,
 	equality_context * c, 
-	double max_block_thickness) 
+	double max_block_thickness,
+	memory::arena * scratch) 
 {
 	std::vector<block> res;
 
@@ -117,6 +128,7 @@ std::vector<block> build_blocks_for(
 			faces.size(), 
 			e, 
 			c, 
+			scratch,
 			std::back_inserter(res));
 	}
 
@@ -126,21 +138,24 @@ std::vector<block> build_blocks_for(
 } // namespace impl
 
 std::vector<block> build_blocks(
-	const std::vector<element> & elements,
+	std::vector<element> * elements,
 	equality_context * c, 
 	double max_block_thickness)
 {
 	typedef boost::format fmt;
 	std::vector<block> res;
 	report_progress(fmt(
-		"Building blocks for %u elements.\n") % elements.size());
-	boost::for_each(elements, [=, &res](const element & e) {
+		"Building blocks for %u elements.\n") % elements->size());
+	// Everything that's only needed while one element is being blocked comes
+	// from this arena, which is reset after each element.
+	memory::arena scratch("blocking");
+	boost::for_each(*elements, [=, &res, &scratch](element & e) {
 		bool stack_overflow = false;
 		try {
 			int block_count = 0;
 			report_progress(fmt("Building blocks for element %s ") % e.name());
 			boost::transform(
-				impl::build_blocks_for(e, c, max_block_thickness), 
+				impl::build_blocks_for(e, c, max_block_thickness, &scratch), 
 				std::back_inserter(res), 
 				[&block_count](const block & b) -> block { 
 					++block_count; 
@@ -157,10 +172,12 @@ std::vector<block> build_blocks(
 			report_warning(m % e.name() % ex.what());
 		}
 		if (stack_overflow) {
-			_resetstkoflw();
+			platform::recover_from_stack_overflow();
 			report_warning("Internal error: stack overflow. Please report this"
 				           "SBT bug.");
 		}
+		e.release_geometry();
+		scratch.reset();
 	});
 	return res;
 }
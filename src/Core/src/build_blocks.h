@@ -8,21 +8,26 @@
 class equality_context;
 class surface;
 
+namespace memory { class arena; }
+
 namespace blocking {
 
 namespace impl {
 
-// A negative max_block_thickness signifies "infinite."
+// A negative max_block_thickness signifies "infinite." Intermediates are
+// allocated from the scratch arena if there is one.
 std::vector<block> build_blocks_for(
 	const element & e,
 	equality_context * c, 
-	double max_block_thickness = -1);
+	double max_block_thickness = -1,
+	memory::arena * scratch = nullptr);
 
 } // namespace impl
 
-// A negative max_block_thickness signifies "infinite."
+// A negative max_block_thickness signifies "infinite." Each element's
+// geometry is released once its blocks are built.
 std::vector<block> build_blocks(
-	const std::vector<element> & elements,
+	std::vector<element> * elements,
 	equality_context * c, 
 	double max_block_thickness = -1);
 
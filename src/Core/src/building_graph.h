@@ -61,7 +61,7 @@ building_graph create_building_graph(
 	double height_eps)
 {
 	static_assert(
-		std::is_same<BlockRange::value_type, const block *>::value,
+		std::is_same<typename BlockRange::value_type, const block *>::value,
 		"The values of the block range passed to create_building_graph must "
 		"be of type const block *.");
 
@@ -1,9 +1,11 @@
 #include "precompiled.h"
 
 #include "exceptions.h"
+#include "platform.h"
 #include "report.h"
 #include "sbt-core.h"
 #include "space.h"
+#include "statistics.h"
 #include "surface.h"
 
 #include "convert_to_space_boundaries.h"
@@ -16,6 +18,8 @@ namespace impl {
 
 namespace {
 
+statistics::counter g_exact_fallbacks("output: exact geometry fallbacks");
+
 void set_vertex(polyloop * loop, size_t ix, double x, double y, double z) {
 	loop->vertices[ix].x = x;
 	loop->vertices[ix].y = y;
@@ -27,15 +31,72 @@ void set_geometry(space_boundary * sb, const PointRange & geometry) {
 	sb->geometry.vertex_count = geometry.size();
 	sb->geometry.vertices = (point *)malloc(sizeof(point) * geometry.size());
 	size_t i = 0;
-	boost::for_each(geometry, [sb, &i](const point_3 & p) {
-		set_vertex(&sb->geometry, i++, CGAL::to_double(p.x()), CGAL::to_double(p.y()), CGAL::to_double(p.z()));
+	boost::for_each(geometry, [sb, &i](const ipoint_3 & p) {
+		set_vertex(&sb->geometry, i++, p.x(), p.y(), p.z());
 	});
 }
 
 } // namespace
 
+std::vector<polygon_with_holes_2> output_polygons(
+	const std::vector<const surface *> & surfaces)
+{
+	std::vector<polygon_with_holes_2> res;
+	res.reserve(surfaces.size());
+	for (auto s = surfaces.begin(); s != surfaces.end(); ++s) {
+		auto pwhs = (*s)->geometry().area_2d().to_pwhs();
+		res.push_back(pwhs.empty() ? polygon_with_holes_2() : std::move(pwhs.front()));
+	}
+	return res;
+}
+
+std::vector<std::vector<ipoint_3>> approximate_outer_boundaries(
+	const std::vector<const surface *> & surfaces,
+	const std::vector<polygon_with_holes_2> & polygons)
+{
+	std::map<const orientation *, std::vector<size_t>> by_orientation;
+	for (size_t i = 0; i < surfaces.size(); ++i) {
+		by_orientation[&surfaces[i]->geometry().orientation()].push_back(i);
+	}
+
+	std::vector<std::vector<ipoint_3>> res(surfaces.size());
+	std::vector<double> xs;
+	std::vector<double> ys;
+	std::vector<double> zs;
+	std::vector<size_t> loop_sizes;
+	for (auto o = by_orientation.begin(); o != by_orientation.end(); ++o) {
+		xs.clear();
+		ys.clear();
+		zs.clear();
+		loop_sizes.clear();
+		for (auto i = o->second.begin(); i != o->second.end(); ++i) {
+			double z = CGAL::to_double(surfaces[*i]->geometry().height());
+			const polygon_2 & outer = polygons[*i].outer();
+			for (auto p = outer.vertices_begin(); p != outer.vertices_end(); ++p) {
+				xs.push_back(CGAL::to_double(p->x()));
+				ys.push_back(CGAL::to_double(p->y()));
+				zs.push_back(z);
+			}
+			loop_sizes.push_back(outer.size());
+		}
+		if (!xs.empty()) {
+			o->first->unflatten_approximately(&xs.front(), &ys.front(), &zs.front(), xs.size());
+		}
+		size_t next = 0;
+		for (size_t j = 0; j < o->second.size(); ++j) {
+			std::vector<ipoint_3> & loop = res[o->second[j]];
+			for (size_t k = 0; k < loop_sizes[j]; ++k, ++next) {
+				loop.push_back(ipoint_3(xs[next], ys[next], zs[next]));
+			}
+		}
+	}
+	return res;
+}
+
 space_boundary * create_unlinked_space_boundary(
 	const surface & s, 
+	const polygon_with_holes_2 & polygon,
+	const std::vector<ipoint_3> * approximate_geometry,
 	double output_eps) 
 {
 	using namespace CGAL;
@@ -53,10 +114,25 @@ space_boundary * create_unlinked_space_boundary(
 			s.is_virtual() ? "" : s.bounded_element()->name().c_str(), 
 			ELEMENT_NAME_MAX_LEN);
 
-		auto cleaned_geometry = s.geometry().to_3d(true).front().outer();
-		if (!geometry_common::cleanup_loop(&cleaned_geometry, output_eps)) {
-			free(newsb);
-			return nullptr;
+		std::vector<ipoint_3> cleaned_geometry;
+		bool cleaned = false;
+		if (approximate_geometry != nullptr) {
+			cleaned_geometry = *approximate_geometry;
+			cleaned = geometry_common::cleanup_loop(&cleaned_geometry, output_eps);
+			// The boundary might only have degenerated because of rounding,
+			// so check it exactly before giving up on it.
+			if (!cleaned) { g_exact_fallbacks.increment(); }
+		}
+		if (!cleaned) {
+			auto exact_geometry = s.geometry().outer_to_3d(polygon, true);
+			if (!geometry_common::cleanup_loop(&exact_geometry, output_eps)) {
+				free(newsb);
+				return nullptr;
+			}
+			cleaned_geometry.clear();
+			boost::transform(exact_geometry, std::back_inserter(cleaned_geometry), [](const point_3 & p) {
+				return ipoint_3(CGAL::to_double(p.x()), CGAL::to_double(p.y()), CGAL::to_double(p.z()));
+			});
 		}
 
 		if (s.geometry().sense()) {
@@ -110,7 +186,7 @@ space_boundary * create_unlinked_space_boundary(
 	}
 
 	if (stack_overflowed) {
-		_resetstkoflw();
+		platform::recover_from_stack_overflow();
 		report_warning("Internal error: stack overflow. Please report this SBT"
 			           "bug.");
 		newsb = nullptr;
@@ -14,8 +14,26 @@ namespace interface_conversion {
 
 namespace impl {
 
+// The polygon of each surface's area that's output (the first of its
+// to_pwhs()). It's computed once here and used by both the approximate and
+// the exact paths.
+std::vector<polygon_with_holes_2> output_polygons(
+	const std::vector<const surface *> & surfaces);
+
+// The outer boundaries of the output polygons in 3D, computed in doubles.
+// The surfaces are processed an orientation at a time so that each
+// orientation's transformation is applied to all of its points in one pass.
+std::vector<std::vector<ipoint_3>> approximate_outer_boundaries(
+	const std::vector<const surface *> & surfaces,
+	const std::vector<polygon_with_holes_2> & polygons);
+
+// polygon is the surface's output polygon. If approximate_geometry (its
+// outer boundary from approximate_outer_boundaries) is given, it's used
+// unless it doesn't survive cleaning; otherwise the exact boundary is.
 space_boundary * create_unlinked_space_boundary(
 	const surface & surf,
+	const polygon_with_holes_2 & polygon,
+	const std::vector<ipoint_3> * approximate_geometry,
 	double output_eps);
 
 } // namespace impl
@@ -44,12 +62,24 @@ sbt_return_t convert_to_space_boundaries(
 	using namespace boost::adaptors;
 
 	try {
-		std::vector<space_boundary *> unlinked;
-		for (auto s = surfaces.begin(); s != surfaces.end(); ++s) {
-			auto unlinked = 
-				impl::create_unlinked_space_boundary(*s->get(), output_eps);
+		std::vector<const surface *> surface_ptrs;
+		boost::transform(surfaces, std::back_inserter(surface_ptrs), [](const surface_ptr & s) { 
+			return s.get(); 
+		});
+		auto polygons = impl::output_polygons(surface_ptrs);
+		bool approximate = (g_opts.flags & SBT_APPROXIMATE_OUTPUT) != 0;
+		std::vector<std::vector<ipoint_3>> outer_boundaries;
+		if (approximate) {
+			outer_boundaries = impl::approximate_outer_boundaries(surface_ptrs, polygons);
+		}
+		for (size_t i = 0; i < surface_ptrs.size(); ++i) {
+			auto unlinked = impl::create_unlinked_space_boundary(
+				*surface_ptrs[i], 
+				polygons[i],
+				approximate ? &outer_boundaries[i] : nullptr, 
+				output_eps);
 			if (unlinked != nullptr) {
-				boundaries[(*s)->guid()] = unlinked;
+				boundaries[surface_ptrs[i]->guid()] = unlinked;
 			}
 			tick();
 		}
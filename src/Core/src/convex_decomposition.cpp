@@ -0,0 +1,307 @@
+#include "precompiled.h"
+
+#include "statistics.h"
+
+#include "convex_decomposition.h"
+
+namespace geometry_2d {
+
+namespace convex_decomposition {
+
+namespace {
+
+statistics::counter g_exact_orientations("convex decomposition: exact orientation tests");
+
+struct vertex {
+	point_2 p;
+	double x;
+	double y;
+	explicit vertex(const point_2 & p) : p(p), x(CGAL::to_double(p.x())), y(CGAL::to_double(p.y())) { }
+};
+
+// The exact orientation of a, b, and c. The determinant is computed in
+// doubles first; the bound covers both the rounding of the coordinates to
+// doubles and the rounding of the arithmetic, so the exact test is only
+// needed when the points are (nearly) collinear.
+CGAL::Orientation orientation(const vertex & a, const vertex & b, const vertex & c) {
+	double abx = b.x - a.x;
+	double aby = b.y - a.y;
+	double acx = c.x - a.x;
+	double acy = c.y - a.y;
+	double det = abx * acy - aby * acx;
+	double mag = std::max(
+		std::max(std::max(fabs(a.x), fabs(a.y)), std::max(fabs(b.x), fabs(b.y))),
+		std::max(fabs(c.x), fabs(c.y)));
+	double bound = 16 * std::numeric_limits<double>::epsilon() * (
+		fabs(abx * acy) + fabs(aby * acx) +
+		mag * (fabs(abx) + fabs(aby) + fabs(acx) + fabs(acy) + 4 * mag * std::numeric_limits<double>::epsilon()));
+	if (det > bound) { return CGAL::LEFT_TURN; }
+	if (det < -bound) { return CGAL::RIGHT_TURN; }
+	g_exact_orientations.increment();
+	return CGAL::orientation(a.p, b.p, c.p);
+}
+
+// The vertices that haven't been clipped off yet, as a circular list.
+class vertex_ring {
+public:
+	explicit vertex_ring(const std::vector<vertex> & verts) : verts(&verts), count(verts.size()), alive(verts.size(), true) {
+		for (size_t i = 0; i < count; ++i) {
+			prev_.push_back(i == 0 ? count - 1 : i - 1);
+			next_.push_back(i == count - 1 ? 0 : i + 1);
+		}
+	}
+
+	size_t size() const { return count; }
+	size_t prev(size_t i) const { return prev_[i]; }
+	size_t next(size_t i) const { return next_[i]; }
+	bool contains(size_t i) const { return alive[i]; }
+
+	CGAL::Orientation turn_at(size_t i) const {
+		return orientation((*verts)[prev_[i]], (*verts)[i], (*verts)[next_[i]]);
+	}
+
+	void remove(size_t i) {
+		next_[prev_[i]] = next_[i];
+		prev_[next_[i]] = prev_[i];
+		alive[i] = false;
+		--count;
+	}
+
+private:
+	const std::vector<vertex> * verts;
+	size_t count;
+	std::vector<size_t> prev_;
+	std::vector<size_t> next_;
+	std::vector<bool> alive;
+};
+
+typedef std::vector<size_t> piece; // counterclockwise vertex indices
+
+bool is_ear(const std::vector<vertex> & verts, const vertex_ring & ring, const std::vector<bool> & reflex, size_t i) {
+	if (reflex[i]) { return false; }
+	size_t a = ring.prev(i);
+	size_t c = ring.next(i);
+	// Only reflex (or flat) vertices can be inside a convex vertex's ear.
+	for (size_t w = ring.next(c); w != a; w = ring.next(w)) {
+		if (reflex[w] &&
+			orientation(verts[a], verts[i], verts[w]) != CGAL::RIGHT_TURN &&
+			orientation(verts[i], verts[c], verts[w]) != CGAL::RIGHT_TURN &&
+			orientation(verts[c], verts[a], verts[w]) != CGAL::RIGHT_TURN)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+// Triangulates the polygon without the vertices at which it doesn't turn
+// (see restore_flat_vertices). boundary_next is set to the next vertex
+// along the polygon that the triangulation uses, for each one it uses.
+boost::optional<std::vector<piece>> triangulate(
+	const std::vector<vertex> & verts, 
+	std::vector<size_t> * boundary_next) 
+{
+	vertex_ring ring(verts);
+
+	// Set aside the vertices at which the polygon doesn't turn. This includes
+	// repeated vertices.
+	size_t unchecked = ring.size();
+	for (size_t i = 0; unchecked > 0 && ring.size() >= 3; i = ring.next(i)) {
+		if (ring.turn_at(i) == CGAL::COLLINEAR) {
+			size_t p = ring.prev(i);
+			ring.remove(i);
+			i = p;
+			unchecked = ring.size();
+		}
+		else { --unchecked; }
+	}
+	if (ring.size() < 3) { return boost::none; }
+
+	std::vector<bool> reflex(verts.size(), false);
+	size_t first = 0;
+	while (!ring.contains(first)) { ++first; }
+	boundary_next->assign(verts.size(), verts.size());
+	size_t i = first;
+	do {
+		(*boundary_next)[i] = ring.next(i);
+		i = ring.next(i);
+	} while (i != first);
+	do {
+		reflex[i] = ring.turn_at(i) != CGAL::LEFT_TURN;
+		i = ring.next(i);
+	} while (i != first);
+
+	std::vector<piece> triangles;
+	size_t since_last_clip = 0;
+	while (ring.size() > 3) {
+		if (since_last_clip > ring.size()) {
+			// No ears, so the polygon isn't simple (or it's degenerate in a way
+			// that ear clipping can't handle).
+			return boost::none;
+		}
+		if (is_ear(verts, ring, reflex, i)) {
+			size_t a = ring.prev(i);
+			size_t c = ring.next(i);
+			piece tri;
+			tri.push_back(a);
+			tri.push_back(i);
+			tri.push_back(c);
+			triangles.push_back(tri);
+			ring.remove(i);
+			reflex[a] = ring.turn_at(a) != CGAL::LEFT_TURN;
+			reflex[c] = ring.turn_at(c) != CGAL::LEFT_TURN;
+			i = a;
+			since_last_clip = 0;
+		}
+		else {
+			i = ring.next(i);
+			++since_last_clip;
+		}
+	}
+	if (ring.turn_at(i) != CGAL::LEFT_TURN) { return boost::none; }
+	piece last;
+	last.push_back(ring.prev(i));
+	last.push_back(i);
+	last.push_back(ring.next(i));
+	triangles.push_back(last);
+	return triangles;
+}
+
+size_t find_root(std::vector<size_t> * owners, size_t i) {
+	while ((*owners)[i] != i) {
+		(*owners)[i] = (*owners)[(*owners)[i]];
+		i = (*owners)[i];
+	}
+	return i;
+}
+
+size_t position_of(const piece & p, size_t v) {
+	return std::find(p.begin(), p.end(), v) - p.begin();
+}
+
+// Hertel-Mehlhorn: removes each diagonal whose removal leaves both of its
+// endpoints convex.
+std::vector<piece> merge_pieces(const std::vector<vertex> & verts, std::vector<piece> pieces) {
+	typedef std::pair<size_t, size_t> edge;
+	std::map<edge, std::vector<size_t>> edge_owners;
+	for (size_t t = 0; t < pieces.size(); ++t) {
+		for (size_t j = 0; j < 3; ++j) {
+			size_t u = pieces[t][j];
+			size_t v = pieces[t][(j + 1) % 3];
+			edge_owners[edge(std::min(u, v), std::max(u, v))].push_back(t);
+		}
+	}
+
+	std::vector<size_t> owners(pieces.size());
+	for (size_t t = 0; t < owners.size(); ++t) { owners[t] = t; }
+
+	for (auto d = edge_owners.begin(); d != edge_owners.end(); ++d) {
+		if (d->second.size() != 2) { continue; } // polygon edge
+		size_t p = find_root(&owners, d->second[0]);
+		size_t q = find_root(&owners, d->second[1]);
+		if (p == q) { continue; }
+		size_t u = d->first.first;
+		size_t v = d->first.second;
+		const piece & pp = pieces[p];
+		const piece & qp = pieces[q];
+		size_t pu = position_of(pp, u);
+		if (pp[(pu + 1) % pp.size()] != v) {
+			std::swap(u, v);
+			pu = position_of(pp, u);
+		}
+		size_t pv = (pu + 1) % pp.size();
+		size_t qv = position_of(qp, v);
+		size_t qu = (qv + 1) % qp.size();
+		// p runs u -> v across the diagonal and q runs v -> u
+		size_t before_u = pp[(pu + pp.size() - 1) % pp.size()];
+		size_t after_u = qp[(qu + 1) % qp.size()];
+		size_t before_v = qp[(qv + qp.size() - 1) % qp.size()];
+		size_t after_v = pp[(pv + 1) % pp.size()];
+		if (orientation(verts[before_u], verts[u], verts[after_u]) != CGAL::LEFT_TURN ||
+			orientation(verts[before_v], verts[v], verts[after_v]) != CGAL::LEFT_TURN)
+		{
+			continue;
+		}
+		piece merged;
+		for (size_t j = pv; ; j = (j + 1) % pp.size()) {
+			merged.push_back(pp[j]);
+			if (j == pu) { break; }
+		}
+		for (size_t j = (qu + 1) % qp.size(); j != qv; j = (j + 1) % qp.size()) {
+			merged.push_back(qp[j]);
+		}
+		pieces[p] = std::move(merged);
+		pieces[q].clear();
+		owners[q] = p;
+	}
+
+	std::vector<piece> res;
+	boost::copy(
+		pieces | boost::adaptors::filtered([](const piece & p) { return !p.empty(); }),
+		std::back_inserter(res));
+	return res;
+}
+
+// Puts the vertices that triangulate set aside back into the pieces that
+// have the edges they're on, so that the pieces have every vertex the
+// polygon had along its boundary. A vertex that's the same as the one
+// before it (a repeated vertex in the polygon) is only put back once.
+void restore_flat_vertices(
+	const std::vector<vertex> & verts,
+	const std::vector<size_t> & boundary_next, 
+	std::vector<piece> * pieces) 
+{
+	size_t n = boundary_next.size();
+	for (auto p = pieces->begin(); p != pieces->end(); ++p) {
+		piece restored;
+		auto add = [&verts, &restored](size_t w) {
+			if (restored.empty() || verts[restored.back()].p != verts[w].p) { restored.push_back(w); }
+		};
+		for (size_t j = 0; j < p->size(); ++j) {
+			size_t u = (*p)[j];
+			size_t v = (*p)[(j + 1) % p->size()];
+			add(u);
+			if (boundary_next[u] == v) {
+				for (size_t w = (u + 1) % n; w != v; w = (w + 1) % n) {
+					add(w);
+				}
+			}
+		}
+		while (restored.size() > 1 && verts[restored.back()].p == verts[restored.front()].p) {
+			restored.pop_back();
+		}
+		*p = std::move(restored);
+	}
+}
+
+} // namespace
+
+boost::optional<std::vector<polygon_2>> decompose(const polygon_2 & poly) {
+	if (poly.size() < 3) { return boost::none; }
+	NT signed_area = poly.area();
+	if (CGAL::is_zero(signed_area)) { return boost::none; }
+
+	std::vector<vertex> verts;
+	boost::transform(poly.container(), std::back_inserter(verts), [](const point_2 & p) { return vertex(p); });
+	if (signed_area < 0) { std::reverse(verts.begin(), verts.end()); }
+
+	std::vector<size_t> boundary_next;
+	auto triangles = triangulate(verts, &boundary_next);
+	if (!triangles) { return boost::none; }
+
+	std::vector<polygon_2> res;
+	auto pieces = merge_pieces(verts, std::move(*triangles));
+	restore_flat_vertices(verts, boundary_next, &pieces);
+	for (auto p = pieces.begin(); p != pieces.end(); ++p) {
+		polygon_2 convex;
+		for (auto v = p->begin(); v != p->end(); ++v) {
+			convex.push_back(verts[*v].p);
+		}
+		res.push_back(convex);
+	}
+	return res;
+}
+
+} // namespace convex_decomposition
+
+} // namespace geometry_2d
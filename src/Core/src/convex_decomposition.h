@@ -0,0 +1,29 @@
+#pragma once
+
+#include "precompiled.h"
+
+namespace geometry_2d {
+
+namespace convex_decomposition {
+
+// Splits a simple polygon into convex pieces without going through a Nef
+// polygon: the polygon is triangulated by ear clipping and then the
+// triangles are merged back together across every diagonal that doesn't
+// need to be there (Hertel-Mehlhorn). There are at most four times as many
+// pieces as the optimal decomposition would have.
+//
+// Orientation tests are done in doubles and only repeated exactly when the
+// doubles are too close to call, so the pieces are exact. Vertices at which
+// the polygon doesn't turn are kept, in the piece that has the edge they're
+// on (repeated vertices are kept once).
+//
+// The polygon must be simple, which isn't checked (area asserts it when it's
+// constructed); the pieces of a polygon that isn't are meaningless. Returns
+// nothing if ear clipping gets stuck, which can happen for degenerate or
+// non-simple polygons, in which case the caller should fall back to a Nef
+// polygon decomposition.
+boost::optional<std::vector<polygon_2>> decompose(const polygon_2 & poly);
+
+} // namespace convex_decomposition
+
+} // namespace geometry_2d
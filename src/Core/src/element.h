@@ -14,6 +14,8 @@ private:
 	multiview_solid geometry_;
 	element_type type_;
 	element_id_t id_;
+	// Set once the geometry has been released; see release_geometry.
+	boost::optional<bbox_3> released_bbox_;
 
 	element(const element & info, multiview_solid && new_geometry) 
 		: name_(info.name_), 
@@ -34,7 +36,8 @@ public:
 		: name_(std::move(src.name_)),
 		geometry_(std::move(src.geometry_)),
 		type_(src.type_),
-		id_(src.id_)
+		id_(src.id_),
+		released_bbox_(src.released_bbox_)
 	{ }
 
 	element & operator = (element && src) {
@@ -43,6 +46,7 @@ public:
 			geometry_ = std::move(src.geometry_);
 			type_ = src.type_;
 			id_ = src.id_;
+			released_bbox_ = src.released_bbox_;
 		}
 		return *this;
 	}
@@ -52,16 +56,29 @@ public:
 	element_id_t material() const { return id_; }
 	const multiview_solid & geometry() const { return geometry_; }
 	bool is_fenestration() const { return type_ == DOOR || type_ == WINDOW; }
-	bbox_3 bounding_box() const { return geometry_.bounding_box(); }
+	bbox_3 bounding_box() const { return released_bbox_ ? *released_bbox_ : geometry_.bounding_box(); }
+	bool has_geometry() const { return !released_bbox_; }
 
 	std::vector<oriented_area> faces(equality_context * c) const { 
+		assert(has_geometry());
 		return geometry_.oriented_faces(c); 
 	}
 
 	void subtract_geometry_of(const element & other, equality_context * c) {
+		assert(has_geometry() && other.has_geometry());
 		geometry_.subtract(other.geometry_, c); 
 	}
 
+	// Once an element's blocks are built, its geometry is only dead weight
+	// (the blocks have their own copies of the faces they need). This drops
+	// it, leaving just the element's name, type, material, and bounding box.
+	void release_geometry() {
+		if (has_geometry()) {
+			released_bbox_ = geometry_.bounding_box();
+			geometry_.release();
+		}
+	}
+
 	static bool share_plane_opposite(
 		const element & a, 
 		const element & b,
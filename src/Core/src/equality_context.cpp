@@ -46,7 +46,7 @@ std::tuple<orientation *, bool> equality_context::request_orientation(const dire
 		return std::make_tuple(exists->get(), geometry_common::share_sense((*exists)->direction(), d));
 	}
 	else {
-		orientations.push_back(std::unique_ptr<orientation>(new orientation(d)));
+		orientations.push_back(std::unique_ptr<orientation>(new orientation(d, (g_opts.flags & SBT_RATIONAL_ORIENTATIONS) != 0)));
 		return std::make_tuple(orientations.back().get(), true);
 	}
 }
\ No newline at end of file
@@ -51,8 +51,7 @@ public:
 
 	template <class GeomT>
 	static bool are_effectively_same(const GeomT & a, const GeomT & b, double eps) { return is_zero_squared(CGAL::squared_distance(a, b), eps); }
-	template <>
-	static bool are_effectively_same<point_3>(const point_3 & a, const point_3 & b, double eps) { return are_equal(a.x(), b.x(), eps) && are_equal(a.y(), b.y(), eps) && are_equal(a.z(), b.z(), eps); }
+	static bool are_effectively_same(const point_3 & a, const point_3 & b, double eps) { return are_equal(a.x(), b.x(), eps) && are_equal(a.y(), b.y(), eps) && are_equal(a.z(), b.z(), eps); }
 	static bool are_effectively_collinear(const point_2 & a, const point_2 & b, const point_2 & c, double eps) { return are_effectively_same(a, c, eps) || is_zero_squared(CGAL::squared_distance(b, line_2(a, c)), eps); }
 	static bool are_effectively_collinear(const espoint_2 & a, const espoint_2 & b, const espoint_2 & c, double eps) { return are_effectively_same(a, c, eps) || is_zero_squared(CGAL::squared_distance(b, esline_2(a, c)), eps); }
 	static bool are_effectively_collinear(const point_3 & a, const point_3 & b, const point_3 & c, double eps) { return are_effectively_same(a, c, eps) || is_zero_squared(CGAL::squared_distance(b, line_3(a, c)), eps); }
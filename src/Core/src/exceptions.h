@@ -70,6 +70,18 @@ public:
 	}
 };
 
+class io_exception : public sbt_exception {
+public:
+	virtual sbt_return_t code() const { return SBT_IO_ERROR; }
+	virtual const char * what() const throw() { return "I/O error."; }
+};
+
+class bad_snapshot_exception : public sbt_exception {
+public:
+	virtual sbt_return_t code() const { return SBT_BAD_SNAPSHOT; }
+	virtual const char * what() const throw() { return "Invalid input snapshot."; }
+};
+
 // This isn't a bad_geometry_exception because it indicates an inconsistent
 // program state, not bad geometry.
 class unknown_geometry_rep_exception : public sbt_exception { };
\ No newline at end of file
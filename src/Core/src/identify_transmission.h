@@ -2,6 +2,7 @@
 
 #include "precompiled.h"
 
+#include "arena.h"
 #include "bg_path.h"
 #include "block.h"
 #include "building_graph.h"
@@ -16,18 +17,20 @@ namespace traversal {
 
 namespace impl {
 
+// Releases each space's geometry once its faces have been extracted.
 template <typename SpaceRange>
 std::map<const orientation *, std::vector<space_face>> 
 get_space_faces_by_orientation(
-	const SpaceRange & spaces, 
+	SpaceRange * spaces, 
 	equality_context * c) 
 {
 	std::map<const orientation *, std::vector<space_face>> res;
-	for (auto sp = spaces.begin(); sp != spaces.end(); ++sp) {
+	for (auto sp = spaces->begin(); sp != spaces->end(); ++sp) {
 		auto faces = sp->get_faces(c);
 		for (auto oa = faces.begin(); oa != faces.end(); ++oa) {
 			res[&oa->orientation()].push_back(space_face(&*sp, *oa));
 		}
+		sp->release_geometry();
 	}
 	return res;
 }
@@ -71,22 +74,26 @@ void process_orientation(
 			sf_vertices.insert(std::make_pair(reg_area, wrapped));
 		}
 	}
+	// The paths explored from each starting face all die before the next
+	// starting face is processed.
+	memory::arena scratch("traversal");
 	reporting::report_progress("Identifying transmission");
 	boost::for_each(
 		values(sf_vertices) | reversed, 
-		[=, &g, &oi, &curr_ticks](vertex_wrapper starting_face) { 
+		[=, &g, &oi, &curr_ticks, &scratch](vertex_wrapper starting_face) { 
 			// Space faces get trimmed during operation so we have to make sure
 			// this one didn't get trimmed away entirely previously.
 			if (!starting_face.vertex_area().is_empty()) {
 				auto t_info_oi = oi; // This rename works around a VS2010 bug
 				extend_path(
-					bg_path(starting_face),
+					bg_path(starting_face, &scratch),
 					starting_face.vertex_area(),
 					o,
 					max_thickness,
 					[&t_info_oi](const transmission_information t_info) {
 						*t_info_oi++ = t_info;
 					});
+				scratch.reset();
 				if (++curr_ticks > ticks_per_dot) {
 					reporting::report_progress(".");
 					curr_ticks = 0;
@@ -101,7 +108,7 @@ void process_orientation(
 template <typename BlockRange, typename SpaceRange>
 std::vector<transmission_information> identify_transmission(
 	const BlockRange & blocks,
-	const SpaceRange & spaces,
+	SpaceRange * spaces,
 	double max_thickness,
 	equality_context * c)
 {
@@ -113,7 +120,7 @@ std::vector<transmission_information> identify_transmission(
 			"Identifying transmission for %u blocks and %u spaces. Max "
 			"thickness is %f.\n") %
 		blocks.size() %
-		spaces.size() %
+		spaces->size() %
 		max_thickness);
 
 	equality_context height_c(g_opts.length_units_per_meter * 0.1);
@@ -129,9 +136,9 @@ std::vector<transmission_information> identify_transmission(
 				return !b.is_fenestration(); 
 			}));
 
-	typedef std::pair<const orientation * const, std::vector<space_face>> or;
+	typedef std::pair<const orientation * const, std::vector<space_face>> orientation_faces;
 	std::vector<transmission_information> res;
-	boost::for_each(space_faces, [&, max_thickness](or & o_info) {
+	boost::for_each(space_faces, [&, max_thickness](orientation_faces & o_info) {
 		std::string ostring = o_info.first->to_string().c_str();
 		reporting::report_progress(
 			fmt("Identifying transmission along %s.\n") % ostring);
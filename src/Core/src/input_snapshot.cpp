@@ -0,0 +1,354 @@
+#include "precompiled.h"
+
+#include <fstream>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include "exceptions.h"
+
+#include "input_snapshot.h"
+
+namespace input_snapshot {
+
+using namespace format;
+
+namespace {
+
+class snapshot_builder {
+public:
+	snapshot_builder() { reserve(sizeof(file_header)); }
+
+	offset_t reserve(size_t bytes) {
+		offset_t res = buf.size();
+		buf.resize(buf.size() + ((bytes + 7) & ~(size_t)7));
+		return res;
+	}
+
+	template <typename T>
+	T * at(offset_t offset) { return reinterpret_cast<T *>(&buf[(size_t)offset]); }
+
+	offset_t write_string(const char * str) {
+		size_t len = strlen(str);
+		offset_t res = reserve(len + 1);
+		memcpy(at<char>(res), str, len);
+		return res;
+	}
+
+	offset_t write_strings(char ** strs, size_t count) {
+		if (strs == nullptr || count == 0) { return 0; }
+		offset_t res = reserve(sizeof(offset_t) * count);
+		for (size_t i = 0; i < count; ++i) {
+			offset_t str = write_string(strs[i]);
+			at<offset_t>(res)[i] = str;
+		}
+		return res;
+	}
+
+	void write_loop(offset_t rec, const polyloop & loop) {
+		offset_t vertices = reserve(sizeof(point) * loop.vertex_count);
+		if (loop.vertex_count > 0) {
+			memcpy(
+				at<point>(vertices),
+				loop.vertices,
+				sizeof(point) * loop.vertex_count);
+		}
+		at<polyloop_record>(rec)->vertex_count = loop.vertex_count;
+		at<polyloop_record>(rec)->vertices = vertices;
+	}
+
+	void write_face(offset_t rec, const face & f) {
+		// The record offsets have to be recalculated every time because
+		// reserve() might move the buffer.
+		write_loop(rec + offsetof(face_record, outer_boundary), f.outer_boundary);
+		offset_t voids = reserve(sizeof(polyloop_record) * f.void_count);
+		for (size_t i = 0; i < f.void_count; ++i) {
+			write_loop(voids + i * sizeof(polyloop_record), f.voids[i]);
+		}
+		at<face_record>(rec)->void_count = f.void_count;
+		at<face_record>(rec)->voids = f.void_count > 0 ? voids : 0;
+	}
+
+	void write_solid(offset_t rec, const solid & s) {
+		at<solid_record>(rec)->rep_type = s.rep_type;
+		if (s.rep_type == REP_BREP) {
+			const brep & b = s.rep.as_brep;
+			offset_t faces = reserve(sizeof(face_record) * b.face_count);
+			for (size_t i = 0; i < b.face_count; ++i) {
+				write_face(faces + i * sizeof(face_record), b.faces[i]);
+			}
+			at<solid_record>(rec)->face_count = b.face_count;
+			at<solid_record>(rec)->faces = b.face_count > 0 ? faces : 0;
+		}
+		else if (s.rep_type == REP_EXT) {
+			const extruded_area_solid & ext = s.rep.as_ext;
+			at<solid_record>(rec)->ext_dx = ext.ext_dx;
+			at<solid_record>(rec)->ext_dy = ext.ext_dy;
+			at<solid_record>(rec)->ext_dz = ext.ext_dz;
+			at<solid_record>(rec)->extrusion_depth = ext.extrusion_depth;
+			write_face(rec + offsetof(solid_record, area), ext.area);
+		}
+	}
+
+	void write_element(offset_t rec, const element_info & e) {
+		memcpy(at<element_record>(rec)->name, e.name, sizeof(e.name));
+		at<element_record>(rec)->type = e.type;
+		at<element_record>(rec)->id = e.id;
+		write_solid(rec + offsetof(element_record, geometry), e.geometry);
+	}
+
+	void write_space(offset_t rec, const space_info & s) {
+		memcpy(at<space_record>(rec)->id, s.id, sizeof(s.id));
+		write_solid(rec + offsetof(space_record, geometry), s.geometry);
+	}
+
+	const std::vector<char> & data() const { return buf; }
+
+private:
+	std::vector<char> buf;
+};
+
+// A view of the mapped file that refuses to hand out anything that isn't
+// entirely inside it. Snapshots are trusted about as much as any other input
+// file, so a truncated or corrupted one results in a bad_snapshot_exception
+// and not a wild read.
+class mapped_view {
+public:
+	mapped_view(const char * base, offset_t size) : base(base), size(size) { }
+
+	template <typename T>
+	const T * get(offset_t offset, offset_t count) const {
+		if (count == 0) { return nullptr; }
+		if (offset % 8 != 0 ||
+			offset < sizeof(file_header) ||
+			offset > size ||
+			count > (size - offset) / sizeof(T))
+		{
+			throw bad_snapshot_exception();
+		}
+		return reinterpret_cast<const T *>(base + offset);
+	}
+
+	char * get_string(offset_t offset) const {
+		const char * str = get<char>(offset, 1);
+		if (memchr(str, '\0', (size_t)(size - offset)) == nullptr) {
+			throw bad_snapshot_exception();
+		}
+		// Nothing in the core writes to filter strings.
+		return const_cast<char *>(str);
+	}
+
+private:
+	const char * base;
+	offset_t size;
+};
+
+// The native structs are kept in deques so that their addresses are stable
+// while they're being created. (The face and void arrays have to be
+// contiguous, so each one is its own vector.)
+struct snapshot_storage {
+	boost::interprocess::file_mapping file;
+	boost::interprocess::mapped_region region;
+	std::deque<element_info> elements;
+	std::deque<space_info> spaces;
+	std::deque<std::vector<face>> face_arrays;
+	std::deque<std::vector<polyloop>> loop_arrays;
+	std::vector<element_info *> element_ptrs;
+	std::vector<space_info *> space_ptrs;
+	std::vector<char *> element_filter;
+	std::vector<char *> space_filter;
+
+	explicit snapshot_storage(const char * path)
+		: file(path, boost::interprocess::read_only),
+		region(file, boost::interprocess::read_only)
+	{ }
+
+	polyloop load_loop(const mapped_view & v, const polyloop_record & rec) {
+		polyloop res;
+		res.vertex_count = (size_t)rec.vertex_count;
+		// Deliberately casting away constness - the loaded structs have to
+		// look like the ones the core always gets, but the vertices are
+		// never written to.
+		res.vertices = const_cast<point *>(
+			v.get<point>(rec.vertices, rec.vertex_count));
+		return res;
+	}
+
+	face load_face(const mapped_view & v, const face_record & rec) {
+		face res;
+		res.outer_boundary = load_loop(v, rec.outer_boundary);
+		res.void_count = (size_t)rec.void_count;
+		res.voids = nullptr;
+		const polyloop_record * voids =
+			v.get<polyloop_record>(rec.voids, rec.void_count);
+		if (res.void_count > 0) {
+			loop_arrays.push_back(std::vector<polyloop>());
+			for (size_t i = 0; i < res.void_count; ++i) {
+				loop_arrays.back().push_back(load_loop(v, voids[i]));
+			}
+			res.voids = &loop_arrays.back().front();
+		}
+		return res;
+	}
+
+	solid load_solid(const mapped_view & v, const solid_record & rec) {
+		solid res;
+		memset(&res, 0, sizeof(res));
+		res.rep_type = (solid_rep_type)rec.rep_type;
+		if (res.rep_type == REP_BREP) {
+			brep & b = res.rep.as_brep;
+			b.face_count = (size_t)rec.face_count;
+			b.faces = nullptr;
+			const face_record * fs = v.get<face_record>(rec.faces, rec.face_count);
+			if (b.face_count > 0) {
+				std::vector<face> loaded;
+				for (size_t i = 0; i < b.face_count; ++i) {
+					loaded.push_back(load_face(v, fs[i]));
+				}
+				face_arrays.push_back(std::move(loaded));
+				b.faces = &face_arrays.back().front();
+			}
+		}
+		else if (res.rep_type == REP_EXT) {
+			extruded_area_solid & ext = res.rep.as_ext;
+			ext.ext_dx = rec.ext_dx;
+			ext.ext_dy = rec.ext_dy;
+			ext.ext_dz = rec.ext_dz;
+			ext.extrusion_depth = rec.extrusion_depth;
+			ext.area = load_face(v, rec.area);
+		}
+		else if (res.rep_type != REP_NOTHING) {
+			throw bad_snapshot_exception();
+		}
+		return res;
+	}
+};
+
+} // namespace
+
+void write(
+	const char * path,
+	size_t element_count,
+	element_info ** elements,
+	size_t space_count,
+	space_info ** spaces,
+	const sb_calculation_options & opts)
+{
+	snapshot_builder b;
+
+	offset_t element_recs = b.reserve(sizeof(element_record) * element_count);
+	for (size_t i = 0; i < element_count; ++i) {
+		b.write_element(element_recs + i * sizeof(element_record), *elements[i]);
+	}
+	offset_t space_recs = b.reserve(sizeof(space_record) * space_count);
+	for (size_t i = 0; i < space_count; ++i) {
+		b.write_space(space_recs + i * sizeof(space_record), *spaces[i]);
+	}
+	offset_t element_filter =
+		b.write_strings(opts.element_filter, opts.element_filter_count);
+	offset_t space_filter =
+		b.write_strings(opts.space_filter, opts.space_filter_count);
+
+	file_header * h = b.at<file_header>(0);
+	memcpy(h->magic, magic, sizeof(magic));
+	h->version = version;
+	h->file_size = b.data().size();
+	h->length_units_per_meter = opts.length_units_per_meter;
+	h->max_pair_distance_in_meters = opts.max_pair_distance_in_meters;
+	h->tolernace_in_meters = opts.tolernace_in_meters;
+	h->flags = opts.flags;
+	h->element_count = element_count;
+	h->elements = element_count > 0 ? element_recs : 0;
+	h->space_count = space_count;
+	h->spaces = space_count > 0 ? space_recs : 0;
+	h->element_filter_count = element_filter != 0 ? opts.element_filter_count : 0;
+	h->element_filter = element_filter;
+	h->space_filter_count = space_filter != 0 ? opts.space_filter_count : 0;
+	h->space_filter = space_filter;
+
+	std::ofstream out(path, std::ios::out | std::ios::binary | std::ios::trunc);
+	out.write(&b.data().front(), b.data().size());
+	out.close();
+	if (!out) { throw io_exception(); }
+}
+
+void load(const char * path, sbt_input_snapshot * snapshot) {
+	std::unique_ptr<snapshot_storage> storage;
+	try {
+		storage.reset(new snapshot_storage(path));
+	}
+	catch (boost::interprocess::interprocess_exception &) {
+		throw io_exception();
+	}
+
+	const char * base = static_cast<const char *>(storage->region.get_address());
+	offset_t size = storage->region.get_size();
+	if (size < sizeof(file_header)) { throw bad_snapshot_exception(); }
+	const file_header * h = reinterpret_cast<const file_header *>(base);
+	if (memcmp(h->magic, magic, sizeof(magic)) != 0 ||
+		h->version != version ||
+		h->file_size != size)
+	{
+		throw bad_snapshot_exception();
+	}
+	mapped_view v(base, size);
+
+	const element_record * es = v.get<element_record>(h->elements, h->element_count);
+	for (size_t i = 0; i < h->element_count; ++i) {
+		element_info e;
+		memcpy(e.name, es[i].name, sizeof(e.name));
+		e.name[ELEMENT_NAME_MAX_LEN] = '\0';
+		e.type = (element_type)es[i].type;
+		e.id = es[i].id;
+		e.geometry = storage->load_solid(v, es[i].geometry);
+		storage->elements.push_back(e);
+		storage->element_ptrs.push_back(&storage->elements.back());
+	}
+
+	const space_record * ss = v.get<space_record>(h->spaces, h->space_count);
+	for (size_t i = 0; i < h->space_count; ++i) {
+		space_info s;
+		memcpy(s.id, ss[i].id, sizeof(s.id));
+		s.id[SPACE_ID_MAX_LEN] = '\0';
+		s.geometry = storage->load_solid(v, ss[i].geometry);
+		storage->spaces.push_back(s);
+		storage->space_ptrs.push_back(&storage->spaces.back());
+	}
+
+	const offset_t * efs =
+		v.get<offset_t>(h->element_filter, h->element_filter_count);
+	for (size_t i = 0; i < h->element_filter_count; ++i) {
+		storage->element_filter.push_back(v.get_string(efs[i]));
+	}
+	const offset_t * sfs =
+		v.get<offset_t>(h->space_filter, h->space_filter_count);
+	for (size_t i = 0; i < h->space_filter_count; ++i) {
+		storage->space_filter.push_back(v.get_string(sfs[i]));
+	}
+
+	memset(snapshot, 0, sizeof(*snapshot));
+	snapshot->element_count = storage->element_ptrs.size();
+	snapshot->elements =
+		storage->element_ptrs.empty() ? nullptr : &storage->element_ptrs.front();
+	snapshot->space_count = storage->space_ptrs.size();
+	snapshot->spaces =
+		storage->space_ptrs.empty() ? nullptr : &storage->space_ptrs.front();
+	snapshot->opts.flags = h->flags;
+	snapshot->opts.length_units_per_meter = h->length_units_per_meter;
+	snapshot->opts.max_pair_distance_in_meters = h->max_pair_distance_in_meters;
+	snapshot->opts.tolernace_in_meters = h->tolernace_in_meters;
+	snapshot->opts.element_filter_count = storage->element_filter.size();
+	snapshot->opts.element_filter =
+		storage->element_filter.empty() ? nullptr : &storage->element_filter.front();
+	snapshot->opts.space_filter_count = storage->space_filter.size();
+	snapshot->opts.space_filter =
+		storage->space_filter.empty() ? nullptr : &storage->space_filter.front();
+	snapshot->storage = storage.release();
+}
+
+void release(sbt_input_snapshot * snapshot) {
+	delete static_cast<snapshot_storage *>(snapshot->storage);
+	memset(snapshot, 0, sizeof(*snapshot));
+}
+
+} // namespace input_snapshot
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "precompiled.h"
+
+#include <boost/cstdint.hpp>
+
+#include "sbt-core.h"
+
+// Input snapshots are the element and space arrays that
+// calculate_space_boundaries consumes, written to a single file so that
+// core-only runs don't have to go through the IFC toolkit. All offsets are
+// from the start of the file, all records are eight-byte aligned, and all
+// numbers are little-endian. The file layout deliberately doesn't depend on
+// the pointer width of the writer, so a snapshot written by the (32-bit)
+// GUI build can be consumed by a 64-bit command-line build: only the small
+// structural records are translated into native structs when a snapshot is
+// loaded, and the vertex arrays are used straight out of the file mapping.
+
+namespace input_snapshot {
+
+namespace format {
+
+typedef boost::uint64_t offset_t;
+
+const char magic[8] = { 'S', 'B', 'T', 'S', 'N', 'A', 'P', '\0' };
+const unsigned int version = 1;
+
+struct polyloop_record {
+	offset_t vertex_count;
+	offset_t vertices; // -> point[vertex_count]
+};
+
+struct face_record {
+	polyloop_record outer_boundary;
+	offset_t void_count;
+	offset_t voids; // -> polyloop_record[void_count]
+};
+
+struct solid_record {
+	int rep_type;
+	int padding;
+	offset_t face_count; // breps only
+	offset_t faces; // -> face_record[face_count], breps only
+	double ext_dx;
+	double ext_dy;
+	double ext_dz;
+	double extrusion_depth;
+	face_record area; // extrusions only
+};
+
+struct element_record {
+	element_name_t name;
+	int type;
+	element_id_t id;
+	solid_record geometry;
+};
+
+struct space_record {
+	space_id_t id;
+	solid_record geometry;
+};
+
+struct file_header {
+	char magic[8];
+	unsigned int version;
+	unsigned int reserved;
+	offset_t file_size;
+	double length_units_per_meter;
+	double max_pair_distance_in_meters;
+	double tolernace_in_meters;
+	int flags;
+	int padding;
+	offset_t element_count;
+	offset_t elements; // -> element_record[element_count]
+	offset_t space_count;
+	offset_t spaces; // -> space_record[space_count]
+	offset_t element_filter_count;
+	offset_t element_filter; // -> offset_t[element_filter_count] -> char[]
+	offset_t space_filter_count;
+	offset_t space_filter; // -> offset_t[space_filter_count] -> char[]
+};
+
+static_assert(sizeof(point) == 3 * sizeof(double), "point must be packed");
+static_assert(sizeof(polyloop_record) == 16, "bad polyloop_record layout");
+static_assert(sizeof(face_record) == 32, "bad face_record layout");
+static_assert(sizeof(solid_record) == 88, "bad solid_record layout");
+static_assert(sizeof(element_record) == 224, "bad element_record layout");
+static_assert(sizeof(space_record) == 216, "bad space_record layout");
+static_assert(sizeof(file_header) == 120, "bad file_header layout");
+
+} // namespace format
+
+void write(
+	const char * path,
+	size_t element_count,
+	element_info ** elements,
+	size_t space_count,
+	space_info ** spaces,
+	const sb_calculation_options & opts);
+
+// The loaded snapshot's storage owns the file mapping and every native struct
+// the snapshot refers to, so nothing in it outlives release().
+void load(const char * path, sbt_input_snapshot * snapshot);
+
+void release(sbt_input_snapshot * snapshot);
+
+} // namespace input_snapshot
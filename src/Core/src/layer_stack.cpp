@@ -0,0 +1,103 @@
+#include "precompiled.h"
+
+#include "statistics.h"
+
+#include "layer_stack.h"
+
+namespace {
+
+statistics::counter g_stacks_created("layer stacks: created");
+statistics::counter g_stacks_reused("layer stacks: reused");
+
+// Hashes the layers by their elements and (approximate) heights; stacks
+// with the same hash are compared exactly.
+size_t hash_layers(const std::vector<layer_information> & layers) {
+	size_t res = layers.size();
+	auto combine = [&res](size_t h) { res ^= h + 0x9e3779b9 + (res << 6) + (res >> 2); };
+	for (auto l = layers.begin(); l != layers.end(); ++l) {
+		combine(std::hash<const void *>()(&l->layer_element()));
+		combine(std::hash<double>()(CGAL::to_double(l->height_a())));
+		if (l->has_both_sides()) {
+			combine(std::hash<double>()(CGAL::to_double(l->height_b())));
+		}
+	}
+	return res;
+}
+
+bool same_layer(const layer_information & a, const layer_information & b) {
+	return
+		&a.layer_element() == &b.layer_element() &&
+		a.has_both_sides() == b.has_both_sides() &&
+		a.height_a() == b.height_a() &&
+		(!a.has_both_sides() || a.height_b() == b.height_b());
+}
+
+// Holds the stacks weakly so that they go away with the last surface that
+// uses them. Expired entries are swept out whenever the table has doubled
+// in size since the last sweep.
+class intern_table {
+public:
+	intern_table() : size_at_last_sweep(0) { }
+
+	template <typename Pred>
+	layer_stack::ptr find(size_t hash, Pred matches) {
+		auto range = stacks.equal_range(hash);
+		for (auto s = range.first; s != range.second; ++s) {
+			layer_stack::ptr stack = s->second.lock();
+			if (stack && matches(*stack)) { return stack; }
+		}
+		return layer_stack::ptr();
+	}
+
+	void insert(size_t hash, const layer_stack::ptr & stack) {
+		if (stacks.size() > 2 * size_at_last_sweep + 64) {
+			for (auto s = stacks.begin(); s != stacks.end(); ) {
+				if (s->second.expired()) { s = stacks.erase(s); }
+				else { ++s; }
+			}
+			size_at_last_sweep = stacks.size();
+		}
+		stacks.insert(std::make_pair(hash, std::weak_ptr<const layer_stack>(stack)));
+	}
+
+private:
+	std::unordered_multimap<size_t, std::weak_ptr<const layer_stack>> stacks;
+	size_t size_at_last_sweep;
+};
+
+intern_table g_table;
+
+} // namespace
+
+layer_stack::layer_stack(std::vector<layer_information> && layers)
+	: layers(std::move(layers))
+{ }
+
+bool layer_stack::has_same_layers(const std::vector<layer_information> & other) const {
+	return
+		layers.size() == other.size() &&
+		std::equal(layers.begin(), layers.end(), other.begin(), same_layer);
+}
+
+layer_stack::ptr layer_stack::intern(std::vector<layer_information> && layers) {
+	size_t hash = hash_layers(layers);
+	ptr existing = g_table.find(hash, [&layers](const layer_stack & s) { return s.has_same_layers(layers); });
+	if (existing) {
+		g_stacks_reused.increment();
+		return existing;
+	}
+	g_stacks_created.increment();
+	ptr res(new layer_stack(std::move(layers)));
+	g_table.insert(hash, res);
+	return res;
+}
+
+layer_stack::ptr layer_stack::reversed() const {
+	ptr res = rev.lock();
+	if (!res) {
+		res = intern(std::vector<layer_information>(layers.rbegin(), layers.rend()));
+		rev = res;
+		res->rev = shared_from_this();
+	}
+	return res;
+}
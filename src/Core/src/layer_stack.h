@@ -0,0 +1,43 @@
+#pragma once
+
+#include "precompiled.h"
+
+#include "layer_information.h"
+
+// An immutable sequence of material layers. Every piece of every surface
+// through a wall needs the wall's layers, so stacks are interned: equal
+// stacks are the same object, and surfaces just point to it. A stack lives
+// as long as something points to it.
+class layer_stack : public std::enable_shared_from_this<layer_stack> {
+public:
+	typedef std::shared_ptr<const layer_stack> ptr;
+	typedef std::vector<layer_information>::const_iterator const_iterator;
+
+	static ptr intern(std::vector<layer_information> && layers);
+	template <typename LayerRange>
+	static ptr intern(const LayerRange & layers) {
+		return intern(std::vector<layer_information>(boost::begin(layers), boost::end(layers)));
+	}
+
+	const_iterator				begin() const { return layers.begin(); }
+	const_iterator				end() const { return layers.end(); }
+	size_t						size() const { return layers.size(); }
+	bool						empty() const { return layers.empty(); }
+	const layer_information &	front() const { return layers.front(); }
+	const layer_information &	back() const { return layers.back(); }
+	const layer_information &	operator [] (size_t i) const { return layers[i]; }
+
+	// The same layers in the opposite order (also interned).
+	ptr reversed() const;
+
+private:
+	std::vector<layer_information> layers;
+	mutable std::weak_ptr<const layer_stack> rev;
+
+	explicit layer_stack(std::vector<layer_information> && layers);
+
+	bool has_same_layers(const std::vector<layer_information> & other) const;
+
+	layer_stack(const layer_stack & disabled);
+	layer_stack & operator = (const layer_stack & disabled);
+};
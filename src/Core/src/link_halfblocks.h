@@ -8,10 +8,11 @@ namespace blocking {
 
 namespace impl {
 
-template <typename OutputIterator>
-void link_halfblocks(std::list<oriented_area> && halfblocks, const element & e, OutputIterator oi) {
+// HalfblockList is an std::list of oriented_areas (with any allocator).
+template <typename HalfblockList, typename OutputIterator>
+void link_halfblocks(HalfblockList && halfblocks, const element & e, OutputIterator oi) {
 	while (!halfblocks.empty()) {
-		std::list<oriented_area>::iterator curr_other = halfblocks.end();
+		auto curr_other = halfblocks.end();
 		boost::optional<NT> curr_height;
 		for (auto other = halfblocks.begin(); other != halfblocks.end(); ++other) {
 			if (other != halfblocks.begin()) {
@@ -214,6 +214,12 @@ void multiview_solid::subtract(const multiview_solid & other, equality_context *
 	}
 }
 
+void multiview_solid::release() {
+	as_face_groups_.reset();
+	as_extrusion_info_.reset();
+	as_nef_.reset();
+}
+
 bool multiview_solid::share_plane_opposite(
 	const multiview_solid & a,
 	const multiview_solid & b,
@@ -34,10 +34,20 @@ private:
 public:
 	multiview_solid(const solid & s, equality_context * c);
 
+	multiview_solid(const multiview_solid & src)
+		: as_face_groups_(src.as_face_groups_),
+		  as_extrusion_info_(src.as_extrusion_info_),
+		  as_nef_(src.as_nef_) { }
 	multiview_solid(multiview_solid && src) 
 		: as_face_groups_(std::move(src.as_face_groups_)),
 		  as_extrusion_info_(std::move(src.as_extrusion_info_)),
 		  as_nef_(std::move(src.as_nef_)) { }
+	multiview_solid & operator = (const multiview_solid & src) { 
+		as_face_groups_ = src.as_face_groups_;
+		as_extrusion_info_ = src.as_extrusion_info_;
+		as_nef_ = src.as_nef_;
+		return *this;
+	}
 	multiview_solid & operator = (multiview_solid && src) { 
 		as_face_groups_ = std::move(src.as_face_groups_);
 		as_extrusion_info_ = std::move(src.as_extrusion_info_);
@@ -52,6 +62,11 @@ public:
 
 	void subtract(const multiview_solid & other, equality_context * c);
 
+	// Drops every representation of the solid (including any Nef
+	// polyhedron), leaving it empty. This is for when nothing is going to
+	// look at the geometry again.
+	void release();
+
 	static bool share_plane_opposite(
 		const multiview_solid & a,
 		const multiview_solid & b,
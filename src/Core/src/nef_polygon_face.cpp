@@ -46,7 +46,7 @@ std::string face::to_string() const {
 	}
 	for (auto h = e->holes_begin(f); h != e->holes_end(f); ++h) {
 		ss << "Hole:\n";
-		nef_polygon_2::Explorer::Halfedge_around_face_const_circulator curr = h;
+		nef_polygon_2::Explorer::Halfedge_around_face_const_circulator curr(h);
 		auto end = curr;
 		CGAL_For_all(curr, end) {
 			if (e->is_standard(curr->vertex())) {
@@ -70,7 +70,7 @@ boost::optional<polygon_with_holes_2> face::to_pwh() const {
 	if (!out) { return boost::optional<polygon_with_holes_2>(); }
 	std::vector<polygon_2> holes;
 	for (auto h = e->holes_begin(f); h != e->holes_end(f); ++h) {
-		nef_polygon_2::Explorer::Halfedge_around_face_const_circulator curr = h;
+		nef_polygon_2::Explorer::Halfedge_around_face_const_circulator curr(h);
 		auto end = curr;
 		holes.push_back(polygon_2());
 		CGAL_For_all(curr, end) {
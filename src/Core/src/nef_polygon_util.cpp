@@ -3,6 +3,7 @@
 #include "cleanup_loop.h"
 #include "report.h"
 #include "sbt-core.h"
+#include "statistics.h"
 
 #include "nef_polygon_util.h"
 
@@ -14,10 +15,18 @@ namespace nef_polygons {
 
 namespace util {
 
+namespace {
+
+statistics::counter g_clean_passes("nef clean: passes");
+statistics::counter g_clean_rebuilds("nef clean: rebuilds");
+
+} // namespace
+
 nef_polygon_2 clean(const nef_polygon_2 & nef) {
 	typedef std::vector<espoint_2> loop_t;
 
 	if (nef.is_empty()) { return nef; }
+	g_clean_passes.increment();
 
 	nef_polygon_2::Explorer e = nef.explorer();
 	std::vector<loop_t> loops;
@@ -38,7 +47,7 @@ nef_polygon_2 clean(const nef_polygon_2 & nef) {
 			}
 			for (auto h = e.holes_begin(f); h != e.holes_end(f); ++h) {
 				loops.push_back(loop_t());
-				nef_polygon_2::Explorer::Halfedge_around_face_const_circulator p = h;
+				nef_polygon_2::Explorer::Halfedge_around_face_const_circulator p(h);
 				auto end = p;
 				if (p != end) {
 					CGAL_For_all(p, end) {
@@ -60,6 +69,7 @@ nef_polygon_2 clean(const nef_polygon_2 & nef) {
 
 	if (!changed) { return nef; }
 	else {
+		g_clean_rebuilds.increment();
 		nef_polygon_2 res(nef_polygon_2::EMPTY);
 		boost::for_each(loops, [&res](const loop_t & loop) {
 			res ^= nef_polygon_2(loop.begin(), loop.end(), nef_polygon_2::EXCLUDED);
@@ -85,6 +95,25 @@ nef_polygon_2 create_nef_polygon(polygon_2 poly) {
 		nef_polygon_2(ext.rbegin(), ext.rend(), nef_polygon_2::EXCLUDED);
 }
 
+// Combines the Nef polygons in pairs, then the results in pairs, and so on.
+// Folding them into a single result one at a time is quadratic when there
+// are a lot of them (i.e. faces with lots of voids), because every step
+// overlays the whole result so far. (Nef_polyhedron_2 has a constructor that
+// takes several polygons at once but it can only join them.)
+nef_polygon_2 symmetric_difference(std::vector<nef_polygon_2> nefs) {
+	if (nefs.empty()) { return nef_polygon_2(); }
+	while (nefs.size() > 1) {
+		std::vector<nef_polygon_2> combined;
+		combined.reserve((nefs.size() + 1) / 2);
+		for (size_t i = 0; i + 1 < nefs.size(); i += 2) {
+			combined.push_back(nefs[i] ^ nefs[i + 1]);
+		}
+		if (nefs.size() % 2 == 1) { combined.push_back(nefs.back()); }
+		nefs.swap(combined);
+	}
+	return nefs.front();
+}
+
 espoint_2 to_espoint(const point_2 & p) { 
 	return espoint_2(p.x(), p.y()); 
 }
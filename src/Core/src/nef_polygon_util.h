@@ -12,6 +12,7 @@ namespace util {
 
 nef_polygon_2	clean(const nef_polygon_2 & nef);
 nef_polygon_2	create_nef_polygon(polygon_2 poly);
+nef_polygon_2	symmetric_difference(std::vector<nef_polygon_2> nefs);
 espoint_2		to_espoint(const point_2 & p);
 size_t			vertex_count(const nef_polygon_2 & nef);
 
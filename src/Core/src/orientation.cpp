@@ -7,6 +7,20 @@
 
 namespace {
 
+transformation_3 rotation_from_quaternion(const NT & w, const NT & x, const NT & y, const NT & z) {
+	// the quaternion doesn't need to be normalized
+	NT ONE(1.0);
+
+	auto nq = w * w + x * x + y * y + z * z;
+	assert(nq > NT(0.0));
+	auto s = 2 / nq;
+
+	return transformation_3(
+		ONE-(y*y*s+z*z*s),	x*y*s-w*z*s,		x*z*s+w*y*s,
+		x*y*s+w*z*s,		ONE-(x*x*s+z*z*s),	y*z*s-w*x*s,
+		x*z*s-w*y*s,		y*z*s+w*x*s,		ONE-(x*x*s+y*y*s));
+}
+
 transformation_3 build_flatten(const direction_3 & d) {
 	// use a quaternion
 
@@ -24,28 +38,52 @@ transformation_3 build_flatten(const direction_3 & d) {
 	auto qv = CGAL::cross_product(v, zhat);
 	auto qw = v * zhat;
 
-	auto nq = qw * qw + qv.squared_length();
-	assert(nq > ZERO);
-	auto s = 2 / nq;
+	return rotation_from_quaternion(qw, qv.x(), qv.y(), qv.z());
+}
 
-	auto w = qw;
-	auto x = qv.x();
-	auto y = qv.y();
-	auto z = qv.z();
+// The same rotation as build_flatten, except that the direction is
+// normalized in doubles and rounded to a multiple of 2^-30 first. Any
+// rational quaternion gives a rational rotation, so no square roots are
+// needed.
+transformation_3 build_rational_flatten(const direction_3 & d) {
+	double dx = CGAL::to_double(d.dx());
+	double dy = CGAL::to_double(d.dy());
+	double dz = CGAL::to_double(d.dz());
+	double len = sqrt(dx * dx + dy * dy + dz * dz);
+	assert(len > 0.0);
 
-	return transformation_3(
-		ONE-(y*y*s+z*z*s),	x*y*s-w*z*s,		x*z*s+w*y*s,
-		x*y*s+w*z*s,		ONE-(x*x*s+z*z*s),	y*z*s-w*x*s,
-		x*z*s-w*y*s,		y*z*s+w*x*s,		ONE-(x*x*s+y*y*s));
+	const double SCALE = 1073741824.0; // 2^30
+	auto rounded = [SCALE, len](double c) { return NT(floor(c / len * SCALE + 0.5) / SCALE); };
+	vector_3 dir(rounded(dx), rounded(dy), rounded(dz));
+
+	vector_3 v = dir + vector_3(0, 0, 1);
+	if (CGAL::is_zero(v.x()) && CGAL::is_zero(v.y()) && CGAL::is_zero(v.z())) {
+		// straight down: turn over around the x axis
+		return rotation_from_quaternion(0, 1, 0, 0);
+	}
+	// cross_product(v, zhat) and v * zhat
+	return rotation_from_quaternion(v.z(), v.y(), -v.x(), 0);
 }
 
 } // namespace
 
-orientation::orientation(const direction_3 & d)
+orientation::orientation(const direction_3 & d, bool rational)
 	: m_direction(d),
-	m_flatten(build_flatten(d)),
-	m_unflatten(m_flatten.inverse())
+	m_flatten(rational ? build_rational_flatten(d) : build_flatten(d)),
+	m_unflatten(m_flatten.inverse()),
+	m_rational(rational)
 { 
+	if (rational) {
+		m_unit_normal = vector_3(0, 0, 1).transform(m_unflatten);
+	}
+	else {
+		m_unit_normal = d.to_vector() / CGAL::sqrt(d.to_vector().squared_length());
+	}
+	for (int i = 0; i < 3; ++i) {
+		for (int j = 0; j < 4; ++j) {
+			m_unflatten_approx[i][j] = CGAL::to_double(m_unflatten.m(i, j));
+		}
+	}
 #ifndef NDEBUG
 	debug_dx = CGAL::to_double(m_direction.dx());
 	debug_dy = CGAL::to_double(m_direction.dy());
@@ -59,6 +97,18 @@ std::string orientation::to_string() const {
 	return std::string(buf);
 }
 
+void orientation::unflatten_approximately(double * xs, double * ys, double * zs, size_t count) const {
+	const double (&m)[3][4] = m_unflatten_approx;
+	for (size_t i = 0; i < count; ++i) {
+		double x = xs[i];
+		double y = ys[i];
+		double z = zs[i];
+		xs[i] = m[0][0] * x + m[0][1] * y + m[0][2] * z + m[0][3];
+		ys[i] = m[1][0] * x + m[1][1] * y + m[1][2] * z + m[1][3];
+		zs[i] = m[2][0] * x + m[2][1] * y + m[2][2] * z + m[2][3];
+	}
+}
+
 bool orientation::are_perpendicular(const orientation & a, const orientation & b, double eps) {
 	if (eps != 0.0 && eps != -0.0) {
 		return equality_context::is_zero_squared((a.vector().squared_length() + b.vector().squared_length() - (a.vector() - b.vector()).squared_length()), eps);
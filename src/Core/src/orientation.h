@@ -7,6 +7,10 @@ private:
 	direction_3 m_direction;
 	transformation_3 m_flatten;
 	transformation_3 m_unflatten;
+	vector_3 m_unit_normal;
+	bool m_rational;
+	// m_unflatten in doubles, for output, which is in doubles anyway.
+	double m_unflatten_approx[3][4];
 
 #ifndef NDEBUG
 	double debug_dx;
@@ -20,11 +24,25 @@ private:
 	orientation & operator = (orientation && disabled);
 
 public:
-	explicit orientation(const direction_3 & d);
+	// If rational is set, the flattener is a rotation with rational entries
+	// that takes the direction to within a billionth of a radian of the z
+	// axis, rather than the exact (algebraic) one. Everything flattened with
+	// it stays rational.
+	explicit orientation(const direction_3 & d, bool rational = false);
 
 	const direction_3 & direction() const { return m_direction; }
 	const transformation_3 & flattener() const { return m_flatten; }
 	const transformation_3 & unflattener() const { return m_unflatten; }
+	// The unit vector that the flattener takes to the z axis. For a rational
+	// orientation this is only approximately parallel to the direction, but
+	// it's rational.
+	const vector_3 & unit_normal() const { return m_unit_normal; }
+	bool is_rational() const { return m_rational; }
+
+	// Unflattens count points in place, in doubles. Point i is (xs[i], ys[i],
+	// zs[i]); the coordinates are kept in separate arrays so that the loop
+	// vectorizes.
+	void unflatten_approximately(double * xs, double * ys, double * zs, size_t count) const;
 
 	const NT & dx() const { return direction().dx(); }
 	const NT & dy() const { return direction().dy(); }
@@ -23,15 +23,17 @@ std::vector<point_2> convert_to_2d(const PointRange3D & loop, const transformati
 	return res;
 }
 
-NT calculate_p(const plane_3 & pl) {
+NT calculate_p(const plane_3 & pl, const point_3 & on_plane, const orientation & o) {
+	if (o.is_rational()) {
+		// measure against the orientation's normal so that the height stays
+		// rational
+		NT res = -(o.unit_normal() * (on_plane - CGAL::ORIGIN));
+		return geometry_common::share_sense(o.direction(), pl.orthogonal_direction()) ? res : -res;
+	}
 	// http://mathworld.wolfram.com/HessianNormalForm.html
 	return pl.d() / CGAL::sqrt(pl.a() * pl.a() + pl.b() * pl.b() + pl.c() * pl.c());
 }
 
-vector_3 normalized_vector(const direction_3 & d) {
-	return d.to_vector() / CGAL::sqrt(d.to_vector().squared_length());
-}
-
 } // namespace
 
 oriented_area::oriented_area(const simple_face & f, equality_context * c) {
@@ -39,7 +41,7 @@ oriented_area::oriented_area(const simple_face & f, equality_context * c) {
 	flipped = !flipped;
 
 	plane_3 pl(f.average_outer_point(), o->direction());
-	p = calculate_p(pl);
+	p = calculate_p(pl, f.average_outer_point(), *o);
 
 	std::vector<std::vector<point_2>> loops;
 	loops.push_back(convert_to_2d(f.outer(), o->flattener(), c));
@@ -63,7 +65,7 @@ oriented_area::oriented_area(nef_halffacet_handle h, equality_context * c) {
 	std::tie(o, flipped) = c->request_orientation(pl.orthogonal_direction());
 	flipped = !flipped;
 
-	p = calculate_p(flipped ? pl.opposite() : pl);
+	p = calculate_p(flipped ? pl.opposite() : pl, pl.point(), *o);
 
 	m_bounding_box = nef_polyhedron_3::SHalfedge_around_facet_const_circulator(h->facet_cycles_begin())->source()->center_vertex()->point().bbox();
 
@@ -100,7 +102,7 @@ oriented_area::oriented_area(
 	auto normal = std::get<0>(pts_info).orthogonal_direction();
 	std::tie(o, flipped) = c->request_orientation(normal);
 	flipped = !flipped;
-	p = calculate_p(std::get<0>(pts_info));
+	p = calculate_p(std::get<0>(pts_info), std::get<1>(pts_info), *o);
 	if (flipped) { p = -p; }
 	auto bound = convert_to_2d(pts, o->flattener(), c);
 	a = area(std::vector<std::vector<point_2>>(1, bound));
@@ -133,12 +135,12 @@ oriented_area & oriented_area::operator = (oriented_area && src) {
 }
 
 plane_3 oriented_area::backing_plane() const {
-	vector_3 n = normalized_vector(o->direction());
+	const vector_3 & n = o->unit_normal();
 	return flipped ? plane_3(n.x(), n.y(), n.z(), p).opposite() : plane_3(n.x(), n.y(), n.z(), p);
 }
 
 plane_3 oriented_area::parallel_plane_through_origin() const {
-	vector_3 n = normalized_vector(o->direction());
+	const vector_3 & n = o->unit_normal();
 	return plane_3(n.x(), n.y(), n.z(), 0.0);
 }
 
@@ -177,6 +179,10 @@ std::vector<polygon_with_holes_3> oriented_area::to_3d(bool flatten_numbers) con
 	return res;
 }
 
+std::vector<point_3> oriented_area::outer_to_3d(const polygon_with_holes_2 & pwh, bool flatten_numbers) const {
+	return to_3d(flatten_numbers ? geometry_common::flatten(pwh).outer() : pwh.outer());
+}
+
 oriented_area oriented_area::project_onto_self(const oriented_area & other) const {
 	if (other.o == o) {
 		return oriented_area(o, other.a, p, other.flipped);
@@ -12,14 +12,14 @@ class simple_face;
 
 class oriented_area {
 private:
-	const orientation * o;
+	const ::orientation * o;
 	area a;
 	NT p;
 	bool flipped;
 
 	bbox_3 m_bounding_box;
 
-	oriented_area(const orientation * o, const area & a, const NT & p, bool flipped) : o(o), a(a), p(p), flipped(flipped) { }
+	oriented_area(const ::orientation * o, const area & a, const NT & p, bool flipped) : o(o), a(a), p(p), flipped(flipped) { }
 
 	point_3 to_3d(const point_2 & pt) const { return point_3(pt.x(), pt.y(), -p).transform(o->unflattener()); }
 
@@ -34,7 +34,7 @@ private:
 		return to_3d(polygon_2(loop.begin(), loop.end()));
 	}
 
-	typedef orientation orientation_t; // derp derp
+	typedef ::orientation orientation_t; // derp derp
 
 public:
 	oriented_area(const simple_face & face, equality_context * c);
@@ -57,7 +57,7 @@ public:
 	oriented_area & operator = (oriented_area && src);
 
 	const area &			area_2d() const { return a; }
-	const orientation &		orientation() const { return *o; }
+	const ::orientation &	orientation() const { return *o; }
 	NT						height() const { return -p; }
 	bool					sense() const { return !flipped; }
 	plane_3					backing_plane() const;
@@ -71,6 +71,9 @@ public:
 	// THIS METHOD DOESN'T ACCOUNT FOR SENSE INFORMATION
 	// the caller should flip the result themselves if they care
 	std::vector<polygon_with_holes_3> to_3d(bool flatten_numbers = false) const;
+	// The outer boundary of one of the polygons from area_2d().to_pwhs(), as
+	// to_3d would compute it, for callers that already have the polygons.
+	std::vector<point_3> outer_to_3d(const polygon_with_holes_2 & pwh, bool flatten_numbers = false) const;
 
 	oriented_area project_onto_self(const oriented_area & other) const;
 
@@ -0,0 +1,106 @@
+#include "precompiled.h"
+
+#ifdef _WIN32
+#include <psapi.h>
+#pragma comment(lib, "psapi.lib")
+#else
+#include <sys/resource.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+#include "exceptions.h"
+
+#include "platform.h"
+
+namespace platform {
+
+#ifdef _WIN32
+
+namespace {
+
+void exception_translator(unsigned int code, struct _EXCEPTION_POINTERS *) {
+	if (code == EXCEPTION_STACK_OVERFLOW) {
+		// don't call _resetskoflow() here yet - the stack isn't unwound. or something.
+		throw stack_overflow_exception();
+	}
+	else {
+		throw sbt_exception();
+	}
+}
+
+} // namespace
+
+hardware_exception_scope::hardware_exception_scope()
+	: old_translator(_set_se_translator(&exception_translator))
+{ }
+
+hardware_exception_scope::~hardware_exception_scope() {
+	_set_se_translator(old_translator);
+}
+
+void recover_from_stack_overflow() {
+	_resetstkoflw();
+}
+
+double seconds_now() {
+	LARGE_INTEGER freq, now;
+	QueryPerformanceFrequency(&freq);
+	QueryPerformanceCounter(&now);
+	return (double)now.QuadPart / (double)freq.QuadPart;
+}
+
+size_t peak_resident_bytes() {
+	PROCESS_MEMORY_COUNTERS counters;
+	if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+		return counters.PeakWorkingSetSize;
+	}
+	return 0;
+}
+
+size_t current_resident_bytes() {
+	PROCESS_MEMORY_COUNTERS counters;
+	if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+		return counters.WorkingSetSize;
+	}
+	return 0;
+}
+
+#else
+
+hardware_exception_scope::hardware_exception_scope() { }
+
+hardware_exception_scope::~hardware_exception_scope() { }
+
+void recover_from_stack_overflow() { }
+
+double seconds_now() {
+	timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+size_t peak_resident_bytes() {
+	rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#ifdef __APPLE__
+		return (size_t)usage.ru_maxrss;
+#else
+		return (size_t)usage.ru_maxrss * 1024;
+#endif
+	}
+	return 0;
+}
+
+size_t current_resident_bytes() {
+	size_t pages = 0;
+	FILE * statm = fopen("/proc/self/statm", "r");
+	if (statm == nullptr) { return 0; }
+	if (fscanf(statm, "%*s %zu", &pages) != 1) { pages = 0; }
+	fclose(statm);
+	return pages * (size_t)sysconf(_SC_PAGESIZE);
+}
+
+#endif
+
+} // namespace platform
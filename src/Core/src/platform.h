@@ -0,0 +1,42 @@
+#pragma once
+
+#include "precompiled.h"
+
+// Everything operating-system specific that the core needs lives behind
+// this header. The Windows build gets hardware exception translation (so that
+// stack overflows surface as stack_overflow_exceptions that processing can
+// recover from) and everything else gets no-op equivalents - a stack
+// overflow there takes the process down, which is what the command-line
+// tools expect anyway.
+
+namespace platform {
+
+// While one of these is alive, hardware exceptions raised on the current
+// thread are rethrown as sbt_exceptions.
+class hardware_exception_scope {
+public:
+	hardware_exception_scope();
+	~hardware_exception_scope();
+private:
+#ifdef _WIN32
+	_se_translator_function old_translator;
+#endif
+	hardware_exception_scope(const hardware_exception_scope &);
+	hardware_exception_scope & operator = (const hardware_exception_scope &);
+};
+
+// Must be called (outside of the catch block, once the stack has been
+// unwound) after a stack_overflow_exception has been caught.
+void recover_from_stack_overflow();
+
+// Monotonic wall-clock time, for timing things.
+double seconds_now();
+
+// The largest resident set size the process has had, or 0 if it can't be
+// determined.
+size_t peak_resident_bytes();
+
+// The process's current resident set size, or 0 if it can't be determined.
+size_t current_resident_bytes();
+
+} // namespace platform
@@ -3,6 +3,8 @@
 #include "precompiled.h"
 
 #include "equality_context.h"
+#include "exceptions.h"
+#include "vertex_welding.h"
 
 namespace solid_geometry {
 
@@ -29,24 +31,17 @@ public:
 	
 	template <typename FaceRange>
 	static poly_builder create(const FaceRange & faces) {
-		std::vector<point_3> points;
 		std::vector<std::deque<size_t>> indices;
-		std::map<point_3, size_t> point_lookup;
+		vertex_welding::vertex_welder<point_3> points;
 
 		for (auto f = faces.begin(); f != faces.end(); ++f) {
 			indices.push_back(std::deque<size_t>());
 			assert(f->voids().size() == 0);
 			for (auto p = f->outer().begin(); p != f->outer().end(); ++p) {
-				auto exists = point_lookup.find(*p);
-				if (exists == point_lookup.end()) {
-					auto new_entry = std::make_pair(*p, points.size());
-					exists = point_lookup.insert(new_entry).first;
-					points.push_back(*p);
-				}
-				indices.back().push_back(exists->second);
+				indices.back().push_back(points.weld(*p));
 			}
 		}
-		auto res = poly_builder(points, indices);
+		auto res = poly_builder(points.points(), indices);
 		if (!res.all_faces_planar()) { throw bad_brep_exception(); }
 		return res;
 	}
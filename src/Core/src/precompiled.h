@@ -2,10 +2,16 @@
 
 // Do NOT enable this, CGAL 4.1 (nef polyhedra specifically) breaks if you do.
 //#define BOOST_RESULT_OF_USE_DECLTYPE
+// Newer boosts default to it on newer compilers, so ask for the old behavior
+// explicitly.
+#define BOOST_RESULT_OF_USE_TR1
 
 #define CGAL_LEDA_VERSION 630
+#ifdef _WIN32
 #define LEDA_DLL
+#endif
 
+#ifdef _MSC_VER
 // All MSVC warnings. Arguably these shouldn't be in source but this way I can
 // notate what they actually do.
 #pragma warning (disable:4018) // signed/unsigned mismatch
@@ -17,24 +23,34 @@
 #pragma warning (disable:4701) // potential use of uninitialized variable
 #pragma warning (disable:4702) // unreachable code
 #pragma warning (disable:4756) // overflow in constant arithmetic
+#endif
 #include <vector>
 #include <list>
 #include <map>
+#include <unordered_map>
+#include <unordered_set>
+#include <set>
 #include <deque>
 #include <queue>
 #include <string>
 #include <algorithm>
 #include <iostream>
 #include <memory>
+#include <functional>
+#include <sstream>
+#include <tuple>
 #include <exception>
 #include <cassert>
 #include <cstdlib>
 #include <cmath>
 #include <cstdio>
+#include <cstring>
 #include <ctime>
 
+#ifdef _WIN32
 #include <windows.h>
 #include <eh.h>
+#endif
 
 #include <boost/format.hpp>
 #include <boost/multi_array.hpp>
@@ -46,6 +62,7 @@
 
 #include <CGAL/leda_real.h>
 #include <CGAL/Cartesian.h>
+#include <CGAL/Simple_cartesian.h>
 #include <CGAL/Extended_cartesian.h>
 #include <CGAL/Polygon_2.h>
 #include <CGAL/Polyhedron_3.h>
@@ -58,7 +75,9 @@
 #include <CGAL/Interval_skip_list_interval.h>
 #include <CGAL/Nef_polyhedron_2.h>
 #include <CGAL/Nef_polyhedron_3.h>
+#ifdef _MSC_VER
 #pragma warning (pop)
+#endif
 
 //#define EPS_MAGIC 0.1
 
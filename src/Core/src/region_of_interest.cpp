@@ -0,0 +1,119 @@
+#include "precompiled.h"
+
+#include "sbt-core.h"
+
+#include "region_of_interest.h"
+
+namespace region_of_interest {
+
+namespace {
+
+void add_loop(boost::optional<bbox_3> * box, const polyloop & loop, double dx, double dy, double dz) {
+	for (size_t i = 0; i < loop.vertex_count; ++i) {
+		const point & p = loop.vertices[i];
+		bbox_3 pt(p.x, p.y, p.z, p.x, p.y, p.z);
+		bbox_3 ext(p.x + dx, p.y + dy, p.z + dz, p.x + dx, p.y + dy, p.z + dz);
+		*box = *box ? **box + pt + ext : pt + ext;
+	}
+}
+
+boost::optional<bbox_3> raw_bounding_box(const solid & s) {
+	boost::optional<bbox_3> res;
+	if (s.rep_type == REP_BREP) {
+		for (size_t i = 0; i < s.rep.as_brep.face_count; ++i) {
+			add_loop(&res, s.rep.as_brep.faces[i].outer_boundary, 0, 0, 0);
+		}
+	}
+	else if (s.rep_type == REP_EXT) {
+		const extruded_area_solid & ext = s.rep.as_ext;
+		double len = sqrt(
+			ext.ext_dx * ext.ext_dx +
+			ext.ext_dy * ext.ext_dy +
+			ext.ext_dz * ext.ext_dz);
+		if (len > 0) {
+			double scale = ext.extrusion_depth / len;
+			add_loop(
+				&res,
+				ext.area.outer_boundary,
+				ext.ext_dx * scale,
+				ext.ext_dy * scale,
+				ext.ext_dz * scale);
+		}
+	}
+	return res;
+}
+
+bbox_3 expand(const bbox_3 & b, double d) {
+	return bbox_3(
+		b.xmin() - d, b.ymin() - d, b.zmin() - d,
+		b.xmax() + d, b.ymax() + d, b.zmax() + d);
+}
+
+} // namespace
+
+std::vector<element_info *> cull_elements(
+	element_info ** elements,
+	size_t element_count,
+	const std::vector<space_info *> & spaces,
+	const guid_filter & filter,
+	double max_distance,
+	double eps)
+{
+	std::vector<bbox_3> regions;
+	for (auto s = spaces.begin(); s != spaces.end(); ++s) {
+		auto box = raw_bounding_box((*s)->geometry);
+		if (box) { regions.push_back(expand(*box, max_distance + eps)); }
+	}
+
+	// Elements without a usable bounding box are kept so that load_elements
+	// gets to complain about them like it always does.
+	std::vector<element_info *> candidates;
+	std::vector<boost::optional<bbox_3>> boxes;
+	std::vector<bool> keep;
+	for (size_t i = 0; i < element_count; ++i) {
+		if (filter(elements[i]->name)) {
+			auto box = raw_bounding_box(elements[i]->geometry);
+			candidates.push_back(elements[i]);
+			boxes.push_back(box ? expand(*box, eps) : box);
+			bool near = !box;
+			for (auto r = regions.begin(); !near && r != regions.end(); ++r) {
+				near = CGAL::do_overlap(*r, *boxes.back());
+			}
+			keep.push_back(near);
+		}
+	}
+
+	auto overlaps_kept = [&](size_t i, element_type type) -> bool {
+		for (size_t j = 0; j < candidates.size(); ++j) {
+			if (keep[j] &&
+				candidates[j]->type == type &&
+				boxes[j] &&
+				CGAL::do_overlap(*boxes[i], *boxes[j]))
+			{
+				return true;
+			}
+		}
+		return false;
+	};
+
+	// Walls have columns subtracted from them, and columns have slabs
+	// subtracted from them, so the kept set has to be closed in that order.
+	for (size_t i = 0; i < candidates.size(); ++i) {
+		if (!keep[i] && candidates[i]->type == COLUMN && overlaps_kept(i, WALL)) {
+			keep[i] = true;
+		}
+	}
+	for (size_t i = 0; i < candidates.size(); ++i) {
+		if (!keep[i] && candidates[i]->type == SLAB && overlaps_kept(i, COLUMN)) {
+			keep[i] = true;
+		}
+	}
+
+	std::vector<element_info *> res;
+	for (size_t i = 0; i < candidates.size(); ++i) {
+		if (keep[i]) { res.push_back(candidates[i]); }
+	}
+	return res;
+}
+
+} // namespace region_of_interest
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "precompiled.h"
+
+#include "guid_filter.h"
+
+struct element_info;
+struct space_info;
+
+namespace region_of_interest {
+
+// Returns the elements (that pass the filter) that could possibly contribute
+// to the space boundaries of the specified spaces: everything whose bounding
+// box comes within max_distance of one of the spaces' bounding boxes, plus
+// the elements that the resolution step in load_elements would subtract from
+// those. Because the resolution step never changes the geometry of anything
+// that isn't kept, loading only the returned elements yields the same space
+// boundaries for these spaces as loading all of them. All bounding boxes are
+// calculated directly from the interface structures so that culled elements
+// never touch exact arithmetic.
+std::vector<element_info *> cull_elements(
+	element_info ** elements,
+	size_t element_count,
+	const std::vector<space_info *> & spaces,
+	const guid_filter & filter,
+	double max_distance,
+	double eps);
+
+} // namespace region_of_interest
@@ -8,10 +8,14 @@
 #include "geometry_common.h"
 #include "guid_filter.h"
 #include "identify_transmission.h"
+#include "input_snapshot.h"
 #include "load_elements.h"
 #include "load_spaces.h"
+#include "platform.h"
+#include "region_of_interest.h"
 #include "report.h"
 #include "space.h"
+#include "statistics.h"
 #include "surface.h"
 #include "transmission_information.h"
 
@@ -35,27 +39,6 @@ namespace {
 
 void do_nothing(char * /*msg*/) { }
 
-void exception_translator(unsigned int code, struct _EXCEPTION_POINTERS *) {
-	if (code == EXCEPTION_STACK_OVERFLOW) {
-		// don't call _resetskoflow() here yet - the stack isn't unwound. or something.
-		throw stack_overflow_exception();
-	}
-	else {
-		throw sbt_exception();
-	}
-}
-
-class translator_setter {
-public:
-	typedef void (*translator_t)(unsigned int, struct _EXCEPTION_POINTERS *);
-	translator_setter(translator_t translator)
-		: old_(_set_se_translator(translator))
-	{ }
-	~translator_setter() { _set_se_translator(old_); }
-private:
-	translator_t old_;
-};
-
 } // namespace
 
 sbt_return_t calculate_space_boundaries(
@@ -84,9 +67,11 @@ sbt_return_t calculate_space_boundaries(
 
 	sbt_return_t retval;
 
-	translator_setter translate(&exception_translator);
+	platform::hardware_exception_scope translate;
+	statistics::reset();
 
 	try {
+		statistics::phase_timer total_timer("total");
 		report_progress(
 			fmt("Beginning processing for %u building elements.\n") 
 			% element_count);
@@ -96,41 +81,83 @@ sbt_return_t calculate_space_boundaries(
 			g_opts.max_pair_distance_in_meters *
 			g_opts.length_units_per_meter;
 
-		std::vector<element> elements = load_elements(
-			element_infos, 
-			element_count, 
-			&ctxt, 
-			element_filter);
-		std::vector<space> spaces = load_spaces(
-			space_infos, 
-			space_count, 
-			&ctxt, 
-			space_filter);
-		std::vector<block> blocks = blocking::build_blocks(
-			elements,
-			&ctxt, 
-			height_cutoff);
-		std::vector<transmission_information> t_info = 
-			traversal::identify_transmission(
+		// The elements are loaded before the spaces, because the order in
+		// which geometry goes into the equality context affects how it's
+		// snapped. Region-of-interest culling works from the interface
+		// structures of the spaces that pass the filter, so it doesn't need
+		// them loaded first.
+		std::vector<element_info *> roi_infos;
+		if (g_opts.flags & SBT_REGION_OF_INTEREST) {
+			std::vector<space_info *> selected_spaces;
+			std::copy_if(
+				space_infos, 
+				space_infos + space_count, 
+				std::back_inserter(selected_spaces),
+				[&space_filter](space_info * s) { return space_filter(s->id); });
+			roi_infos = region_of_interest::cull_elements(
+				element_infos,
+				element_count,
+				selected_spaces,
+				element_filter,
+				height_cutoff,
+				g_opts.tolernace_in_meters * g_opts.length_units_per_meter);
+			report_progress(fmt(
+				"Region of interest: culled %u of %u building elements.\n")
+				% (element_count - roi_infos.size()) % element_count);
+			element_infos = roi_infos.empty() ? nullptr : &roi_infos.front();
+			element_count = roi_infos.size();
+		}
+
+		std::vector<element> elements;
+		{
+			statistics::phase_timer timer("loading elements");
+			elements = load_elements(
+				element_infos, 
+				element_count, 
+				&ctxt, 
+				element_filter);
+		}
+		std::vector<space> spaces;
+		{
+			statistics::phase_timer timer("loading spaces");
+			spaces = load_spaces(space_infos, space_count, &ctxt, space_filter);
+		}
+		std::vector<block> blocks;
+		{
+			statistics::phase_timer timer("building blocks");
+			blocks = blocking::build_blocks(&elements, &ctxt, height_cutoff);
+		}
+		std::vector<transmission_information> t_info;
+		{
+			statistics::phase_timer timer("identifying transmission");
+			t_info = traversal::identify_transmission(
 				blocks, 
-				spaces, 
+				&spaces, 
 				height_cutoff, 
 				&ctxt);
+		}
 
 		std::vector<std::unique_ptr<surface>> surfaces;
-		boost::for_each(t_info, [&](const transmission_information & ti) { 
-			ti.to_surfaces(std::back_inserter(surfaces)); 
-		});
-
-		auto opening_blocks = 
-			blocks | boost::adaptors::filtered([](const block & b) { 
-				return b.is_fenestration(); 
+		{
+			statistics::phase_timer timer("creating surfaces");
+			boost::for_each(t_info, [&](const transmission_information & ti) { 
+				ti.to_surfaces(std::back_inserter(surfaces)); 
 			});
-		opening_assignment::assign_openings(
-			&surfaces, 
-			opening_blocks, 
-			g_opts.length_units_per_meter / 3);
-
+		}
+
+		{
+			statistics::phase_timer timer("assigning openings");
+			auto opening_blocks = 
+				blocks | boost::adaptors::filtered([](const block & b) { 
+					return b.is_fenestration(); 
+				});
+			opening_assignment::assign_openings(
+				&surfaces, 
+				opening_blocks, 
+				g_opts.length_units_per_meter / 3);
+		}
+
+		statistics::phase_timer timer("converting to interface structures");
 		report_progress(
 			"Converting internal structures to interface structures");
 		retval = interface_conversion::convert_to_space_boundaries(
@@ -145,7 +172,7 @@ sbt_return_t calculate_space_boundaries(
 	}
 
 	if (retval == SBT_STACK_OVERFLOW) {
-		_resetstkoflw();
+		platform::recover_from_stack_overflow();
 	}
 
 	return retval;
@@ -172,4 +199,54 @@ sb_calculation_options create_default_options() {
 	opts.warn_func = nullptr;
 	opts.error_func = nullptr;
 	return opts;
+}
+
+sbt_return_t write_input_snapshot(
+	char * filename,
+	size_t element_count,
+	element_info ** elements,
+	size_t space_count,
+	space_info ** spaces,
+	sb_calculation_options opts)
+{
+	try {
+		input_snapshot::write(
+			filename, 
+			element_count, 
+			elements, 
+			space_count, 
+			spaces, 
+			opts);
+		return SBT_OK;
+	}
+	catch (sbt_exception & ex) {
+		return ex.code();
+	}
+}
+
+sbt_return_t load_input_snapshot(
+	char * filename, 
+	sbt_input_snapshot * snapshot) 
+{
+	try {
+		input_snapshot::load(filename, snapshot);
+		return SBT_OK;
+	}
+	catch (sbt_exception & ex) {
+		return ex.code();
+	}
+}
+
+void release_input_snapshot(sbt_input_snapshot * snapshot) {
+	input_snapshot::release(snapshot);
+}
+
+size_t get_statistics(sbt_statistic * stats, size_t max_count) {
+	auto all = statistics::all();
+	for (size_t i = 0; i < all.size() && i < max_count; ++i) {
+		strncpy(stats[i].name, all[i].first.c_str(), SBT_STATISTIC_NAME_MAX_LEN);
+		stats[i].name[SBT_STATISTIC_NAME_MAX_LEN] = '\0';
+		stats[i].value = all[i].second;
+	}
+	return all.size();
 }
\ No newline at end of file
@@ -56,6 +56,8 @@ enum sbt_return_t {
 	SBT_STACK_OVERFLOW = 1,
 	SBT_FAILED_ALLOCATION = 2,
 	SBT_UNSUPPORTED = 3,
+	SBT_IO_ERROR = 4,
+	SBT_BAD_SNAPSHOT = 5,
 	SBT_UNKNOWN = -1
 };
 
@@ -128,8 +130,34 @@ struct space_boundary {
 	double * thicknesses;
 };
 
+// SBT_REGION_OF_INTEREST: Only load the building elements that could
+// contribute to the space boundaries of the spaces that pass the space
+// filter. This makes calculating them for a small part of a big building
+// much cheaper. Coordinates are snapped to the ones that are already loaded,
+// and the culled elements' coordinates aren't, so results can differ from a
+// full run by up to the tolerance.
+// SBT_RATIONAL_ORIENTATIONS: Flatten faces with rational rotations that
+// are within a billionth of a radian of the exact ones. The exact rotations
+// involve square roots, which make every coordinate and height computed
+// from them expensive. The results agree with the exact ones to well within
+// the tolerance.
+// SBT_PARALLEL_EXTRACTION: Have the IFC adapter extract the elements' and
+// spaces' geometry on all cores. The results are the same as extracting them
+// one at a time. Experimental: it's only safe if LEDA was built to be used
+// from several threads, so the adapter ignores it (with a warning) unless it
+// was built with SBT_THREAD_SAFE_LEDA defined.
+// SBT_APPROXIMATE_OUTPUT: Compute the output boundaries' 3D coordinates and
+// clean them in doubles, only falling back to exact arithmetic for
+// boundaries that degenerate. This avoids exact arithmetic for nearly every
+// boundary, but the output can differ from the exact output by rounding
+// error, and boundaries that are right at the output tolerance can be
+// cleaned differently.
 enum sb_options_flags {
-	SBT_NONE = 0
+	SBT_NONE = 0,
+	SBT_REGION_OF_INTEREST = 1,
+	SBT_RATIONAL_ORIENTATIONS = 2,
+	SBT_PARALLEL_EXTRACTION = 4,
+	SBT_APPROXIMATE_OUTPUT = 8
 };
 
 struct sb_calculation_options {
@@ -147,13 +175,42 @@ struct sb_calculation_options {
 	void (*error_func)(char *);
 };
 
-#ifdef SBT_CORE_EXPORTS
-#define SBT_CORE_INTERFACE dllexport
+// An input snapshot is a file containing everything that
+// calculate_space_boundaries needs except the message callbacks (see
+// input_snapshot.h for the format). Loading one is cheap: the vertex arrays
+// of the loaded elements and spaces point directly into a read-only mapping
+// of the file, so they must not be modified or freed. The options are
+// filled in from the snapshot with the callbacks set to NULL. Everything is
+// released at once with release_input_snapshot.
+struct sbt_input_snapshot {
+	size_t element_count;
+	struct element_info ** elements;
+	size_t space_count;
+	struct space_info ** spaces;
+	struct sb_calculation_options opts;
+	void * storage;
+};
+
+// Statistics (phase timings and counters) about the most recent call to
+// calculate_space_boundaries, for benchmarking.
+#define SBT_STATISTIC_NAME_MAX_LEN 63
+
+struct sbt_statistic {
+	char name[SBT_STATISTIC_NAME_MAX_LEN + 1];
+	double value;
+};
+
+// The core is a DLL on Windows and a static library everywhere else (and on
+// Windows too, if SBT_CORE_STATIC is defined).
+#if defined(SBT_CORE_STATIC) || !defined(_WIN32)
+#define SBT_CORE_API
+#elif defined(SBT_CORE_EXPORTS)
+#define SBT_CORE_API __declspec(dllexport)
 #else
-#define SBT_CORE_INTERFACE dllimport
+#define SBT_CORE_API __declspec(dllimport)
 #endif
 
-__declspec(SBT_CORE_INTERFACE)
+SBT_CORE_API
 enum sbt_return_t calculate_space_boundaries(
 	size_t element_count,						// in
 	struct element_info ** elements,			// in
@@ -163,12 +220,34 @@ enum sbt_return_t calculate_space_boundaries(
 	struct space_boundary *** space_boundaries,	// out
 	struct sb_calculation_options opts);		// in
 
-__declspec(SBT_CORE_INTERFACE)
+SBT_CORE_API
 void release_space_boundaries(struct space_boundary ** sbs, size_t count);
 
-__declspec(SBT_CORE_INTERFACE)
+SBT_CORE_API
 struct sb_calculation_options create_default_options(void);
 
+SBT_CORE_API
+enum sbt_return_t write_input_snapshot(
+	char * filename,							// in
+	size_t element_count,						// in
+	struct element_info ** elements,			// in
+	size_t space_count,							// in
+	struct space_info ** spaces,				// in
+	struct sb_calculation_options opts);		// in
+
+SBT_CORE_API
+enum sbt_return_t load_input_snapshot(
+	char * filename,							// in
+	struct sbt_input_snapshot * snapshot);		// out
+
+SBT_CORE_API
+void release_input_snapshot(struct sbt_input_snapshot * snapshot);
+
+// Copies up to max_count statistics into stats (which may be NULL if
+// max_count is 0) and returns the total number available.
+SBT_CORE_API
+size_t get_statistics(struct sbt_statistic * stats, size_t max_count);
+
 #undef SBT_INTERFACE
 
 #ifdef __cplusplus
@@ -81,6 +81,16 @@ simple_face::simple_face(
 
 }
 
+simple_face & simple_face::operator = (const simple_face & src) {
+	if (&src != this) {
+		m_outer = src.m_outer;
+		m_inners = src.m_inners;
+		m_plane = src.m_plane;
+		m_average_point = src.m_average_point;
+	}
+	return *this;
+}
+
 simple_face & simple_face::operator = (simple_face && src) {
 	if (&src != this) {
 		m_outer = std::move(src.m_outer); 
@@ -31,8 +31,10 @@ private:
 
 public:
 	simple_face(const face & f, bool force_planar, equality_context * c);
+	simple_face(const simple_face & src) { *this = src; }
 	simple_face(simple_face && src) { *this = std::move(src); }
 
+	simple_face & operator = (const simple_face & src);
 	simple_face & operator = (simple_face && src);
 
 	const loop & outer() const { return m_outer; }
@@ -5,6 +5,7 @@
 #include "poly_builder.h"
 #include "simple_face.h"
 #include "stringification.h"
+#include "vertex_welding.h"
 
 #include "solid_geometry_util.h"
 
@@ -18,7 +19,7 @@ std::vector<simple_face> reconcile_orientations(
 	const std::vector<simple_face> & all_faces, 
 	const std::vector<int> & group_memberships,
 	int group,
-	const std::vector<std::vector<face_relationship>> & relationships)
+	const std::vector<std::map<size_t, face_relationship>> & relationships)
 {
 	size_t root_ix = 0;
 	face_status root_status = OK;
@@ -35,9 +36,10 @@ std::vector<simple_face> reconcile_orientations(
 		process_queue.pop();
 		if (statuses[next_ix] == NOT_DECIDED) {
 			statuses[next_ix] = next_status;
-			for (size_t i = 0; i < relationships.size(); ++i) {
-				if (statuses[i] == NOT_DECIDED && relationships[next_ix][i] != NOT_CONNECTED) {
-					process_queue.push(std::make_tuple(i, (face_status)(relationships[next_ix][i] * next_status)));
+			auto & neighbors = relationships[next_ix];
+			for (auto n = neighbors.begin(); n != neighbors.end(); ++n) {
+				if (statuses[n->first] == NOT_DECIDED && n->second != NOT_CONNECTED) {
+					process_queue.push(std::make_tuple(n->first, (face_status)(n->second * next_status)));
 				}
 			}
 		}
@@ -56,34 +58,23 @@ std::vector<simple_face> reconcile_orientations(
 std::vector<std::vector<simple_face>> to_volume_groups(std::vector<simple_face> && all_faces) {
 	typedef size_t face_ix_t;
 
-	struct segment_comparator : public std::unary_function<segment_3, bool> {
-		bool operator () (const segment_3 & a, const segment_3 & b) const {
-			return a.source() == b.source() ? a.target() < b.target() : a.source() < b.source();
-		}
-	};
-
-	std::vector<std::vector<face_relationship>> relationships(all_faces.size(), std::vector<face_relationship>(all_faces.size(), NOT_CONNECTED));
+	// Only the faces that share an edge are related, so each face just keeps
+	// its neighbors (in index order, so that they're visited in that order).
+	std::vector<std::map<face_ix_t, face_relationship>> relationships(all_faces.size());
 
-	std::map<segment_3, face_ix_t, segment_comparator> edge_memberships;
+	vertex_welding::vertex_welder<point_3> vertices;
+	vertex_welding::edge_adjacency edges;
 
 	boost::adjacency_list<boost::vecS, boost::vecS, boost::undirectedS> graph;
 
 	for (size_t face_ix = 0; face_ix < all_faces.size(); ++face_ix) {
-		boost::for_each(all_faces[face_ix].all_edges_voids_reversed(), [&edge_memberships, &relationships, &graph, face_ix](const segment_3 & e) {
-			bool opposite = false;
-			auto exists = edge_memberships.find(e);
-			if (exists == edge_memberships.end()) {
-				exists = edge_memberships.find(e.opposite());
-				opposite = true;
-			}
-			if (exists != edge_memberships.end()) {
-				size_t match_ix = exists->second;
+		boost::for_each(all_faces[face_ix].all_edges_voids_reversed(), [&vertices, &edges, &relationships, &graph, face_ix](const segment_3 & e) {
+			face_ix_t match_ix;
+			bool opposite;
+			if (edges.share(vertices.weld(e.source()), vertices.weld(e.target()), face_ix, &match_ix, &opposite)) {
 				relationships[face_ix][match_ix] = relationships[match_ix][face_ix] = opposite ? MATCH : MISMATCH;
 				boost::add_edge(face_ix, match_ix, graph);
 			}
-			else {
-				edge_memberships.insert(std::make_pair(e, face_ix));
-			}
 		});
 	}
 	
@@ -214,33 +205,37 @@ nef_polyhedron_3 extrusion_to_nef(const extrusion_information & ext, equality_co
 }
 
 std::vector<simple_face> faces_from_brep(const brep & b, equality_context * c) {
-	using boost::copy;
-	std::set<point_3, geometry_common::point_3_cmp> inner_pts;
-	std::list<simple_face> res;
+	std::unordered_set<point_3, vertex_welding::point_hash<point_3>> inner_pts;
+	std::vector<simple_face> res;
 	for (size_t i = 0; i < b.face_count; ++i) {
 		try {
 			res.push_back(simple_face(b.faces[i], false, c));
 			const auto & voids = res.back().voids();
 			if (!voids.empty()) {
 				for (auto v = voids.begin(); v != voids.end(); ++v) {
-					copy(*v, std::inserter(inner_pts, inner_pts.begin()));
+					inner_pts.insert(v->begin(), v->end());
 				}
 				res.back() = res.back().without_voids();
 			}
-			res.remove_if([&inner_pts](const simple_face & f) -> bool {
-				for (auto p = inner_pts.begin(); p != inner_pts.end(); ++p) {
-					if (boost::find(f.outer(), *p) != f.outer().end()) {
-						return true;
-					}
-				}
-				return false;
-			});
 		}
 		catch (invalid_face_exception & /*ex*/) {
 			throw bad_brep_exception();
 		}
 	}
-	return std::vector<simple_face>(res.begin(), res.end());
+	// Faces touching any face's voids are dropped. The void points only
+	// accumulate, so doing this once at the end drops the same faces as doing
+	// it after every face would.
+	if (!inner_pts.empty()) {
+		res.erase(std::remove_if(res.begin(), res.end(), [&inner_pts](const simple_face & f) -> bool {
+			for (auto p = f.outer().begin(); p != f.outer().end(); ++p) {
+				if (inner_pts.count(*p) > 0) {
+					return true;
+				}
+			}
+			return false;
+		}), res.end());
+	}
+	return res;
 }
 
 nef_polyhedron_3 simple_faces_to_nef(
@@ -0,0 +1,55 @@
+#include "precompiled.h"
+
+#include "statistics.h"
+
+namespace statistics {
+
+namespace {
+
+std::vector<std::pair<std::string, double>> g_statistics;
+
+double & value_of(const char * name) {
+	for (auto s = g_statistics.begin(); s != g_statistics.end(); ++s) {
+		if (s->first == name) { return s->second; }
+	}
+	g_statistics.push_back(std::make_pair(std::string(name), 0.0));
+	return g_statistics.back().second;
+}
+
+// Function-local so that counters in other translation units can register
+// themselves during static initialization.
+std::vector<counter *> & registered_counters() {
+	static std::vector<counter *> counters;
+	return counters;
+}
+
+} // namespace
+
+counter::counter(const char * name) : n(name), val(0.0) {
+	registered_counters().push_back(this);
+}
+
+void reset() {
+	g_statistics.clear();
+	boost::for_each(registered_counters(), [](counter * c) { c->reset(); });
+}
+
+void add(const char * name, double amount) {
+	value_of(name) += amount;
+}
+
+void record_max(const char * name, double value) {
+	double & v = value_of(name);
+	if (value > v) { v = value; }
+}
+
+std::vector<std::pair<std::string, double>> all() {
+	auto res = g_statistics;
+	auto & counters = registered_counters();
+	for (auto c = counters.begin(); c != counters.end(); ++c) {
+		res.push_back(std::make_pair(std::string((*c)->name()), (*c)->value()));
+	}
+	return res;
+}
+
+} // namespace statistics
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "precompiled.h"
+
+#include "platform.h"
+
+// Named numbers (phase timings and counters) about the most recent call to
+// calculate_space_boundaries. They're exposed through get_statistics so that
+// benchmark drivers can see inside a run without parsing progress messages.
+// Statistics are reported in the order they were first recorded.
+
+namespace statistics {
+
+void reset();
+
+void add(const char * name, double amount);
+inline void increment(const char * name) { add(name, 1.0); }
+
+// Records the larger of the current and given values.
+void record_max(const char * name, double value);
+
+std::vector<std::pair<std::string, double>> all();
+
+// A statistic that is updated too often for a lookup by name each time.
+// Counters are meant to be namespace-scope statics; they're reset along with
+// everything else and reported after the named statistics.
+class counter {
+public:
+	explicit counter(const char * name);
+	void add(double amount) { val += amount; }
+	void increment() { val += 1.0; }
+	void record_max(double value) { if (value > val) { val = value; } }
+	const char * name() const { return n; }
+	double value() const { return val; }
+	void reset() { val = 0.0; }
+private:
+	const char * n;
+	double val;
+	counter(const counter &);
+	counter & operator = (const counter &);
+};
+
+// Adds the time between its construction and destruction to "time: <phase>",
+// and records the resident set size (in MiB) at the end of the phase as
+// "memory: <phase>".
+class phase_timer {
+public:
+	explicit phase_timer(const char * phase)
+		: phase(phase), start(platform::seconds_now())
+	{ }
+	~phase_timer() {
+		add(("time: " + phase).c_str(), platform::seconds_now() - start);
+		record_max(("memory: " + phase).c_str(), platform::current_resident_bytes() / (1024.0 * 1024.0));
+	}
+private:
+	std::string phase;
+	double start;
+	phase_timer(const phase_timer &);
+	phase_timer & operator = (const phase_timer &);
+};
+
+} // namespace statistics
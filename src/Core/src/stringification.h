@@ -14,7 +14,7 @@ std::string to_string(const vector_3 & v);
 template <typename StringifiableRange>
 std::string to_string(const StringifiableRange & points) {
 	std::stringstream ss;
-	boost::for_each(points, [&ss](const StringifiableRange::value_type & s) { ss << to_string(s) << std::endl; });
+	boost::for_each(points, [&ss](const typename StringifiableRange::value_type & s) { ss << to_string(s) << std::endl; });
 	return ss.str();
 }
 
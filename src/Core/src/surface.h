@@ -6,6 +6,7 @@
 #include "element.h"
 #include "equality_context.h"
 #include "layer_information.h"
+#include "layer_stack.h"
 #include "oriented_area.h"
 
 class space;
@@ -19,7 +20,7 @@ private:
 	const surface * m_other_side;
 	const surface * m_parent;
 	bool m_external;
-	std::vector<layer_information> m_layers;
+	layer_stack::ptr m_layers;
 
 	static std::string new_guid_as_string() {
 		char buf[24] = "ERROR CREATING GUID";
@@ -28,23 +29,27 @@ private:
 	}
 
 public:
+	surface(const oriented_area & geometry, const element & e, const space & bounded_space, const layer_stack::ptr & layers, bool external)
+		: m_guid(new_guid_as_string()), m_geometry(geometry), m_element(&e), m_space(bounded_space), m_other_side(nullptr), m_parent(nullptr), m_external(external), m_layers(layers) { }
+	surface(oriented_area && geometry, const element & e, const space & bounded_space, const layer_stack::ptr & layers, bool external)
+		: m_guid(new_guid_as_string()), m_geometry(std::move(geometry)), m_element(&e), m_space(bounded_space), m_other_side(nullptr), m_parent(nullptr), m_external(external), m_layers(layers) { }
 	template <typename LayerRange>
 	surface(const oriented_area & geometry, const element & e, const space & bounded_space, const LayerRange & layers, bool external)
-		: m_guid(new_guid_as_string()), m_geometry(geometry), m_element(&e), m_space(bounded_space), m_other_side(nullptr), m_parent(nullptr), m_external(external), m_layers(layers.begin(), layers.end()) { }
+		: m_guid(new_guid_as_string()), m_geometry(geometry), m_element(&e), m_space(bounded_space), m_other_side(nullptr), m_parent(nullptr), m_external(external), m_layers(layer_stack::intern(layers)) { }
 	template <typename LayerRange>
 	surface(oriented_area && geometry, const element & e, const space & bounded_space, const LayerRange & layers, bool external)
-		: m_guid(new_guid_as_string()), m_geometry(std::move(geometry)), m_element(&e), m_space(bounded_space), m_other_side(nullptr), m_parent(nullptr), m_external(external), m_layers(layers.begin(), layers.end()) { }
+		: m_guid(new_guid_as_string()), m_geometry(std::move(geometry)), m_element(&e), m_space(bounded_space), m_other_side(nullptr), m_parent(nullptr), m_external(external), m_layers(layer_stack::intern(layers)) { }
 	// for virtuals
 	surface(const oriented_area & geometry, const space & bounded_space)
-		: m_guid(new_guid_as_string()), m_geometry(geometry), m_element(nullptr), m_space(bounded_space), m_other_side(nullptr), m_parent(nullptr), m_external(false) { }
+		: m_guid(new_guid_as_string()), m_geometry(geometry), m_element(nullptr), m_space(bounded_space), m_other_side(nullptr), m_parent(nullptr), m_external(false), m_layers(layer_stack::intern(std::vector<layer_information>())) { }
 	surface(oriented_area && geometry, const space & bounded_space)
-		: m_guid(new_guid_as_string()), m_geometry(geometry), m_element(nullptr), m_space(bounded_space), m_other_side(nullptr), m_parent(nullptr), m_external(false) { }
+		: m_guid(new_guid_as_string()), m_geometry(geometry), m_element(nullptr), m_space(bounded_space), m_other_side(nullptr), m_parent(nullptr), m_external(false), m_layers(layer_stack::intern(std::vector<layer_information>())) { }
 
 	const std::string & guid() const { return m_guid; }
 	const oriented_area & geometry() const { return m_geometry; }
 	const space & bounded_space() const { return m_space; }
 	const element * bounded_element() const { return m_element; }
-	const std::vector<layer_information> & material_layers() const { return m_layers; }
+	const layer_stack & material_layers() const { return *m_layers; }
 	const surface * other_side() const { return m_other_side; }
 	const surface * parent() const { return m_parent; }
 
@@ -4,6 +4,7 @@
 
 #include "area.h"
 #include "layer_information.h"
+#include "layer_stack.h"
 #include "surface.h"
 
 class orientation;
@@ -14,7 +15,7 @@ private:
 	area a_;
 	const orientation * o_;
 	bool base_sense_;
-	std::vector<layer_information> layers_;
+	layer_stack::ptr layers_;
 	const space * start_space_;
 	const space * end_space_;
 	NT start_height_;
@@ -36,14 +37,14 @@ public:
 		: a_(a),
 		  o_(o),
 		  base_sense_(base_sense),
-		  layers_(layers.begin(), layers.end()),
+		  layers_(layer_stack::intern(layers)),
 		  start_space_(start_space),
 		  end_space_(end_space),
 		  start_height_(start_height),
 		  end_height_(end_height),
 		  external_(external)
 	{ 
-		assert(layers_.size() > 0 || end_space != nullptr);
+		assert(layers_->size() > 0 || end_space != nullptr);
 	}
 
 	const area & common_area() const { return a_; }
@@ -55,13 +56,20 @@ public:
 		oriented_area start_geom(o_, start_height_, a_, base_sense_);
 		std::vector<oriented_area> pieces;
 		start_geom.to_pieces(std::back_inserter(pieces));
+		// The far side of a transmitting boundary is split the same way. The
+		// decomposition is kept with the area, so this reuses it.
+		std::vector<oriented_area> end_pieces;
+		if (end_space_ != nullptr && !layers_->empty()) {
+			oriented_area end_geom(o_, *end_height_, a_, !base_sense_);
+			end_geom.to_pieces(std::back_inserter(end_pieces));
+		}
 		for (auto p = pieces.begin(); p != pieces.end(); ++p) {
 			if (end_space_ == nullptr) {
-				if (layers_.back().has_both_sides()) {
+				if (layers_->back().has_both_sides()) {
 					// external or non-transmitting due to thickness
 					*oi++ = surf_ptr(new surface(
 						*p, 
-						layers_.front().layer_element(),
+						layers_->front().layer_element(),
 						*start_space_,
 						layers_,
 						external_));
@@ -70,13 +78,13 @@ public:
 					// non-transmitting due to halfblock
 					*oi++ = surf_ptr(new surface(
 						*p,
-						layers_.front().layer_element(),
+						layers_->front().layer_element(),
 						*start_space_,
-						std::vector<layer_information>(),
+						layer_stack::intern(std::vector<layer_information>()),
 						false));
 				}
 			}
-			else if (layers_.empty()) {
+			else if (layers_->empty()) {
 				// virtual
 				surf_ptr surf1(new surface(*p, *start_space_));
 				surf_ptr surf2(new surface(p->reverse(), *end_space_));
@@ -88,15 +96,15 @@ public:
 				// transmitting internal
 				surf_ptr surf1(new surface(
 					*p,
-					layers_.front().layer_element(),
+					layers_->front().layer_element(),
 					*start_space_,
 					layers_,
 					false));
 				surf_ptr surf2(new surface(
-					oriented_area(o_, *end_height_, p->area_2d(), !base_sense_),
-					layers_.back().layer_element(),
+					end_pieces[p - pieces.begin()],
+					layers_->back().layer_element(),
 					*end_space_,
-					layers_ | boost::adaptors::reversed,
+					layers_->reversed(),
 					false));
 				surface::set_other_sides(surf1, surf2);
 				*oi++ = std::move(surf1);
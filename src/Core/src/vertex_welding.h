@@ -0,0 +1,103 @@
+#pragma once
+
+// This header doesn't include the precompiled header (and only depends on
+// CGAL) so that the IFC adapter can weld its shells with it too.
+
+#include <CGAL/basic.h>
+
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Turning a pile of face loops into a solid means finding which loop points
+// are the same vertex and which loops share an edge. Doing that with a
+// linear scan or an ordered map of exact points costs a lot of exact
+// comparisons; hashing the points finds them with (usually) one.
+//
+// The points must be snapped, because the hash uses the coordinates' double
+// approximations: snapped coordinates are doubles to begin with, so equal
+// points always hash alike. (Equality itself is still decided exactly.)
+
+namespace vertex_welding {
+
+template <typename PointT>
+struct point_hash : public std::unary_function<PointT, size_t> {
+	size_t operator () (const PointT & p) const {
+		size_t res = coordinate_hash(p.x());
+		res = res * 31 + coordinate_hash(p.y());
+		res = res * 31 + coordinate_hash(p.z());
+		return res;
+	}
+
+private:
+	template <typename NT>
+	static size_t coordinate_hash(const NT & n) {
+		double d = CGAL::to_double(n);
+		// -0.0 == 0.0, but they don't hash alike.
+		return std::hash<double>()(d == 0.0 ? 0.0 : d);
+	}
+};
+
+// Gives each distinct point an index, in the order the points are first seen.
+template <typename PointT>
+class vertex_welder {
+public:
+	vertex_welder() { }
+
+	size_t weld(const PointT & p) {
+		auto res = indices_.insert(std::make_pair(p, points_.size()));
+		if (res.second) { points_.push_back(p); }
+		return res.first->second;
+	}
+
+	bool contains(const PointT & p) const { return indices_.find(p) != indices_.end(); }
+
+	const std::vector<PointT> & points() const { return points_; }
+
+private:
+	std::unordered_map<PointT, size_t, point_hash<PointT>> indices_;
+	std::vector<PointT> points_;
+
+	vertex_welder(const vertex_welder & disabled);
+	vertex_welder & operator = (const vertex_welder & disabled);
+};
+
+// Which face each directed edge between welded vertices was first seen on.
+class edge_adjacency {
+public:
+	edge_adjacency() { }
+
+	// Finds the face that already has the edge from a to b or, failing that,
+	// the one that has it from b to a. If there's neither, the edge is
+	// recorded as face f's and false is returned.
+	bool share(size_t a, size_t b, size_t f, size_t * other, bool * opposite) {
+		auto exists = faces_.find(edge(a, b));
+		*opposite = exists == faces_.end();
+		if (*opposite) {
+			exists = faces_.find(edge(b, a));
+		}
+		if (exists != faces_.end()) {
+			*other = exists->second;
+			return true;
+		}
+		faces_.insert(std::make_pair(edge(a, b), f));
+		return false;
+	}
+
+private:
+	typedef std::pair<size_t, size_t> edge;
+
+	struct edge_hash : public std::unary_function<edge, size_t> {
+		size_t operator () (const edge & e) const {
+			return std::hash<size_t>()(e.first) * 31 + std::hash<size_t>()(e.second);
+		}
+	};
+
+	std::unordered_map<edge, size_t, edge_hash> faces_;
+
+	edge_adjacency(const edge_adjacency & disabled);
+	edge_adjacency & operator = (const edge_adjacency & disabled);
+};
+
+} // namespace vertex_welding
@@ -1,9 +1,11 @@
 #include "precompiled.h"
 
+#include "convex_decomposition.h"
 #include "equality_context.h"
 #include "geometry_common.h"
 #include "nef_polygon_face.h"
 #include "nef_polygon_util.h"
+#include "statistics.h"
 
 #include "wrapped_nef_polygon.h"
 
@@ -11,18 +13,53 @@ namespace geometry_2d {
 
 namespace nef_polygons {
 
+namespace {
+
+// Operation results with more vertices than this are cleaned right away, so
+// that noise doesn't pile up across a long chain of operations. The count
+// includes the vertices of the infinite frame, which is fine for a bound.
+const size_t DEFERRED_CLEANING_VERTEX_LIMIT = 256;
+
+// Deferred results are counted when they're created and uncounted when
+// they're cleaned (once, however many copies there are), so this is the
+// number of clean passes that were avoided.
+statistics::counter g_clean_passes_avoided("nef clean: passes avoided");
+
+} // namespace
+
 wrapped_nef_polygon::wrapped_nef_polygon(const face & f) {
 	auto pwh = f.to_pwh();
 	if (pwh) {
 		*this = wrapped_nef_polygon(pwh->all_polygons());
 	}
 	else {
-		wrapped = std::unique_ptr<nef_polygon_2>(new nef_polygon_2(nef_polygon_2::EMPTY));
+		rewrap(nef_polygon_2(nef_polygon_2::EMPTY));
+	}
+}
+
+// Cleaning doesn't change anything that can be seen without looking at the
+// contents first, so it's done in place for every copy at once. A cached
+// bounding box is deliberately kept (see the class comment).
+void wrapped_nef_polygon::ensure_clean() const {
+	if (!wrapped || !wrapped->needs_cleaning) { return; }
+	g_clean_passes_avoided.add(-1);
+	wrapped->nef = util::clean(wrapped->nef);
+	wrapped->needs_cleaning = false;
+}
+
+void wrapped_nef_polygon::set_operation_result(nef_polygon_2 && raw) {
+	if (raw.explorer().number_of_vertices() > DEFERRED_CLEANING_VERTEX_LIMIT) {
+		rewrap(util::clean(raw));
+	}
+	else {
+		rewrap(std::move(raw), true);
+		g_clean_passes_avoided.increment();
 	}
 }
 
 std::vector<face> wrapped_nef_polygon::get_faces() const {
-	current_explorer = wrapped->explorer();
+	ensure_clean();
+	current_explorer = nef().explorer();
 	std::vector<face> res;
 	for (auto f = current_explorer->faces_begin(); f != current_explorer->faces_end(); ++f) {
 		if (f->mark()) {
@@ -33,7 +70,8 @@ std::vector<face> wrapped_nef_polygon::get_faces() const {
 }
 
 bool wrapped_nef_polygon::any_points_satisfy_predicate(const std::function<bool(point_2)> & pred) const {
-	auto e = wrapped->explorer();
+	ensure_clean();
+	auto e = nef().explorer();
 	for (auto v = e.vertices_begin(); v != e.vertices_end(); ++v) {
 		// don't check marks - points are never marked
 		if (e.is_standard(v)) {
@@ -46,24 +84,52 @@ bool wrapped_nef_polygon::any_points_satisfy_predicate(const std::function<bool(
 	return false;
 }
 
+const wrapped_nef_polygon::summary & wrapped_nef_polygon::get_summary() const {
+	ensure_clean();
+	if (!cached_summary) {
+		summary res;
+		res.is_empty = true;
+		res.face_count = 0;
+		res.vertex_count = 0;
+		if (wrapped) {
+			res.face_count = get_faces().size();
+			res.is_empty = nef().is_empty() || res.face_count == 0;
+			res.vertex_count = util::vertex_count(nef());
+		}
+		cached_summary = res;
+	}
+	return *cached_summary;
+}
+
+bool wrapped_nef_polygon::is_empty_without_cleaning() const {
+	if (cached_summary) { return cached_summary->is_empty; }
+	return !wrapped || nef().is_empty();
+}
+
 bbox_2 wrapped_nef_polygon::bbox() const {
-	boost::optional<bbox_2> res;
-	auto e = wrapped->explorer();
-	for (auto v = e.vertices_begin(); v != e.vertices_end(); ++v) {
-		// don't check marks - points are never marked
-		if (e.is_standard(v)) {
-			if (!res) { res = e.point(v).bbox(); }
-			else { res = *res + e.point(v).bbox(); }
+	if (!cached_bbox) {
+		boost::optional<bbox_2> res;
+		if (wrapped) {
+			auto e = nef().explorer();
+			for (auto v = e.vertices_begin(); v != e.vertices_end(); ++v) {
+				// don't check marks - points are never marked
+				if (e.is_standard(v)) {
+					if (!res) { res = e.point(v).bbox(); }
+					else { res = *res + e.point(v).bbox(); }
+				}
+			}
 		}
+		cached_bbox = res ? *res : bbox_2(0, 0, 0, 0);
 	}
-	return res ? *res : bbox_2(0, 0, 0, 0);
+	return *cached_bbox;
 }
 
 bool wrapped_nef_polygon::is_valid(const equality_context & c) const {
 	using geometry_common::smallest_squared_distance;
+	ensure_clean();
 	if (is_empty()) { return true; }
-	else if (*wrapped != wrapped->interior()) { return false; }
-	auto e = wrapped->explorer();
+	else if (nef() != nef().interior()) { return false; }
+	auto e = nef().explorer();
 	std::vector<point_2> points;
 	for (auto v = e.vertices_begin(); v != e.vertices_end(); ++v) {
 		// don't check marks - points are never marked
@@ -93,8 +159,12 @@ std::vector<polygon_2> wrapped_nef_polygon::to_simple_convex_pieces() const {
 	else if (faces.size() == 1) {
 		boost::optional<polygon_2> outer = faces.front().to_simple_polygon();
 		if (outer && outer->is_convex()) { return std::vector<polygon_2>(1, *outer); }
+		if (outer) {
+			auto pieces = convex_decomposition::decompose(*outer);
+			if (pieces) { return *pieces; }
+		}
 
-		auto e = wrapped->explorer();
+		auto e = nef().explorer();
 		std::set<NT> xcoords;
 		for (auto v = e.vertices_begin(); v != e.vertices_end(); ++v) {
 			if (e.is_standard(v)) {
@@ -119,7 +189,7 @@ std::vector<polygon_2> wrapped_nef_polygon::to_simple_convex_pieces() const {
 		}
 
 		boost::for_each(sections, [&res, this](const nef_polygon_2 & section) {
-			nef_polygon_2 intr = section * *wrapped;
+			nef_polygon_2 intr = section * nef();
 			nef_polygon_2::Explorer new_e = intr.explorer();
 			for (auto f = new_e.faces_begin(); f != new_e.faces_end(); ++f) {
 				if (f->mark()) {
@@ -143,11 +213,15 @@ std::vector<polygon_with_holes_2> wrapped_nef_polygon::to_pwhs() const {
 }
 
 NT wrapped_nef_polygon::outer_regular_area() const {
-	NT res = 0.0;
-	boost::for_each(get_faces(), [&res](const face & f) {
-		res += f.outer_regular_area();
-	});
-	return res;
+	const summary & s = get_summary();
+	if (!s.outer_regular_area) {
+		NT res = 0.0;
+		boost::for_each(get_faces(), [&res](const face & f) {
+			res += f.outer_regular_area();
+		});
+		cached_summary->outer_regular_area = res;
+	}
+	return *s.outer_regular_area;
 }
 
 wrapped_nef_polygon wrapped_nef_polygon::update_all(
@@ -174,26 +248,26 @@ wrapped_nef_polygon wrapped_nef_polygon::update_all(
 }
 
 void wrapped_nef_polygon::clear() {
-	wrapped->clear();
+	rewrap(nef_polygon_2(nef_polygon_2::EMPTY));
 }
 
 wrapped_nef_polygon & wrapped_nef_polygon::operator += (const wrapped_nef_polygon & other) {
-	*wrapped = util::clean(*wrapped += other.wrapped->interior());
+	set_operation_result(nef() + other.nef().interior());
 	return *this;
 }
 
 wrapped_nef_polygon & wrapped_nef_polygon::operator *= (const wrapped_nef_polygon & other) {
-	*wrapped = util::clean(*wrapped *= other.wrapped->interior());
+	set_operation_result(nef() * other.nef().interior());
 	return *this;
 }
 
 wrapped_nef_polygon & wrapped_nef_polygon::operator -= (const wrapped_nef_polygon & other) {
-	*wrapped = util::clean(*wrapped -= other.wrapped->interior());
+	set_operation_result(nef() - other.nef().interior());
 	return *this;
 }
 
 wrapped_nef_polygon & wrapped_nef_polygon::operator ^= (const wrapped_nef_polygon & other) {
-	*wrapped = util::clean(*wrapped ^= other.wrapped->interior());
+	set_operation_result(nef() ^ other.nef().interior());
 	return *this;
 }
 
@@ -11,13 +11,56 @@ namespace geometry_2d {
 
 namespace nef_polygons {
 
+// Copies share the wrapped Nef polygon, which is never modified except to
+// clean it; operations that change a wrapped_nef_polygon wrap a new one
+// instead.
+//
+// The results of boolean operations aren't cleaned (see util::clean) right
+// away, because they're often immediately combined with something else.
+// Instead they're cleaned when something looks at what's in them (their
+// faces, emptiness, vertices, etc.) or when they get big. A result is
+// cleaned in place, so cleaning it once cleans it for every copy.
+//
+// Bounding boxes don't require cleaning. A bounding box computed before the
+// polygon is cleaned is kept afterwards, by every copy, so it can be larger
+// than the cleaned polygon's; cleaning only ever shrinks it, and it's only
+// used for overlap tests.
 class wrapped_nef_polygon {
 private:
-	std::unique_ptr<nef_polygon_2> wrapped;
+	struct shared_nef {
+		nef_polygon_2 nef;
+		bool needs_cleaning;
+		shared_nef(nef_polygon_2 && nef, bool needs_cleaning)
+			: nef(std::move(nef)), needs_cleaning(needs_cleaning) { }
+	};
+
+	// The things that are asked about a Nef polygon over and over, each of
+	// which would otherwise mean exploring it. The summary is computed the
+	// first time it's needed after the wrapped Nef polygon changes.
+	struct summary {
+		bool is_empty;
+		size_t face_count;
+		size_t vertex_count;
+		boost::optional<NT> outer_regular_area; // computed separately because it's more expensive
+	};
+
+	std::shared_ptr<shared_nef> wrapped;
 	mutable boost::optional<nef_polygon_2::Explorer> current_explorer;
+	mutable boost::optional<summary> cached_summary;
+	mutable boost::optional<bbox_2> cached_bbox;
+
+	const nef_polygon_2 & nef() const { return wrapped->nef; }
+	const summary & get_summary() const;
+	void ensure_clean() const;
+	void rewrap(nef_polygon_2 && nef, bool needs_cleaning = false) {
+		wrapped = std::make_shared<shared_nef>(std::move(nef), needs_cleaning);
+		cached_summary = boost::none;
+		cached_bbox = boost::none;
+	}
+	void set_operation_result(nef_polygon_2 && raw);
 
 	explicit wrapped_nef_polygon(const nef_polygon_2 & nef)
-		: wrapped(new nef_polygon_2(util::clean(nef)))
+		: wrapped(std::make_shared<shared_nef>(util::clean(nef), false))
 	{ }
 
 	explicit wrapped_nef_polygon(const face & f);
@@ -26,23 +69,23 @@ private:
 
 public:
 	wrapped_nef_polygon() 
-		: wrapped(new nef_polygon_2(nef_polygon_2::EMPTY))
+		: wrapped(std::make_shared<shared_nef>(nef_polygon_2(nef_polygon_2::EMPTY), false))
 	{ }
 	
 	wrapped_nef_polygon(const wrapped_nef_polygon & src) { *this = src; }
 	wrapped_nef_polygon(wrapped_nef_polygon && src) { *this = std::move(src); }
 
 	explicit wrapped_nef_polygon(const polygon_2 & poly)
-		: wrapped(new nef_polygon_2(util::create_nef_polygon(poly)))
+		: wrapped(std::make_shared<shared_nef>(util::create_nef_polygon(poly), false))
 	{ }
 
 	template <typename PolyRange>
-	explicit wrapped_nef_polygon(const PolyRange & polys) 
-		: wrapped(new nef_polygon_2()) 
-	{
-		boost::for_each(polys, [this](const polygon_2 & poly) {
-			*wrapped ^= *wrapped_nef_polygon(poly).wrapped;
+	explicit wrapped_nef_polygon(const PolyRange & polys) {
+		std::vector<nef_polygon_2> nefs;
+		boost::for_each(polys, [&nefs](const polygon_2 & poly) {
+			nefs.push_back(util::create_nef_polygon(poly));
 		});
+		wrapped = std::make_shared<shared_nef>(util::symmetric_difference(std::move(nefs)), false);
 	}
 
 	explicit wrapped_nef_polygon(const std::vector<std::vector<point_2>> & loops) {
@@ -54,24 +97,36 @@ public:
 	}
 
 	wrapped_nef_polygon & operator = (const wrapped_nef_polygon & src) { 
-		if (&src != this) {
-			wrapped = std::unique_ptr<nef_polygon_2>(new nef_polygon_2(*src.wrapped));
+		if (&src != this) { 
+			wrapped = src.wrapped;
+			cached_summary = src.cached_summary;
+			cached_bbox = src.cached_bbox;
 		}
 		return *this; 
 	}
 	wrapped_nef_polygon & operator = (wrapped_nef_polygon && src) { 
-		if (&src != this) { wrapped = std::move(src.wrapped); }
+		if (&src != this) { 
+			wrapped = std::move(src.wrapped);
+			cached_summary = std::move(src.cached_summary);
+			cached_bbox = std::move(src.cached_bbox);
+			src.current_explorer = boost::none;
+			src.cached_summary = boost::none;
+			src.cached_bbox = boost::none;
+		}
 		return *this;
 	}
 	
 	bool								any_points_satisfy_predicate(const std::function<bool(point_2)> & pred) const;
 	bbox_2								bbox() const;
-	size_t								face_count() const { return get_faces().size(); }
-	bool								is_empty() const { return !wrapped || wrapped->is_empty() || get_faces().empty(); }
+	size_t								face_count() const { return get_summary().face_count; }
+	bool								is_empty() const { return get_summary().is_empty; }
+	// Like is_empty, but without cleaning: an uncleaned result that only
+	// becomes empty when it's cleaned counts as non-empty.
+	bool								is_empty_without_cleaning() const;
 	std::vector<polygon_2>				to_simple_convex_pieces() const;
 	std::string							to_string() const;
 	std::vector<polygon_with_holes_2>	to_pwhs() const;
-	size_t								vertex_count() const { return wrapped ? util::vertex_count(*wrapped) : 0; }
+	size_t								vertex_count() const { return get_summary().vertex_count; }
 	NT									outer_regular_area() const;
 	wrapped_nef_polygon					update_all(const std::function<point_2(point_2)> & updater) const;
 
@@ -96,27 +151,39 @@ public:
 };
 
 inline bool operator == (const wrapped_nef_polygon & lhs, const wrapped_nef_polygon & rhs) {
-	return *lhs.wrapped == *rhs.wrapped;
+	lhs.ensure_clean();
+	rhs.ensure_clean();
+	return lhs.nef() == rhs.nef();
 }
 
 inline bool operator != (const wrapped_nef_polygon & lhs, const wrapped_nef_polygon & rhs) {
-	return *lhs.wrapped != *rhs.wrapped;
+	lhs.ensure_clean();
+	rhs.ensure_clean();
+	return lhs.nef() != rhs.nef();
 }
 
 inline bool operator < (const wrapped_nef_polygon & lhs, const wrapped_nef_polygon & rhs) {
-	return *lhs.wrapped < *rhs.wrapped;
+	lhs.ensure_clean();
+	rhs.ensure_clean();
+	return lhs.nef() < rhs.nef();
 }
 
 inline bool operator > (const wrapped_nef_polygon & lhs, const wrapped_nef_polygon & rhs) {
-	return *lhs.wrapped > *rhs.wrapped;
+	lhs.ensure_clean();
+	rhs.ensure_clean();
+	return lhs.nef() > rhs.nef();
 }
 
 inline bool operator <= (const wrapped_nef_polygon & lhs, const wrapped_nef_polygon & rhs) {
-	return *lhs.wrapped <= *rhs.wrapped;
+	lhs.ensure_clean();
+	rhs.ensure_clean();
+	return lhs.nef() <= rhs.nef();
 }
 
 inline bool operator >= (const wrapped_nef_polygon & lhs, const wrapped_nef_polygon & rhs) {
-	return *lhs.wrapped >= *rhs.wrapped;
+	lhs.ensure_clean();
+	rhs.ensure_clean();
+	return lhs.nef() >= rhs.nef();
 }
 
 inline wrapped_nef_polygon operator + (
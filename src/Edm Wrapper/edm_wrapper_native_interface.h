@@ -4,7 +4,13 @@
 #include <string>
 #include <vector>
 
-#ifdef EDM_WRAPPER_EXPORTS
+// There are two implementations of this interface: the EDM wrapper, which
+// is a DLL, and the SPF wrapper (which reads IFC files itself), which is a
+// DLL on Windows and a static library everywhere else (and on Windows too,
+// if EDM_WRAPPER_STATIC is defined).
+#if defined(EDM_WRAPPER_STATIC) || !defined(_WIN32)
+#define EDM_WRAPPER_INTERFACE
+#elif defined(EDM_WRAPPER_EXPORTS)
 #define EDM_WRAPPER_INTERFACE __declspec(dllexport)
 #else
 #define EDM_WRAPPER_INTERFACE __declspec(dllimport)
@@ -17,7 +23,11 @@ class ifc_object;
 // Some of these functions return pointers. They'll be freed when whatever
 // model object they eventually descended from is freed. Alternatively, you
 // can free (and invalidate) them manually by calling 
-// model::invalidate_all_ownership_pointers.
+// model::invalidate_all_ownership_pointers, or by getting them inside an
+// ownership_scope.
+//
+// The functions that read objects (and model::take_ownership) can be called
+// from several threads at once. Nothing that changes a model can.
 
 EDM_WRAPPER_INTERFACE bool is_kind_of(
 	const ifc_object & obj, 
@@ -54,6 +64,10 @@ EDM_WRAPPER_INTERFACE bool triple_field(
 
 EDM_WRAPPER_INTERFACE bool as_real(const ifc_object & obj, double * res);
 
+// Sets *res to a number that identifies obj's instance for as long as its
+// model exists. Returns false if obj isn't an entity instance.
+EDM_WRAPPER_INTERFACE bool instance_id(const ifc_object & obj, size_t * res);
+
 EDM_WRAPPER_INTERFACE bool set_field(
 	ifc_object * obj,
 	const char * field_name,
@@ -76,6 +90,9 @@ public:
 
 	double length_units_per_meter() const;
 
+	// On failure, last_error() says why. (The SPF wrapper streams the output
+	// from the mapped input, so it can't replace the input file on Windows;
+	// it leaves the output next to it instead.)
 	void write(const std::string & path) const;
 	
 	ifc_object * create_curve(
@@ -104,4 +121,27 @@ private:
 	internals * d_;
 };
 
+// While one of these exists, the pointers that the functions above hand out
+// on the thread that created it (for objects of its model) belong to it
+// instead of to the model, and they're freed when it's destroyed. Scopes
+// nest; pointers belong to the innermost scope for their model. A wrapper
+// may keep longer-lived pointers to some objects (the SPF wrapper keeps one
+// per instance for as long as the model), so the only promise is that
+// pointers stay valid until the scope ends.
+class EDM_WRAPPER_INTERFACE ownership_scope {
+public:
+	explicit ownership_scope(model * m);
+	~ownership_scope();
+
+private:
+	struct internals;
+
+	internals * d_;
+
+	friend class model;
+
+	ownership_scope(const ownership_scope & disabled);
+	ownership_scope & operator = (const ownership_scope & disabled);
+};
+
 } // namespace ifc_interface
\ No newline at end of file
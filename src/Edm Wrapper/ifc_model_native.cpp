@@ -2,6 +2,8 @@
 #include <list>
 #include <map>
 
+#include <windows.h>
+
 #include <boost/optional.hpp>
 #include <boost/variant.hpp>
 
@@ -15,6 +17,49 @@
 
 namespace ifc_interface {
 
+namespace {
+
+struct critical_section {
+	CRITICAL_SECTION cs;
+	critical_section() { InitializeCriticalSection(&cs); }
+	~critical_section() { DeleteCriticalSection(&cs); }
+};
+
+critical_section g_edm_section;
+
+// The innermost ownership scope on each thread.
+struct scope_slot {
+	DWORD index;
+	scope_slot() : index(TlsAlloc()) { }
+	~scope_slot() { TlsFree(index); }
+};
+
+scope_slot g_current_scope;
+
+} // namespace
+
+void edm_lock::enter() { EnterCriticalSection(&g_edm_section.cs); }
+void edm_lock::leave() { LeaveCriticalSection(&g_edm_section.cs); }
+
+struct ownership_scope::internals {
+	model * m;
+	ownership_scope * outer;
+	std::list<ifc_object> objects;
+};
+
+ownership_scope::ownership_scope(model * m) : d_(new internals) {
+	d_->m = m;
+	d_->outer = static_cast<ownership_scope *>(TlsGetValue(g_current_scope.index));
+	TlsSetValue(g_current_scope.index, this);
+}
+
+ownership_scope::~ownership_scope() {
+	TlsSetValue(g_current_scope.index, d_->outer);
+	// Releasing the objects' EDM handles has to be serialized too.
+	edm_lock lock;
+	delete d_;
+}
+
 model::~model() { 
 	delete d_->m; 
 	delete d_;
@@ -53,7 +98,8 @@ double model::length_units_per_meter() const {
 }
 
 void model::write(const std::string & path) const {
-	cppw::Step_writer(d_->m->get_model(), path.c_str()).write();
+	try { cppw::Step_writer(d_->m->get_model(), path.c_str()).write(); }
+	catch (cppw::Error & e) { d_->last_error = e.message.data(); }
 }
 
 ifc_object * model::create_curve(
@@ -159,8 +205,12 @@ bool model::set_new_owner_history(
 }
 
 ifc_object * model::take_ownership(ifc_object && obj) {
-	d_->known_objects.push_back(obj);
-	return &d_->known_objects.back();
+	edm_lock lock;
+	auto scope = static_cast<ownership_scope *>(TlsGetValue(g_current_scope.index));
+	while (scope && scope->d_->m != this) { scope = scope->d_->outer; }
+	std::list<ifc_object> & owner = scope ? scope->d_->objects : d_->known_objects;
+	owner.push_back(obj);
+	return &owner.back();
 }
 
 } // namespace ifc_model
\ No newline at end of file
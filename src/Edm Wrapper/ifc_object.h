@@ -8,6 +8,21 @@ namespace ifc_interface {
 
 class model;
 
+// EDM can't be used from more than one thread at a time, so everything that
+// reads a model through the interface holds this while it does.
+class edm_lock {
+public:
+	edm_lock() { enter(); }
+	~edm_lock() { leave(); }
+
+private:
+	static void enter();
+	static void leave();
+
+	edm_lock(const edm_lock & disabled);
+	edm_lock & operator = (const edm_lock & disabled);
+};
+
 class ifc_object {
 public:
 	ifc_object(const cppw::Select & sel, model * m) : data_(sel), m_(m) { }
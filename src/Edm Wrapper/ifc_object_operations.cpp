@@ -7,12 +7,14 @@ using namespace cppw;
 namespace ifc_interface {
 
 bool is_kind_of(const ifc_object & obj, const char * type) {
+	edm_lock lock;
 	if (obj.data().get_primitive_type() != instance_type) { return false; }
 	try { return Instance(obj.data()).is_kind_of(type); }
 	catch (...) { return false; }
 }
 
 bool is_instance_of(const ifc_object & obj, const char * type) {
+	edm_lock lock;
 	if (obj.data().get_primitive_type() != instance_type) { return false; }
 	try { return Instance(obj.data()).is_instance_of(type); }
 	catch (...) { return false; }
@@ -23,6 +25,7 @@ bool boolean_field(
 	const char * field_name,
 	bool * res)
 {
+	edm_lock lock;
 	try { 
 		if (obj.data().get_primitive_type() != instance_type) { return false; }
 		Select sel = Instance(obj.data()).get(field_name);
@@ -38,6 +41,7 @@ bool collection_field(
 	const char * field_name,
 	std::vector<ifc_object *> * res)
 {
+	edm_lock lock;
 	try {
 		if (obj.data().get_primitive_type() != instance_type) { return false; }
 		Select sel = Instance(obj.data()).get(field_name);
@@ -58,6 +62,7 @@ bool object_field(
 	const char * field_name,
 	ifc_object ** res)
 {
+	edm_lock lock;
 	try {
 		if (obj.data().get_primitive_type() != instance_type) { return false; }
 		Select sel = Instance(obj.data()).get(field_name);
@@ -76,6 +81,7 @@ bool real_field(
 	const char * field_name, 
 	double * res) 
 {
+	edm_lock lock;
 	try {
 		if (obj.data().get_primitive_type() != instance_type) { return false; }
 		Select sel = Instance(obj.data()).get(field_name);
@@ -91,6 +97,7 @@ bool string_field(
 	const char * field_name,
 	std::string * res)
 {
+	edm_lock lock;
 	try {
 		if (obj.data().get_primitive_type() != instance_type) { return false; }
 		Select sel = Instance(obj.data()).get(field_name);
@@ -109,6 +116,7 @@ bool triple_field(
 	double * b,
 	double * c)
 {
+	edm_lock lock;
 	try {
 		if (obj.data().get_primitive_type() != instance_type) { return false; }
 		Select sel = Instance(obj.data()).get(field_name);
@@ -132,6 +140,7 @@ bool triple_field(
 }
 
 bool as_real(const ifc_object & obj, double * res) {
+	edm_lock lock;
 	try {
 		if (obj.data().get_primitive_type() != real_type) { return false; }
 		*res = (Real)obj.data();
@@ -139,12 +148,23 @@ bool as_real(const ifc_object & obj, double * res) {
 	}
 	catch (...) { return false; }
 }
+
+bool instance_id(const ifc_object & obj, size_t * res) {
+	edm_lock lock;
+	try {
+		if (obj.data().get_primitive_type() != instance_type) { return false; }
+		*res = Instance(obj.data()).get_id();
+		return true;
+	}
+	catch (...) { return false; }
+}
 	
 bool set_field(
 	ifc_object * obj,
 	const char * field_name,
 	const char * value)
 {
+	edm_lock lock;
 	try {
 		if (obj->data().get_primitive_type() != instance_type) { return false; }
 		Application_instance(obj->data()).put(field_name, value);
@@ -158,6 +178,7 @@ bool set_field(
 	const char * field_name,
 	const ifc_object & value)
 {
+	edm_lock lock;
 	try {
 		if (obj->data().get_primitive_type() != instance_type) { return false; }
 		Application_instance(obj->data()).put(field_name, value.data());
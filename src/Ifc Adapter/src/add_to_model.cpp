@@ -1,5 +1,7 @@
 #include "precompiled.h"
 
+#include <ppl.h>
+
 #include "../../Edm Wrapper/edm_wrapper_native_interface.h"
 
 #include "CreateGuid_64.h"
@@ -24,42 +26,34 @@ int get_level(const space_boundary & b) {
 		b.bounded_space == b.opposite->bounded_space ? 4 : 2;
 }
 
-ifc_object * create_point(
-	model * m,
-	const ipoint_3 & p,
-	const unit_scaler & scaler)
-{
-	double x = scaler.length_out(CGAL::to_double(p.x()));
-	double y = scaler.length_out(CGAL::to_double(p.y()));
-	double z = scaler.length_out(CGAL::to_double(p.z()));
-	return m->create_point(x, y, z);
-}
-
-ifc_object * create_direction(model * m, const idirection_3 & d) {
-	double dx = CGAL::to_double(d.dx());
-	double dy = CGAL::to_double(d.dy());
-	double dz = CGAL::to_double(d.dz());
-	return m->create_direction(dx, dy, dz);
-}
+// A boundary's plane and outline, in the bounded space's coordinates. None
+// of this involves the model, so it's worked out for all of the boundaries
+// at once.
+struct boundary_profile {
+	ipoint_3 origin;
+	idirection_3 axis;
+	idirection_3 ref_direction;
+	std::vector<ipoint_2> points;
+};
 
-ifc_object * create_a2p3d(
-	model * m,
-	const itransformation_3 & space_placement, 
-	space_boundary * sb, 
-	std::vector<ipoint_2> * points_2d, 
-	const unit_scaler & scaler) 
+boundary_profile flatten_boundary(
+	const space_boundary & sb,
+	const itransformation_3 & to_space)
 {
+	boundary_profile res;
+	std::vector<ipoint_2> * points_2d = &res.points;
+
 	auto ortho_dir = iplane_3(
-		from_c_point<iK>(sb->geometry.vertices[0]),
-		from_c_point<iK>(sb->geometry.vertices[1]),
-		from_c_point<iK>(sb->geometry.vertices[2])).orthogonal_direction();
+		from_c_point<iK>(sb.geometry.vertices[0]),
+		from_c_point<iK>(sb.geometry.vertices[1]),
+		from_c_point<iK>(sb.geometry.vertices[2])).orthogonal_direction();
 
 	auto flatten = build_flatten(ortho_dir);
 
 	double z = 0.0;
 	bool set_z = false;
-	for (size_t i = 0; i < sb->geometry.vertex_count; ++i) {
-		point p = sb->geometry.vertices[i];
+	for (size_t i = 0; i < sb.geometry.vertex_count; ++i) {
+		point p = sb.geometry.vertices[i];
 		auto p3flat = from_c_point<iK>(p).transform(flatten);
 		points_2d->push_back(ipoint_2(p3flat.x(), p3flat.y()));
 		if (!set_z) {
@@ -76,8 +70,8 @@ ifc_object * create_a2p3d(
 		flatten = build_flatten(ortho_dir);
 		points_2d->clear();
 		set_z = false;
-		for (size_t i = 0; i < sb->geometry.vertex_count; ++i) {
-			point p = sb->geometry.vertices[i];
+		for (size_t i = 0; i < sb.geometry.vertex_count; ++i) {
+			point p = sb.geometry.vertices[i];
 			auto p3flat = from_c_point<iK>(p).transform(flatten);
 			points_2d->push_back(ipoint_2(p3flat.x(), p3flat.y()));
 			if (!set_z) {
@@ -105,38 +99,85 @@ ifc_object * create_a2p3d(
 
 	auto unflatten = flatten.inverse();
 
-	ipoint_3 origin = 
-		ipoint_3(0, 0, z)
-		.transform(unflatten)
-		.transform(space_placement.inverse());
-	idirection_3 z_axis = 
-		idirection_3(0, 0, 1)
-		.transform(unflatten)
-		.transform(space_placement.inverse());
-	idirection_3 refdir = 
-		idirection_3(1, 0, 0)
-		.transform(unflatten)
-		.transform(space_placement.inverse());
-
-	auto res = m->create_object("IfcAxis2Placement3D", false);
-	set_field(res, "Location", *create_point(m, origin, scaler));
-	set_field(res, "Axis", *create_direction(m, z_axis));
-	set_field(res, "RefDirection", *create_direction(m, refdir));
+	res.origin = ipoint_3(0, 0, z).transform(unflatten).transform(to_space);
+	res.axis = idirection_3(0, 0, 1).transform(unflatten).transform(to_space);
+	res.ref_direction = idirection_3(1, 0, 0).transform(unflatten).transform(to_space);
 	return res;
 }
 
-ifc_object * create_plane(
-	model * m, 
-	const itransformation_3 & space_placement, 
-	space_boundary * sb, 
-	std::vector<ipoint_2> * points_2d, 
-	const unit_scaler & scaler) 
-{
-	auto plane = m->create_object("IfcPlane", false);
-	auto a2p3d = create_a2p3d(m, space_placement, sb, points_2d, scaler);
-	set_field(plane, "Position", *a2p3d);
-	return plane;
-}
+struct pending_boundary {
+	space_boundary * sb;
+	const ifc_object * space;
+	const ifc_object * element;
+	const itransformation_3 * to_space;
+	boundary_profile profile;
+	bool flattened;
+};
+
+// The new geometry instances that boundaries can share: points, directions,
+// and the planes of boundaries that lie in the same plane of the same space
+// (which is most of them, for spaces that are split up a lot). Each boundary
+// used to get its own.
+class shared_geometry {
+public:
+	shared_geometry(model * m, const unit_scaler & scaler) : m_(m), scaler_(scaler) { }
+
+	ifc_object * point(const ipoint_3 & p) {
+		triple key = {{
+			scaler_.length_out(CGAL::to_double(p.x())),
+			scaler_.length_out(CGAL::to_double(p.y())),
+			scaler_.length_out(CGAL::to_double(p.z()))
+		}};
+		ifc_object *& res = points_[key];
+		if (!res) { res = m_->create_point(key[0], key[1], key[2]); }
+		return res;
+	}
+
+	ifc_object * direction(const idirection_3 & d) {
+		triple key = {{
+			CGAL::to_double(d.dx()),
+			CGAL::to_double(d.dy()),
+			CGAL::to_double(d.dz())
+		}};
+		ifc_object *& res = directions_[key];
+		if (!res) { res = m_->create_direction(key[0], key[1], key[2]); }
+		return res;
+	}
+
+	ifc_object * plane(const boundary_profile & p) {
+		std::array<ifc_object *, 3> key = {{
+			point(p.origin),
+			direction(p.axis),
+			direction(p.ref_direction)
+		}};
+		ifc_object *& res = planes_[key];
+		if (!res) {
+			auto a2p3d = m_->create_object("IfcAxis2Placement3D", false);
+			set_field(a2p3d, "Location", *key[0]);
+			set_field(a2p3d, "Axis", *key[1]);
+			set_field(a2p3d, "RefDirection", *key[2]);
+			res = m_->create_object("IfcPlane", false);
+			set_field(res, "Position", *a2p3d);
+		}
+		return res;
+	}
+
+	size_t point_count() const { return points_.size(); }
+	size_t direction_count() const { return directions_.size(); }
+	size_t plane_count() const { return planes_.size(); }
+
+private:
+	typedef std::array<double, 3> triple;
+
+	model * m_;
+	const unit_scaler & scaler_;
+	std::map<triple, ifc_object *> points_;
+	std::map<triple, ifc_object *> directions_;
+	std::map<std::array<ifc_object *, 3>, ifc_object *> planes_;
+
+	shared_geometry(const shared_geometry & disabled);
+	shared_geometry & operator = (const shared_geometry & disabled);
+};
 
 ifc_object * create_curve(
 	model * m,
@@ -154,26 +195,24 @@ ifc_object * create_curve(
 
 ifc_object * create_boundary(
 	model * m, 
-	const itransformation_3 & space_placement, 
-	space_boundary * sb, 
+	const boundary_profile & profile,
+	shared_geometry * shared,
 	const unit_scaler & scaler) 
 {
 	auto res = m->create_object("IfcCurveBoundedPlane", false);
-	std::vector<ipoint_2> points_2d;
-	auto basis = create_plane(m, space_placement, sb, &points_2d, scaler);
-	set_field(res, "BasisSurface", *basis);
-	set_field(res, "OuterBoundary", *create_curve(m, points_2d, scaler));
+	set_field(res, "BasisSurface", *shared->plane(profile));
+	set_field(res, "OuterBoundary", *create_curve(m, profile.points, scaler));
 	return res;
 }
 
 ifc_object * create_geometry(
 	model * m, 
-	const itransformation_3 & space_placement, 
-	space_boundary * sb, 
+	const boundary_profile & profile,
+	shared_geometry * shared,
 	const unit_scaler & scaler) 
 {
 	auto res = m->create_object("IfcConnectionSurfaceGeometry", false);
-	auto boundary = create_boundary(m, space_placement, sb, scaler);
+	auto boundary = create_boundary(m, profile, shared, scaler);
 	set_field(res, "SurfaceOnRelatingElement", *boundary);
 	return res;
 }
@@ -183,13 +222,10 @@ ifc_object * create_sb(
 	const ifc_object & space,
 	const ifc_object & element,
 	space_boundary * sb,
-	const unit_scaler & scaler,
-	number_collection<iK> * c)
+	const boundary_profile & profile,
+	shared_geometry * shared,
+	const unit_scaler & scaler)
 {
-	ifc_object * space_trans;
-	object_field(space, "ObjectPlacement", &space_trans);
-	auto space_placement = build_transformation(space_trans, scaler, c);
-
 	auto res = m->create_object("IfcRelSpaceBoundary", true);
 
 	int level = get_level(*sb);
@@ -208,7 +244,7 @@ ifc_object * create_sb(
 	set_field(res, "PhysicalOrVirtualBoundary", virt_string);
 	auto ext_string = sb->is_external ? "EXTERNAL" : "INTERNAL";
 	set_field(res, "InternalOrExternalBoundary", ext_string);
-	auto geom = create_geometry(m, space_placement, sb, scaler);
+	auto geom = create_geometry(m, profile, shared, scaler);
 	set_field(res, "ConnectionGeometry", *geom);
 	return res;
 }
@@ -294,7 +330,9 @@ ifcadapter_return_t add_to_model(
 		string_field(**v, "GlobalId", &guid);
 		by_guid[guid] = *v;
 	}
-	int added_count = 0;
+	// Each space's placement, inverted.
+	std::map<const ifc_object *, itransformation_3> to_space;
+	std::vector<pending_boundary> pending;
 	for (size_t i = 0; i < sb_count; ++i) {
 		try {
 			// Space boundaries with no geometry shouldn't exist but I don't
@@ -304,7 +342,38 @@ ifcadapter_return_t add_to_model(
 				assert(sp != by_guid.end());
 				auto el = by_guid.find(sbs[i]->element_name);
 				assert(el != by_guid.end());
-				create_sb(m, *sp->second, *el->second, sbs[i], scaler, c);
+				auto t = to_space.find(sp->second);
+				if (t == to_space.end()) {
+					ifc_object * space_trans;
+					object_field(*sp->second, "ObjectPlacement", &space_trans);
+					auto space_placement = build_transformation(space_trans, scaler, c);
+					t = to_space.insert(std::make_pair(sp->second, space_placement.inverse())).first;
+				}
+				pending_boundary b;
+				b.sb = sbs[i];
+				b.space = sp->second;
+				b.element = el->second;
+				b.to_space = &t->second;
+				b.flattened = false;
+				pending.push_back(b);
+			}
+		}
+		catch (...) { }
+	}
+	// Flattening only uses doubles, so it can be done in parallel.
+	Concurrency::parallel_for((size_t)0, pending.size(), [&pending](size_t i) {
+		try {
+			pending[i].profile = flatten_boundary(*pending[i].sb, *pending[i].to_space);
+			pending[i].flattened = true;
+		}
+		catch (...) { }
+	});
+	shared_geometry shared(m, scaler);
+	int added_count = 0;
+	for (auto b = pending.begin(); b != pending.end(); ++b) {
+		try {
+			if (b->flattened) {
+				create_sb(m, *b->space, *b->element, b->sb, b->profile, &shared, scaler);
 				++added_count;
 				msg_func(".");
 			}
@@ -320,6 +389,19 @@ ifcadapter_return_t add_to_model(
 	char buf[256];
 	sprintf(buf, "Added %i space boundaries to the model.\n", added_count);
 	msg_func(buf);
+	sprintf(
+		buf,
+		"Placement cache: %u hits, %u misses.\n",
+		c->total_cache_counts().transformation_hits,
+		c->total_cache_counts().transformation_misses);
+	msg_func(buf);
+	sprintf(
+		buf,
+		"Shared geometry: %u points, %u directions, %u planes.\n",
+		(unsigned)shared.point_count(),
+		(unsigned)shared.direction_count(),
+		(unsigned)shared.plane_count());
+	msg_func(buf);
 
 	return IFCADAPT_OK;
 }
@@ -14,14 +14,12 @@ approximated_curve::approximated_curve(
 	  length_ratio_(length_ratio),
 	  area_(area_on_left)
 { 
-#ifndef NDEBUG
 	dp1_[0] = CGAL::to_double(p1.x());
 	dp1_[1] = CGAL::to_double(p1.y());
 	dp1_[2] = CGAL::to_double(p1.z());
 	dp2_[0] = CGAL::to_double(p2.x());
 	dp2_[1] = CGAL::to_double(p2.y());
 	dp2_[2] = CGAL::to_double(p2.z());
-#endif
 	assert(length_ratio >= 1.0);
 }
 
@@ -30,20 +28,76 @@ approximated_curve::match_type approximated_curve::matches(
 	double x2, double y2, double z2,
 	double eps) const
 {
-	// I am well aware that this process could be made vastly more efficient
-
-	auto close = [eps](const point_3 & p, double x, double y, double z) {
+	auto close = [eps](const double * p, double x, double y, double z) {
 		return
-			abs(CGAL::to_double(p.x()) - x) <= eps &&
-			abs(CGAL::to_double(p.y()) - y) <= eps &&
-			abs(CGAL::to_double(p.z()) - z) <= eps;
+			abs(p[0] - x) <= eps &&
+			abs(p[1] - y) <= eps &&
+			abs(p[2] - z) <= eps;
 	};
 
-	if (close(p1_, x1, y1, z1) && close(p2_, x2, y2, z2)) {
+	if (close(dp1_, x1, y1, z1) && close(dp2_, x2, y2, z2)) {
 		return FORWARD_MATCH;
 	}
-	else if (close(p2_, x1, y1, z1) && close(p1_, x2, y2, z2)) {
+	else if (close(dp2_, x1, y1, z1) && close(dp1_, x2, y2, z2)) {
 		return REVERSE_MATCH;
 	}
 	else { return NO_MATCH; }
+}
+
+approximated_curve_index::approximated_curve_index(
+	const std::vector<approximated_curve> & curves,
+	double eps)
+	: curves_(curves),
+	  eps_(eps),
+	  // Anything within eps of a point is at most half a cell away, so it's
+	  // in the point's cell or one next to it.
+	  cell_size_(eps > 0.0 ? 2 * eps : 1.0)
+{
+	for (size_t i = 0; i < curves.size(); ++i) {
+		cell a = cell_of(curves[i].start());
+		cell b = cell_of(curves[i].end());
+		by_cell_[a].push_back(i);
+		if (!(b == a)) { by_cell_[b].push_back(i); }
+	}
+}
+
+approximated_curve_index::cell approximated_curve_index::cell_of(const double * p) const {
+	cell c = {
+		(long long)floor(p[0] / cell_size_),
+		(long long)floor(p[1] / cell_size_),
+		(long long)floor(p[2] / cell_size_)
+	};
+	return c;
+}
+
+approximated_curve::match_type approximated_curve_index::first_match(
+	double x1, double y1, double z1,
+	double x2, double y2, double z2,
+	size_t * which) const
+{
+	// Whichever way a curve matches, one of its endpoints is close to the
+	// edge's start.
+	double start[] = { x1, y1, z1 };
+	cell center = cell_of(start);
+	std::vector<size_t> candidates;
+	for (long long dx = -1; dx <= 1; ++dx) {
+		for (long long dy = -1; dy <= 1; ++dy) {
+			for (long long dz = -1; dz <= 1; ++dz) {
+				cell c = { center.x + dx, center.y + dy, center.z + dz };
+				auto found = by_cell_.find(c);
+				if (found != by_cell_.end()) {
+					candidates.insert(candidates.end(), found->second.begin(), found->second.end());
+				}
+			}
+		}
+	}
+	boost::sort(candidates);
+	for (auto i = candidates.begin(); i != candidates.end(); ++i) {
+		auto m = curves_[*i].matches(x1, y1, z1, x2, y2, z2, eps_);
+		if (m != approximated_curve::NO_MATCH) {
+			*which = *i;
+			return m;
+		}
+	}
+	return approximated_curve::NO_MATCH;
 }
\ No newline at end of file
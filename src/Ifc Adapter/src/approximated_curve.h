@@ -34,6 +34,10 @@ public:
 		return approximated_curve(t(p1_), t(p2_), t(n_), area_, length_ratio_);
 	}
 
+	// The endpoints' coordinates, rounded.
+	const double * start() const { return dp1_; }
+	const double * end() const { return dp2_; }
+
 private:
 	point_3 p1_;
 	point_3 p2_;
@@ -41,8 +45,50 @@ private:
 	double length_ratio_;
 	double area_;
 
-#ifndef NDEBUG
+	// Matching only ever looks at these, so it never touches the exact
+	// numbers (and can be done from several threads at once).
 	double dp1_[3];
 	double dp2_[3];
-#endif
+};
+
+// A set of approximated curves, indexed by the grid cells their endpoints
+// fall in, so that finding what an edge matches doesn't mean trying all of
+// them.
+class approximated_curve_index {
+public:
+	approximated_curve_index(const std::vector<approximated_curve> & curves, double eps);
+
+	// Finds the first of the curves (in their original order) that the edge
+	// from (x1, y1, z1) to (x2, y2, z2) matches, which is what trying each
+	// of them in turn would find. Returns how it matches and sets *which to
+	// its index, or returns NO_MATCH.
+	approximated_curve::match_type first_match(
+		double x1, double y1, double z1,
+		double x2, double y2, double z2,
+		size_t * which) const;
+
+private:
+	struct cell {
+		long long x, y, z;
+		bool operator == (const cell & other) const {
+			return x == other.x && y == other.y && z == other.z;
+		}
+	};
+	struct cell_hash {
+		size_t operator () (const cell & c) const {
+			return (size_t)(c.x * 73856093 ^ c.y * 19349663 ^ c.z * 83492791);
+		}
+	};
+
+	const std::vector<approximated_curve> & curves_;
+	double eps_;
+	double cell_size_;
+	// Each curve is in the cells of both of its endpoints, so that it's
+	// found whichever way an edge runs along it.
+	std::unordered_map<cell, std::vector<size_t>, cell_hash> by_cell_;
+
+	cell cell_of(const double * p) const;
+
+	approximated_curve_index(const approximated_curve_index & disabled);
+	approximated_curve_index & operator = (const approximated_curve_index & disabled);
 };
\ No newline at end of file
@@ -1,10 +1,13 @@
 #include "precompiled.h"
 
+#include <ppl.h>
+
 #include "../../Edm Wrapper/edm_wrapper_native_interface.h"
 
 #include "model_operations.h"
 
 #include "internal_geometry.h"
+#include "release.h"
 #include "unit_scaler.h"
 
 using namespace ifc_interface;
@@ -132,6 +135,227 @@ double getMaterialLayerThickness(const ifc_object & obj, const unit_scaler & s){
 	return s.length_in(dThickness);
 }
 
+// Messages about a product are held back while it's extracted (possibly on
+// a worker thread) and passed on afterwards, in the products' order.
+typedef std::vector<std::pair<void (*)(char *), std::string>> message_list;
+
+void send_all(const message_list & messages) {
+	for (auto m = messages.begin(); m != messages.end(); ++m) {
+		m->first(const_cast<char *>(m->second.c_str()));
+	}
+}
+
+struct element_extraction {
+	element_extraction() : info(nullptr), is_shading(false), composite_dir(0, 0, 0) { }
+
+	element_info * info; // null if the element was skipped
+	bool is_shading;
+	direction_3 composite_dir;
+	std::vector<approximated_curve> approximations;
+	message_list messages;
+	number_collection<K>::request_log requests;
+};
+
+struct space_extraction {
+	space_extraction() : info(nullptr) { }
+
+	space_info * info; // null if the space was skipped
+	std::vector<approximated_curve> approximations;
+	message_list messages;
+	number_collection<K>::request_log requests;
+};
+
+// Extracting in parallel uses the exact number types from several threads at
+// once, which is only safe if LEDA was built for it. Define
+// SBT_THREAD_SAFE_LEDA when building against such a LEDA; otherwise
+// SBT_PARALLEL_EXTRACTION is ignored.
+#ifdef SBT_THREAD_SAFE_LEDA
+const bool CAN_EXTRACT_IN_PARALLEL = true;
+#else
+const bool CAN_EXTRACT_IN_PARALLEL = false;
+#endif
+
+bool extract_in_parallel() {
+	return CAN_EXTRACT_IN_PARALLEL && (g_opts.flags & SBT_PARALLEL_EXTRACTION) != 0;
+}
+
+// Calls extract(i, c, &res[i]) for each product. With
+// SBT_PARALLEL_EXTRACTION (if it's available), the products are first extracted on all cores,
+// each with a number collection of its own that logs what it's asked for
+// (and shares c's cache of placements and representation maps).
+// Then, in the products' order, the logs are replayed against the shared
+// collection; a product whose numbers come out differently there (because
+// they snap to numbers from an earlier product) is extracted again with the
+// shared collection. Either way, the results are exactly the same as
+// extracting the products one at a time.
+template <typename Extraction, typename Extract>
+std::vector<Extraction> extract_all(
+	size_t count,
+	number_collection<K> * c,
+	Extract extract,
+	void (*msg_func)(char *))
+{
+	std::vector<Extraction> res(count);
+	if (!extract_in_parallel()) {
+		for (size_t i = 0; i < count; ++i) {
+			extract(i, c, &res[i]);
+			send_all(res[i].messages);
+		}
+		return res;
+	}
+
+	std::vector<char> failed(count, 0);
+	double tolerance = c->get_tolerance();
+	Concurrency::parallel_for((size_t)0, count, [&](size_t i) {
+		try {
+			number_collection<K> local(tolerance);
+			local.share_cache_with(*c);
+			local.set_log(&res[i].requests);
+			extract(i, &local, &res[i]);
+		}
+		catch (...) {
+			// It'll be extracted again (and fail again) on this thread.
+			failed[i] = 1;
+		}
+	});
+
+	size_t redone = 0;
+	for (size_t i = 0; i < count; ++i) {
+		if (failed[i] || !c->replay(res[i].requests)) {
+			if (res[i].info) { release(res[i].info); }
+			res[i] = Extraction();
+			extract(i, c, &res[i]);
+			++redone;
+		}
+		res[i].requests = number_collection<K>::request_log();
+		send_all(res[i].messages);
+	}
+	char buf[256];
+	sprintf(buf, "Extracted %u products in parallel (%u of them again afterwards).\n", count, redone);
+	msg_func(buf);
+	return res;
+}
+
+void extract_element(
+	const ifc_object & e,
+	const unit_scaler & s,
+	const std::function<bool(const char *)> & passes_filter,
+	double tolerance,
+	void (*msg_func)(char *),
+	void (*warn_func)(char *),
+	number_collection<K> * c,
+	element_extraction * res)
+{
+	char buf[256];
+
+	auto say = [res](void (*f)(char *), const char * msg) {
+		res->messages.push_back(std::make_pair(f, std::string(msg)));
+	};
+
+	auto is_ceiling = [](const ifc_object & o) -> bool {
+		if (!is_kind_of(o, "IfcCovering")) { return false; }
+		std::string type;
+		string_field(o, "PredefinedType", &type);
+		return type == "CEILING";
+	};
+
+	element_type type =
+		is_kind_of(e, "IfcWall") ? WALL :
+		is_kind_of(e, "IfcSlab") ? SLAB :
+		is_kind_of(e, "IfcColumn") ? COLUMN :
+		is_kind_of(e, "IfcBeam") ? BEAM :
+		is_kind_of(e, "IfcDoor") ? DOOR :
+		is_kind_of(e, "IfcWindow") ? WINDOW : 
+		is_ceiling(e) ? SLAB : UNKNOWN;
+	std::string guid;
+	string_field(e, "GlobalId", &guid);
+	if (type == UNKNOWN || !passes_filter(guid.c_str())) { return; }
+
+	sprintf(buf, "Extracting element %s...", guid.c_str());
+	say(msg_func, buf);
+	const ifc_object * effective_object = &e;
+	if (type == WINDOW || type == DOOR) {
+		effective_object = get_related_opening(e);
+		if (!effective_object) {
+			sprintf(
+				buf,
+				"Door or window %s has no related opening. It will be "
+				"skipped.\n",
+				guid.c_str());
+			say(warn_func, buf);
+			return;
+		}
+	}
+	// TM: adding a check if the thickness of a wall is smaller than the tolerance we skip it
+	double dMaterialLayerThickness = getMaterialLayerThickness(e, s);
+	if(dMaterialLayerThickness < tolerance){
+		sprintf(
+				buf,
+				"Building element  %s thickness %d is smaller than the tolernace %d. It will be "
+				"skipped.\n",
+				guid.c_str(), tolerance, tolerance);
+			say(warn_func, buf);
+			return;
+	}
+	bool element_is_shading = is_shading(e);
+	std::unique_ptr<internal_geometry::solid> internal_geom;
+	solid interface_geom;
+	transformation_3 globalizer;
+	direction_3 composite_dir(0, 0, 0);
+	try {
+		internal_geom = internal_geometry::get_local_geometry(
+			*effective_object,
+			s,
+			c,
+			[&say, msg_func](char * msg) { say(msg_func, msg); });
+		globalizer = internal_geometry::get_globalizer(
+			*effective_object,
+			s,
+			c);
+		internal_geom->transform(globalizer);
+		interface_geom = internal_geom->to_interface_solid();
+		if (!element_is_shading && internal_geom->axis1()) {
+			auto cdir_maybe = get_composite_dir(
+				e,
+				*internal_geom->axis1(),
+				*internal_geom->axis2(),
+				*internal_geom->axis3());
+			if (cdir_maybe) { composite_dir = *cdir_maybe; }
+		}
+		boost::copy(
+			internal_geom->approximations(), 
+			std::back_inserter(res->approximations));
+	}
+	catch (internal_geometry::bad_rep_exception & ex) {
+		sprintf(
+			buf, 
+			"Element %s could not be loaded (%s). It will be "
+			"skipped.\n",
+			guid.c_str(),
+			ex.what());
+		say(warn_func, buf);
+		return;
+	}
+	element_info * info = (element_info *)malloc(sizeof(element_info));
+	strncpy(info->name, guid.c_str(), ELEMENT_NAME_MAX_LEN);
+	info->type = type;
+	info->geometry = interface_geom;
+	// info.id is poorly named. It represents the *material* id of the
+	// element, and will be used by construction layers to identify this
+	// element as the source of the layer material. The lookup is 
+	// performed by treating the id as the index of the element in the
+	// elements array; as such, the id must match the object's index!
+	// Additionally, it shouldn't be needed for shading objects, since
+	// they don't participate in construction assemblies. So we'll 
+	// assign -1 to indicate "unset" first (get_elements assigns the real
+	// ones, in the elements' order):
+	info->id = -1;
+	res->info = info;
+	res->is_shading = element_is_shading;
+	res->composite_dir = composite_dir;
+	say(msg_func, "done.\n");
+}
+
 size_t get_elements(
 	model * m,
 	element_info *** elements, 
@@ -153,116 +377,29 @@ size_t get_elements(
 
 	char buf[256];
 
-	auto is_ceiling = [](const ifc_object & o) -> bool {
-		if (!is_kind_of(o, "IfcCovering")) { return false; }
-		std::string type;
-		string_field(o, "PredefinedType", &type);
-		return type == "CEILING";
-	};
-
 	auto bldg_elems = m->building_elements();
-	for (auto e = bldg_elems.begin(); e != bldg_elems.end(); ++e) {
-		element_type type =
-			is_kind_of(**e, "IfcWall") ? WALL :
-			is_kind_of(**e, "IfcSlab") ? SLAB :
-			is_kind_of(**e, "IfcColumn") ? COLUMN :
-			is_kind_of(**e, "IfcBeam") ? BEAM :
-			is_kind_of(**e, "IfcDoor") ? DOOR :
-			is_kind_of(**e, "IfcWindow") ? WINDOW : 
-			is_ceiling(**e) ? SLAB : UNKNOWN;
-		std::string guid;
-		string_field(**e, "GlobalId", &guid);
-		if (type != UNKNOWN && passes_filter(guid.c_str())) {
-			sprintf(buf, "Extracting element %s...", guid.c_str());
-			msg_func(buf);
-			const ifc_object * effective_object = *e;
-			if (type == WINDOW || type == DOOR) {
-				effective_object = get_related_opening(**e);
-				if (!effective_object) {
-					sprintf(
-						buf,
-						"Door or window %s has no related opening. It will be "
-						"skipped.\n",
-						guid.c_str());
-					warn_func(buf);
-					continue;
-				}
-			}
-			// TM: adding a check if the thickness of a wall is smaller than the tolerance we skip it
-			double dMaterialLayerThickness = getMaterialLayerThickness(**e, s);
-			if(dMaterialLayerThickness < *tolerance){
-				sprintf(
-						buf,
-						"Building element  %s thickness %d is smaller than the tolernace %d. It will be "
-						"skipped.\n",
-						guid.c_str(), tolerance, tolerance);
-					warn_func(buf);
-					continue;
-			}
-			bool element_is_shading = is_shading(**e);
-			std::unique_ptr<internal_geometry::solid> internal_geom;
-			solid interface_geom;
-			transformation_3 globalizer;
-			direction_3 composite_dir(0, 0, 0);
-			try {
-				internal_geom = internal_geometry::get_local_geometry(
-					*effective_object,
-					s,
-					c,
-					msg_func);
-				globalizer = internal_geometry::get_globalizer(
-					*effective_object,
-					s,
-					c);
-				internal_geom->transform(globalizer);
-				interface_geom = internal_geom->to_interface_solid();
-				if (!element_is_shading && internal_geom->axis1()) {
-					auto cdir_maybe = get_composite_dir(
-						**e,
-						*internal_geom->axis1(),
-						*internal_geom->axis2(),
-						*internal_geom->axis3());
-					if (cdir_maybe) { composite_dir = *cdir_maybe; }
-				}
-				boost::copy(
-					internal_geom->approximations(), 
-					std::back_inserter(*approximated_curves));
-			}
-			catch (internal_geometry::bad_rep_exception & ex) {
-				sprintf(
-					buf, 
-					"Element %s could not be loaded (%s). It will be "
-					"skipped.\n",
-					guid.c_str(),
-					ex.what());
-				warn_func(buf);
-				continue;
-			}
-			element_info * info = (element_info *)malloc(sizeof(element_info));
-			strncpy(info->name, guid.c_str(), ELEMENT_NAME_MAX_LEN);
-			info->type = type;
-			info->geometry = interface_geom;
-			// info.id is poorly named. It represents the *material* id of the
-			// element, and will be used by construction layers to identify this
-			// element as the source of the layer material. The lookup is 
-			// performed by treating the id as the index of the element in the
-			// elements array; as such, the id must match the object's index!
-			// Additionally, it shouldn't be needed for shading objects, since
-			// they don't participate in construction assemblies. So we'll 
-			// assign -1 to indicate "unset" first:
-			info->id = -1;
-			if (element_is_shading) { shadings->push_back(info); }
-			else {
-				// Then, if the element is a construction-participating element
-				// (instead of a shading), we'll synchronize the indices:
-				infos.push_back(info);
-				infos.back()->id = infos.size();
-				// The id is technically offset from the index by 1 for
-				// historical reasons.
-				composite_dirs.push_back(composite_dir);
-			}
-			msg_func("done.\n");
+	auto extractions = extract_all<element_extraction>(
+		bldg_elems.size(),
+		c,
+		[&](size_t i, number_collection<K> * nc, element_extraction * res) {
+			// Nothing the extraction looks at is needed afterwards.
+			ownership_scope handles(m);
+			extract_element(*bldg_elems[i], s, passes_filter, *tolerance, msg_func, warn_func, nc, res);
+		},
+		msg_func);
+	for (auto x = extractions.begin(); x != extractions.end(); ++x) {
+		if (!x->info) { continue; }
+		if (x->is_shading) { shadings->push_back(x->info); }
+		else {
+			// Then, if the element is a construction-participating element
+			// (instead of a shading), we'll synchronize the indices:
+			infos.push_back(x->info);
+			infos.back()->id = infos.size();
+			// The id is technically offset from the index by 1 for
+			// historical reasons.
+			composite_dirs.push_back(x->composite_dir);
 		}
+		boost::copy(x->approximations, std::back_inserter(*approximated_curves));
 	}
 
 	sprintf(buf, "Creating list for %u elements.\n", infos.size());
@@ -284,6 +421,52 @@ size_t get_elements(
 	return infos.size();
 }
 
+void extract_space(
+	const ifc_object & sp,
+	const unit_scaler & s,
+	const std::function<bool(const char *)> & space_filter,
+	void (*msg_func)(char *),
+	void (*warn_func)(char *),
+	number_collection<K> * c,
+	space_extraction * res)
+{
+	using internal_geometry::get_local_geometry;
+	using internal_geometry::get_globalizer;
+	typedef boost::format fmt;
+
+	auto say = [res](void (*f)(char *), const std::string & msg) {
+		res->messages.push_back(std::make_pair(f, msg));
+	};
+
+	std::string id;
+	string_field(sp, "GlobalId", &id);
+	try {
+		if (space_filter(id.c_str())) {
+			fmt m("Extracting space %s...");
+			say(msg_func, (m % id).str());
+			auto geometry = get_local_geometry(
+				sp,
+				s,
+				c,
+				[&say, msg_func](char * msg) { say(msg_func, msg); });
+			auto globalizer = get_globalizer(sp, s, c);
+			geometry->transform(globalizer);
+			space_info * this_space = (space_info *)malloc(sizeof(space_info));
+			strncpy(this_space->id, id.c_str(), SPACE_ID_MAX_LEN);
+			this_space->geometry = geometry->to_interface_solid();
+			res->info = this_space;
+			boost::copy(
+				geometry->approximations(), 
+				std::back_inserter(res->approximations));
+			say(msg_func, "done.\n");
+		}
+	}
+	catch (internal_geometry::bad_rep_exception & ex) {
+		fmt m("Space %s could not be loaded (%s). It will be skipped.\n");
+		say(warn_func, (m % id % ex.what()).str());
+	}
+}
+
 size_t get_spaces(
 	model * m, 
 	space_info *** spaces, 
@@ -294,47 +477,61 @@ size_t get_spaces(
 	number_collection<K> * c,
 	std::vector<approximated_curve> * approximated_curves)
 {
-	using internal_geometry::get_local_geometry;
-	using internal_geometry::get_globalizer;
-	typedef boost::format fmt;
-		
 	auto ss = m->spaces();
-	std::vector<space_info> space_vector;
+	std::vector<space_info *> space_vector;
 	*approximated_curves = std::vector<approximated_curve>();
 
-	for (auto sp = ss.begin(); sp != ss.end(); ++sp) {
-		std::string id;
-		string_field(**sp, "GlobalId", &id);
-		try {
-			if (space_filter(id.c_str())) {
-				fmt m("Extracting space %s...");
-				msg_func(const_cast<char *>((m % id).str().c_str()));
-				auto geometry = get_local_geometry(**sp, s, c, msg_func);
-				auto globalizer = get_globalizer(**sp, s, c);
-				geometry->transform(globalizer);
-				space_info this_space;
-				strncpy(this_space.id, id.c_str(), SPACE_ID_MAX_LEN);
-				this_space.geometry = geometry->to_interface_solid();
-				space_vector.push_back(this_space);
-				boost::copy(
-					geometry->approximations(), 
-					std::back_inserter(*approximated_curves));
-				msg_func("done.\n");
-			}
-		}
-		catch (internal_geometry::bad_rep_exception & ex) {
-			fmt m("Space %s could not be loaded (%s). It will be skipped.\n");
-			warn_func(const_cast<char *>((m % id % ex.what()).str().c_str()));
-		}
+	auto extractions = extract_all<space_extraction>(
+		ss.size(),
+		c,
+		[&](size_t i, number_collection<K> * nc, space_extraction * res) {
+			ownership_scope handles(m);
+			extract_space(*ss[i], s, space_filter, msg_func, warn_func, nc, res);
+		},
+		msg_func);
+	for (auto x = extractions.begin(); x != extractions.end(); ++x) {
+		if (!x->info) { continue; }
+		space_vector.push_back(x->info);
+		boost::copy(x->approximations, std::back_inserter(*approximated_curves));
 	}
 
-	*spaces = create_list<space_info>(space_vector.size());
+	*spaces = (space_info **)malloc(sizeof(space_info *) * space_vector.size());
 	for (size_t i = 0; i < space_vector.size(); ++i) {
-		*(*spaces)[i] = space_vector[i];
+		(*spaces)[i] = space_vector[i];
 	}
 	return space_vector.size();
 }
 
+void report_cache_counts(const number_collection<K> & c, void (*notify)(char *)) {
+	char buf[256];
+	auto total = c.total_cache_counts();
+	sprintf(
+		buf,
+		"Placement cache: %u hits, %u misses.\n",
+		total.transformation_hits,
+		total.transformation_misses);
+	notify(buf);
+	sprintf(
+		buf,
+		"Representation map cache: %u hits, %u misses.\n",
+		total.map_geometry_hits,
+		total.map_geometry_misses);
+	notify(buf);
+	auto by_thread = c.cache_counts_by_thread();
+	if (by_thread.size() < 2) { return; }
+	for (size_t i = 0; i < by_thread.size(); ++i) {
+		sprintf(
+			buf,
+			"Thread %u: placement cache %u/%u, representation map cache %u/%u (hits/misses).\n",
+			i + 1,
+			by_thread[i].transformation_hits,
+			by_thread[i].transformation_misses,
+			by_thread[i].map_geometry_hits,
+			by_thread[i].map_geometry_misses);
+		notify(buf);
+	}
+}
+
 } // namespace
 
 ifcadapter_return_t extract_from_model(
@@ -358,6 +555,9 @@ ifcadapter_return_t extract_from_model(
 {
 	std::vector<approximated_curve> element_approxes, space_approxes;
 	char buf[256];
+	if ((g_opts.flags & SBT_PARALLEL_EXTRACTION) && !CAN_EXTRACT_IN_PARALLEL) {
+		warn("Parallel extraction isn't available in this build (LEDA may not be thread-safe). Extracting one product at a time.\n");
+	}
 	*element_count = get_elements(
 		m, 
 		elements, 
@@ -385,6 +585,7 @@ ifcadapter_return_t extract_from_model(
 		&space_approxes);
 	sprintf(buf, "Got %u building spaces.\n", *space_count);
 	notify(buf);
+	report_cache_counts(*c, notify);
 	*approximated_curves = element_approxes;
 	boost::copy(space_approxes, std::back_inserter(*approximated_curves));
 	return IFCADAPT_OK;
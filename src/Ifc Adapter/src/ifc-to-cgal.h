@@ -36,6 +36,12 @@ CGAL::Direction_3<KernelT> build_direction(
 
 template <typename KernelT>
 CGAL::Aff_transformation_3<KernelT> build_transformation(
+	const ifc_interface::ifc_object * obj,
+	const unit_scaler & s,
+	number_collection<KernelT> * c);
+
+template <typename KernelT>
+CGAL::Aff_transformation_3<KernelT> build_uncached_transformation(
 	const ifc_interface::ifc_object * obj,
 	const unit_scaler & s,
 	number_collection<KernelT> * c)
@@ -115,3 +121,20 @@ CGAL::Aff_transformation_3<KernelT> build_transformation(
 		return result_t();
 	}
 }
+
+// Placements are shared (every element on a storey is placed relative to
+// the storey's placement, which is relative to the building's, and so on),
+// so the transformations built from them, composed ones included, are
+// cached in the number collection they were built with.
+template <typename KernelT>
+CGAL::Aff_transformation_3<KernelT> build_transformation(
+	const ifc_interface::ifc_object * obj,
+	const unit_scaler & s,
+	number_collection<KernelT> * c)
+{
+	size_t id;
+	if (!obj || !instance_id(*obj, &id)) { return build_uncached_transformation(obj, s, c); }
+	return c->cached_transformation(id, [obj, &s, c]() {
+		return build_uncached_transformation(obj, s, c);
+	});
+}
@@ -226,6 +226,10 @@ brep::brep(
 	}
 }
 
+std::unique_ptr<solid> brep::clone() const {
+	return std::unique_ptr<solid>(new brep(*this));
+}
+
 void brep::transform(const transformation_3 & t) {
 	boost::for_each(faces, [&t](face & f) { f.transform(t); });
 	if (axes_) { 
@@ -279,6 +283,10 @@ ext::ext(
 	}
 }
 
+std::unique_ptr<solid> ext::clone() const {
+	return std::unique_ptr<solid>(new ext(*this));
+}
+
 void ext::transform(const transformation_3 & t) {
 	assert(!are_perpendicular(area_.normal(), dir_));
 	area_.transform(t);
@@ -458,9 +466,17 @@ std::unique_ptr<solid> get_local_geometry(
 	else if (is_instance_of(obj, "IfcMappedItem")) {
 		ifc_object * src;
 		object_field(obj, "MappingSource", &src);
+		// The occurrences of a representation map all have its local
+		// geometry (get_globalizer applies their mappings), so it's only
+		// built once, even when products are extracted in parallel.
 		ifc_object * rep;
 		object_field(*src, "MappedRepresentation", &rep);
-		return get_local_geometry(*rep, scaler, c, notify);
+		size_t src_id;
+		if (!instance_id(*src, &src_id)) { return get_local_geometry(*rep, scaler, c, notify); }
+		auto geometry = c->cached_map_geometry(src_id, [rep, &scaler, c, &notify]() {
+			return std::shared_ptr<const solid>(get_local_geometry(*rep, scaler, c, notify).release());
+		});
+		return geometry->clone();
 	}
 	else if (is_instance_of(obj, "IfcBooleanClippingResult")) {
 		using wrapped_nef_operations::from_boolean_result;
@@ -73,6 +73,9 @@ public:
 		axes_ = a;
 	}
 
+	virtual ~solid() { }
+
+	virtual std::unique_ptr<solid> clone() const = 0;
 	virtual void transform(const transformation_3 & t) = 0;
 	virtual interface_solid to_interface_solid() const = 0;
 	virtual std::vector<approximated_curve> approximations() const = 0;
@@ -89,6 +92,7 @@ public:
 
 	explicit brep(const std::vector<face> & faces) : faces(faces) { }
 
+	virtual std::unique_ptr<solid> clone() const;
 	virtual void transform(const transformation_3 & t);
 	virtual interface_solid to_interface_solid() const;
 	virtual std::vector<approximated_curve> approximations() const;
@@ -107,6 +111,7 @@ public:
 	const face & base() const { return area_; }
 	const direction_3 & dir() const { return dir_; }
 	const NT & depth() const { return depth_; }
+	virtual std::unique_ptr<solid> clone() const;
 	virtual void transform(const transformation_3 & t);
 	virtual interface_solid to_interface_solid() const;
 	virtual std::vector<approximated_curve> approximations() const;
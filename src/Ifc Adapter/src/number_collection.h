@@ -2,8 +2,16 @@
 
 #include "precompiled.h"
 
+#include <ppl.h>
+
 #include "one_dimensional_equality_context.h"
 
+namespace internal_geometry {
+
+class solid;
+
+} // namespace internal_geometry
+
 template <typename K>
 class number_collection {
 	typedef typename K::FT			NT;
@@ -11,9 +19,72 @@ class number_collection {
 	typedef typename K::Point_3		point_3;
 	typedef typename K::Direction_3	direction_3;
 	typedef typename K::Vector_3	vector_3;
+	typedef typename K::Aff_transformation_3	transformation_3;
+
+public:
+	// The requests made of a collection, in order, along with what they
+	// returned (see replay).
+	class request_log {
+	private:
+		friend class number_collection;
+		enum kind_t { POINT_2, POINT_3, HEIGHT, DIRECTION };
+		struct request {
+			kind_t kind;
+			double x, y, z;
+			NT a, b, c;
+		};
+		std::vector<request> requests;
+
+		void add(kind_t kind, double x, double y, double z, const NT & a, const NT & b, const NT & c) {
+			request r = { kind, x, y, z, a, b, c };
+			requests.push_back(r);
+		}
+	};
+
+	// How a cache was used on one thread.
+	struct cache_counts {
+		cache_counts() : transformation_hits(0), transformation_misses(0), map_geometry_hits(0), map_geometry_misses(0) { }
+
+		size_t transformation_hits;
+		size_t transformation_misses;
+		size_t map_geometry_hits;
+		size_t map_geometry_misses;
+
+		void add(const cache_counts & other) {
+			transformation_hits += other.transformation_hits;
+			transformation_misses += other.transformation_misses;
+			map_geometry_hits += other.map_geometry_hits;
+			map_geometry_misses += other.map_geometry_misses;
+		}
+	};
 
 private:
+	// Something built from a collection's answers, along with the requests
+	// it was built from and which of the collections sharing the cache built
+	// it.
+	template <typename T>
+	struct cache_entry {
+		T value;
+		request_log requests;
+		size_t builder;
+	};
+
+	// Several collections can share one of these (see share_cache_with).
+	// Entries are only ever added, and std::map doesn't move them, so an
+	// entry can be used after the lock is released.
+	struct build_cache {
+		build_cache() : next_user(1) { }
+
+		Concurrency::critical_section lock;
+		size_t next_user;
+		// Counted per thread, so that counting doesn't need the lock.
+		Concurrency::combinable<cache_counts> counts;
+		std::map<size_t, cache_entry<transformation_3>> transformations;
+		std::map<size_t, cache_entry<std::shared_ptr<const internal_geometry::solid>>> map_geometries;
+	};
+
 	double tolerance;
+	request_log * log;
 	one_dimensional_equality_context<NT> xs_2d;
 	one_dimensional_equality_context<NT> ys_2d;
 	one_dimensional_equality_context<NT> xs_3d;
@@ -23,6 +94,9 @@ private:
 
 	std::vector<direction_3> directions;
 
+	std::shared_ptr<build_cache> cache;
+	size_t cache_user;
+
 	void init_constants()
 	{
 		heights.request(0.0); heights.request(1.0);
@@ -37,16 +111,167 @@ private:
 		return (a.to_vector() + b.to_vector()).squared_length() > a.to_vector().squared_length() + b.to_vector().squared_length();
 	}
 
+	// A hit is only exactly what building the value again would give if this
+	// collection answers the entry's requests the way they were answered when
+	// it was built. That's certain if this collection built it; otherwise
+	// they're made of this collection now. If this collection is logging,
+	// they're logged instead (whoever replays the log will check them), and
+	// so that what's built around the hit is logged completely, they're
+	// logged even if this collection built it.
+	template <typename T>
+	bool find_cached(const std::map<size_t, cache_entry<T>> & entries, size_t id, T * res) {
+		const cache_entry<T> * e;
+		{
+			Concurrency::critical_section::scoped_lock l(cache->lock);
+			auto found = entries.find(id);
+			if (found == entries.end()) { return false; }
+			e = &found->second;
+		}
+		if (log) {
+			boost::copy(e->requests.requests, std::back_inserter(log->requests));
+		}
+		else if (e->builder != cache_user && !replay(e->requests)) {
+			return false;
+		}
+		*res = e->value;
+		return true;
+	}
+
+	// Builds a value, recording the requests it takes. If another collection
+	// sharing the cache got there first, its entry is kept; this collection's
+	// value is still returned, since it's exactly what this collection would
+	// build.
+	template <typename T, typename Build>
+	T build_and_cache(std::map<size_t, cache_entry<T>> & entries, size_t id, Build build) {
+		request_log captured;
+		request_log * outer = log;
+		size_t start = outer ? outer->requests.size() : 0;
+		if (!outer) { log = &captured; }
+		T res;
+		try {
+			res = build();
+		}
+		catch (...) {
+			log = outer;
+			throw;
+		}
+		log = outer;
+		cache_entry<T> e;
+		e.value = res;
+		e.builder = cache_user;
+		if (outer) {
+			e.requests.requests.assign(outer->requests.begin() + start, outer->requests.end());
+		}
+		else { e.requests.requests.swap(captured.requests); }
+		Concurrency::critical_section::scoped_lock l(cache->lock);
+		entries.insert(std::make_pair(id, e));
+		return res;
+	}
+
 	number_collection(const number_collection & disabled);
 	number_collection & operator = (const number_collection & disabled);
 
 public:
 
-	number_collection(double tol) : tolerance(tol), heights(tol), xs_2d(tol), ys_2d(tol), xs_3d(tol), ys_3d(tol), zs_3d(tol) { init_constants(); }
+	number_collection(double tol) : tolerance(tol), log(nullptr), cache(std::make_shared<build_cache>()), cache_user(0), heights(tol), xs_2d(tol), ys_2d(tol), xs_3d(tol), ys_3d(tol), zs_3d(tol) { init_constants(); }
+
+	double get_tolerance() const { return tolerance; }
+
+	// While a log is set, every request is recorded in it.
+	void set_log(request_log * l) { log = l; }
+
+	// Makes the logged requests of this collection, in order, until one of
+	// them returns something different than it did. If none of them do,
+	// anything that was built from the logged answers is exactly what would
+	// have been built with this collection instead.
+	bool replay(const request_log & l) {
+		for (auto r = l.requests.begin(); r != l.requests.end(); ++r) {
+			switch (r->kind) {
+				case request_log::POINT_2: {
+					point_2 p = request_point(r->x, r->y);
+					if (p.x() != r->a || p.y() != r->b) { return false; }
+					break;
+				}
+				case request_log::POINT_3: {
+					point_3 p = request_point(r->x, r->y, r->z);
+					if (p.x() != r->a || p.y() != r->b || p.z() != r->c) { return false; }
+					break;
+				}
+				case request_log::HEIGHT:
+					if (request_height(r->x) != r->a) { return false; }
+					break;
+				case request_log::DIRECTION: {
+					direction_3 d = request_direction(r->x, r->y, r->z);
+					if (d.dx() != r->a || d.dy() != r->b || d.dz() != r->c) { return false; }
+					break;
+				}
+			}
+		}
+		return true;
+	}
+
+	point_2 request_point(double x, double y) {
+		point_2 res(xs_2d.request(x), ys_2d.request(y));
+		if (log) { log->add(request_log::POINT_2, x, y, 0.0, res.x(), res.y(), NT(0)); }
+		return res;
+	}
+	point_3 request_point(double x, double y, double z) {
+		point_3 res(xs_3d.request(x), ys_3d.request(y), zs_3d.request(z));
+		if (log) { log->add(request_log::POINT_3, x, y, z, res.x(), res.y(), res.z()); }
+		return res;
+	}
+	NT request_height(double z) {
+		NT res = heights.request(z);
+		if (log) { log->add(request_log::HEIGHT, z, 0.0, 0.0, res, NT(0), NT(0)); }
+		return res;
+	}
+
+	// Transformations built from this collection's answers, by the ID of the
+	// instance they were built from (see ifc_interface::instance_id). If it
+	// isn't cached, build() builds it.
+	template <typename Build>
+	transformation_3 cached_transformation(size_t id, Build build) {
+		transformation_3 res;
+		if (find_cached(cache->transformations, id, &res)) {
+			++cache->counts.local().transformation_hits;
+			return res;
+		}
+		++cache->counts.local().transformation_misses;
+		return build_and_cache(cache->transformations, id, build);
+	}
 
-	point_2 request_point(double x, double y) { return point_2(xs_2d.request(x), ys_2d.request(y)); }
-	point_3 request_point(double x, double y, double z) { return point_3(xs_3d.request(x), ys_3d.request(y), zs_3d.request(z)); }
-	NT request_height(double z) { return heights.request(z); }
+	// The local geometry of representation maps, cached the same way by the
+	// maps' instance IDs.
+	template <typename Build>
+	std::shared_ptr<const internal_geometry::solid> cached_map_geometry(size_t id, Build build) {
+		std::shared_ptr<const internal_geometry::solid> res;
+		if (find_cached(cache->map_geometries, id, &res)) {
+			++cache->counts.local().map_geometry_hits;
+			return res;
+		}
+		++cache->counts.local().map_geometry_misses;
+		return build_and_cache(cache->map_geometries, id, build);
+	}
+
+	// How the cache was used by every collection sharing it, by thread.
+	std::vector<cache_counts> cache_counts_by_thread() const {
+		std::vector<cache_counts> res;
+		cache->counts.combine_each([&res](const cache_counts & c) { res.push_back(c); });
+		return res;
+	}
+	cache_counts total_cache_counts() const {
+		cache_counts res;
+		cache->counts.combine_each([&res](const cache_counts & c) { res.add(c); });
+		return res;
+	}
+
+	// Uses (and adds to) other's cache from now on. The collections can then
+	// be used on different threads.
+	void share_cache_with(const number_collection & other) {
+		cache = other.cache;
+		Concurrency::critical_section::scoped_lock l(cache->lock);
+		cache_user = cache->next_user++;
+	}
 
 	bool is_zero(double d) const { 
 		return one_dimensional_equality_context<NT>::is_zero(d, tolerance); 
@@ -57,13 +282,15 @@ public:
 		auto exists = boost::find_if(directions, [&requested, this](const direction_3 & d) {
 			return are_effectively_parallel(d, requested, tolerance);
 		});
+		direction_3 res = requested;
 		if (exists != directions.end()) {
-			return share_sense(requested, *exists) ? *exists : -*exists;
+			res = share_sense(requested, *exists) ? *exists : -*exists;
 		}
 		else {
 			directions.push_back(requested);
-			return directions.back();
 		}
+		if (log) { log->add(request_log::DIRECTION, dx, dy, dz, res.dx(), res.dy(), res.dz()); }
+		return res;
 	}
 
 	static bool are_effectively_parallel(
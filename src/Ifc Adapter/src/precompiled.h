@@ -12,8 +12,10 @@
 #pragma warning (disable:4702) // unreachable code
 #pragma warning (disable:4756) // overflow in constant arithmetic
 #pragma warning (disable:4800) // forcing int to bool
+#include <array>
 #include <vector>
 #include <map>
+#include <unordered_map>
 #include <string>
 #include <numeric>
 #include <exception>
@@ -3,6 +3,7 @@
 #include "geometry_common.h"
 #include "number_collection.h"
 #include "sbt-ifcadapter.h"
+#include "../../Core/src/vertex_welding.h"
 
 #include "reassign_bounded_spaces.h"
 
@@ -23,26 +24,18 @@ namespace {
 		shell_builder(const solid & s, q_collection & qs) {
 			if (s.rep_type == REP_BREP) {
 				const brep & b = s.rep.as_brep;
+				vertex_welding::vertex_welder<PointT> welded;
 				for (size_t i = 0; i < b.face_count; ++i) {
 					r_indices.push_back(std::vector<size_t>());
 					for (size_t j = 0; j < b.faces[i].outer_boundary.vertex_count; ++j) {
-						size_t index;
 						point_3 qp = qs.request_point(
 							CGAL::to_double(b.faces[i].outer_boundary.vertices[j].x),
 							CGAL::to_double(b.faces[i].outer_boundary.vertices[j].y),
 							CGAL::to_double(b.faces[i].outer_boundary.vertices[j].z));
-						for (index = 0; index < points.size(); ++index) {
-							if (points[index] == qp) {
-								r_indices.back().push_back(index);
-								break;
-							}
-						}
-						if (index == points.size()) {
-							points.push_back(qp);
-							r_indices.back().push_back(index);
-						}
+						r_indices.back().push_back(welded.weld(qp));
 					}
 				}
+				points = welded.points();
 			}
 			else if (s.rep_type == REP_EXT) {
 				const extruded_area_solid & ext = s.rep.as_ext;
@@ -66,16 +59,17 @@ namespace {
 					r_indices.back().push_back(i);
 				}
 				r_indices.push_back(std::vector<size_t>());
-				for (size_t i = ext.area.outer_boundary.vertex_count - 1; i >= 0; --i) {
+				for (size_t i = ext.area.outer_boundary.vertex_count; i-- > 0; ) {
 					r_indices.back().push_back(i + ext.area.outer_boundary.vertex_count);
 				}
 
 				for (size_t i = 0; i < ext.area.outer_boundary.vertex_count; ++i) {
+					size_t next = (i + 1) % ext.area.outer_boundary.vertex_count;
 					r_indices.push_back(std::vector<size_t>());
+					r_indices.back().push_back(next);
 					r_indices.back().push_back(i);
-					r_indices.back().push_back(ext.area.outer_boundary.vertex_count - 1 - i);
-					r_indices.back().push_back(i != ext.area.outer_boundary.vertex_count - 1 ? (ext.area.outer_boundary.vertex_count - 2 - i) : (ext.area.outer_boundary.vertex_count - 1));
-					r_indices.back().push_back((i + 1) % ext.area.outer_boundary.vertex_count);
+					r_indices.back().push_back(i + ext.area.outer_boundary.vertex_count);
+					r_indices.back().push_back(next + ext.area.outer_boundary.vertex_count);
 				}
 
 			}
@@ -84,6 +78,9 @@ namespace {
 			}
 		}
 
+		const std::vector<PointT> & vertices() const { return points; }
+		const std::vector<std::vector<size_t>> & facets() const { return r_indices; }
+
 		void operator () (HDS & hds) {
 			CGAL::Polyhedron_incremental_builder_3<HDS> b(hds, true);
 			b.begin_surface(points.size(), r_indices.size());
@@ -123,13 +120,6 @@ namespace {
 	};
 
 
-	nef_polyhedron_3 build_geometry(space_info * space, q_collection & qs) {
-		polyhedron_3 qpoly;
-		shell_builder<polyhedron_3::HDS, point_3> builder(space->geometry, qs);
-		qpoly.delegate(builder);
-		return nef_polyhedron_3(qpoly);
-	}
-
 	point_3 calculate_midpoint(const std::vector<point_3> & points) {
 		NT xtotal = std::accumulate(points.begin(), points.end(), NT(0.0), [](NT curr, const point_3 & p) { return curr + p.x(); });
 		NT ytotal = std::accumulate(points.begin(), points.end(), NT(0.0), [](NT curr, const point_3 & p) { return curr + p.y(); });
@@ -183,24 +173,160 @@ namespace {
 	}
 #pragma warning (pop)
 
-	bool shell_contains(const nef_polyhedron_3 & shell, const point_3 & point) {
-		CGAL::Object_handle obj = shell.locate(point);
-		nef_polyhedron_3::Volume_const_handle point_vol;
-		if (CGAL::assign(point_vol, obj)) {
-			obj = shell.locate(outside_point(shell));
-			nef_polyhedron_3::Volume_const_handle outside_vol;
-			if (CGAL::assign(outside_vol, obj)) {
-				return point_vol != outside_vol;
+	enum crossing_t { CROSSES, MISSES, TOO_CLOSE };
+
+	// Whether the ray from p in direction d (a unit vector) crosses the
+	// triangle abc, computed in doubles. Anything within eps of the triangle's
+	// edges, or of p being on it, is too close to call.
+	crossing_t ray_crossing(
+		const double * p,
+		const double * d,
+		const double * a,
+		const double * b,
+		const double * c,
+		double eps)
+	{
+		auto sub = [](const double * x, const double * y, double * res) {
+			res[0] = x[0] - y[0]; res[1] = x[1] - y[1]; res[2] = x[2] - y[2];
+		};
+		auto cross = [](const double * x, const double * y, double * res) {
+			res[0] = x[1] * y[2] - x[2] * y[1];
+			res[1] = x[2] * y[0] - x[0] * y[2];
+			res[2] = x[0] * y[1] - x[1] * y[0];
+		};
+		auto dot = [](const double * x, const double * y) {
+			return x[0] * y[0] + x[1] * y[1] + x[2] * y[2];
+		};
+
+		double e1[3], e2[3], n[3], to_p[3];
+		sub(b, a, e1);
+		sub(c, a, e2);
+		cross(e1, e2, n);
+		double twice_area = sqrt(dot(n, n));
+		if (twice_area <= eps * eps) {
+			// A sliver. It can't change the parity unless the ray runs
+			// along it, and then it's close to a real triangle's edge.
+			return MISSES;
+		}
+		sub(p, a, to_p);
+		double height = dot(n, to_p) / twice_area;
+		double along = dot(n, d) / twice_area;
+		if (abs(along) < 1e-9) {
+			// The ray is parallel to the triangle's plane.
+			return abs(height) <= eps ? TOO_CLOSE : MISSES;
+		}
+		double t = -height / along;
+		if (t < -eps) { return MISSES; }
+		double hit[] = { p[0] + t * d[0], p[1] + t * d[1], p[2] + t * d[2] };
+		// The hit's signed distances (times the edges' lengths) inside each
+		// edge.
+		double to_hit[3], edge[3], side[3];
+		const double * corners[] = { a, b, c };
+		bool close = abs(t) <= eps;
+		for (int i = 0; i < 3; ++i) {
+			const double * from = corners[i];
+			const double * to = corners[(i + 1) % 3];
+			sub(to, from, edge);
+			sub(hit, from, to_hit);
+			cross(edge, to_hit, side);
+			double inside = dot(side, n) / twice_area;
+			double edge_length = sqrt(dot(edge, edge));
+			if (inside < -eps * edge_length) { return MISSES; }
+			if (inside <= eps * edge_length) { close = true; }
+		}
+		return close ? TOO_CLOSE : CROSSES;
+	}
+
+	// A loaded space's shell, set up to tell quickly whether a point is in
+	// it: its bounding box, and its faces as triangles in doubles (fans of
+	// the faces, which is fine for counting ray crossings). Only when a
+	// point is too close to the shell to call that way is the exact Nef
+	// polyhedron built (once) and asked.
+	class space_shell {
+	public:
+		space_shell(space_info * space, q_collection & qs) {
+			shell_builder<polyhedron_3::HDS, point_3> builder(space->geometry, qs);
+			const std::vector<point_3> & vertices = builder.vertices();
+			std::vector<std::array<double, 3>> dvertices(vertices.size());
+			double extent = 1.0;
+			for (int i = 0; i < 3; ++i) { min_[i] = max_[i] = 0.0; }
+			for (size_t v = 0; v < vertices.size(); ++v) {
+				dvertices[v][0] = CGAL::to_double(vertices[v].x());
+				dvertices[v][1] = CGAL::to_double(vertices[v].y());
+				dvertices[v][2] = CGAL::to_double(vertices[v].z());
+				for (int i = 0; i < 3; ++i) {
+					double x = dvertices[v][i];
+					if (v == 0 || x < min_[i]) { min_[i] = x; }
+					if (v == 0 || x > max_[i]) { max_[i] = x; }
+					if (abs(x) > extent) { extent = abs(x); }
+				}
 			}
-			else {
-				assert(CGAL::assign(outside_vol, obj));
+			// This space's largest absolute coordinate (at least 1) scales the
+			// tolerance: a billionth of it is far bigger than anything lost
+			// converting the snapped coordinates, and far smaller than
+			// anything in a building.
+			eps_ = extent * 1e-9;
+			auto & facets = builder.facets();
+			for (auto f = facets.begin(); f != facets.end(); ++f) {
+				for (size_t i = 2; i < f->size(); ++i) {
+					std::array<std::array<double, 3>, 3> t = {{
+						dvertices[(*f)[0]], dvertices[(*f)[i - 1]], dvertices[(*f)[i]]
+					}};
+					triangles_.push_back(t);
+				}
 			}
+			poly_.delegate(builder);
 		}
-		else {
-			assert(CGAL::assign(point_vol, obj));
+
+		bool contains(const point_3 & point) {
+			double p[] = {
+				CGAL::to_double(point.x()),
+				CGAL::to_double(point.y()),
+				CGAL::to_double(point.z())
+			};
+			for (int i = 0; i < 3; ++i) {
+				if (p[i] < min_[i] - eps_ || p[i] > max_[i] + eps_) { return false; }
+			}
+			// An arbitrary direction that's unlikely to run along any faces
+			// or edges.
+			static const double d[] = { 0.8164965809277261, 0.4242640687119285, 0.3915529552754924 };
+			bool inside = false;
+			for (auto t = triangles_.begin(); t != triangles_.end(); ++t) {
+				crossing_t c = ray_crossing(p, d, (*t)[0].data(), (*t)[1].data(), (*t)[2].data(), eps_);
+				if (c == TOO_CLOSE) { return exactly_contains(point); }
+				if (c == CROSSES) { inside = !inside; }
+			}
+			return inside;
 		}
-		return false;
-	}
+
+	private:
+		double min_[3];
+		double max_[3];
+		double eps_;
+		std::vector<std::array<std::array<double, 3>, 3>> triangles_;
+		polyhedron_3 poly_;
+		std::unique_ptr<nef_polyhedron_3> nef_;
+		nef_polyhedron_3::Volume_const_handle outside_;
+
+		bool exactly_contains(const point_3 & point) {
+			if (!nef_) {
+				nef_.reset(new nef_polyhedron_3(poly_));
+				CGAL::Object_handle obj = nef_->locate(outside_point(*nef_));
+				bool located = CGAL::assign(outside_, obj);
+				assert(located);
+				(void)located;
+			}
+			CGAL::Object_handle obj = nef_->locate(point);
+			nef_polyhedron_3::Volume_const_handle point_vol;
+			if (CGAL::assign(point_vol, obj)) {
+				return point_vol != outside_;
+			}
+			return false;
+		}
+
+		space_shell(const space_shell & disabled);
+		space_shell & operator = (const space_shell & disabled);
+	};
 
 }
 
@@ -215,9 +341,10 @@ void reassign_bounded_spaces(
 
 	q_collection qs(0.0005);
 
-	std::vector<std::pair<nef_polyhedron_3, std::string>> loaded_space_geometry;
+	std::vector<std::pair<std::unique_ptr<space_shell>, std::string>> loaded_space_geometry;
 	for (size_t i = 0; i < loaded_space_count; ++i) {
-		loaded_space_geometry.push_back(std::make_pair(build_geometry(loaded_spaces[i], qs), loaded_spaces[i]->id));
+		std::unique_ptr<space_shell> shell(new space_shell(loaded_spaces[i], qs));
+		loaded_space_geometry.push_back(std::make_pair(std::move(shell), std::string(loaded_spaces[i]->id)));
 	}
 
 	std::map<std::string, std::vector<space_boundary *>> calculated_spaces;
@@ -239,7 +366,7 @@ void reassign_bounded_spaces(
 		point_3 midpoint = convert_point(calculate_midpoint(p->second));
 		bool found_space_match = false;
 		for (auto q = loaded_space_geometry.begin(); q != loaded_space_geometry.end(); ++q) {
-			if (shell_contains(q->first, midpoint)) {
+			if (q->first->contains(midpoint)) {
 				found_space_match = true;
 				for (auto r = p->second.begin(); r != p->second.end(); ++r) {
 					strncpy((*r)->bounded_space->id, q->second.c_str(), SPACE_ID_MAX_LEN);
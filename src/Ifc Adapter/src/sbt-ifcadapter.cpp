@@ -1,5 +1,7 @@
 #include "precompiled.h"
 
+#include <ppl.h>
+
 #include "../../Edm Wrapper/edm_wrapper_native_interface.h"
 
 #include "sbt-ifcadapter.h"
@@ -15,6 +17,8 @@ sb_calculation_options g_opts;
 
 namespace {
 
+void do_nothing(char * /*msg*/) { }
+
 std::function<bool(const char *)> create_guid_filter(char ** first, size_t count) {
 	std::set<std::string> ok_elements;
 	if (first != nullptr && count != 0) {
@@ -108,12 +112,40 @@ void gather_geometry_info(
 	}
 }	
 
-template <typename ApproximatedCurveRange>
+// The curves that a loop's edges match (see approximated_curve_index).
+struct loop_matches {
+	std::vector<size_t> forward;
+	std::vector<size_t> reverse;
+};
+
+loop_matches find_matches(const approximated_curve_index & index, const polyloop & loop) {
+	loop_matches res;
+	for (size_t i = 0; i < loop.vertex_count; ++i) {
+		const point & curr = loop.vertices[i];
+		const point & next = loop.vertices[(i + 1) % loop.vertex_count];
+		size_t which;
+		auto modify = index.first_match(curr.x, curr.y, curr.z,
+										next.x, next.y, next.z,
+										&which);
+		if (modify == approximated_curve::FORWARD_MATCH) {
+			res.forward.push_back(which);
+		}
+		else if (modify == approximated_curve::REVERSE_MATCH) {
+			res.reverse.push_back(which);
+		}
+	}
+	return res;
+}
+
 boost::optional<float> calculate_corrected_area(
-	const ApproximatedCurveRange & as,
+	const std::vector<approximated_curve> & as,
+	const loop_matches & matches,
 	const polyloop & loop,
 	double eps)
 {
+	if (matches.forward.empty() && matches.reverse.empty()) {
+		return boost::optional<float>();
+	}
 	// http://geomalgorithms.com/a01-_area.html
 	point curr, next;
 	double a = 0.0;
@@ -122,8 +154,6 @@ boost::optional<float> calculate_corrected_area(
 	double area_x = 0.0;
 	double area_y = 0.0;
 	double area_z = 0.0;
-	std::vector<ApproximatedCurveRange::const_iterator> forward_matches;
-	std::vector<ApproximatedCurveRange::const_iterator> reverse_matches;
 	for (size_t i = 0; i < loop.vertex_count; ++i) {
 		curr = loop.vertices[i];
 		next = loop.vertices[(i + 1) % loop.vertex_count];
@@ -133,22 +163,6 @@ boost::optional<float> calculate_corrected_area(
 		area_x += curr.y * next.z - curr.z * next.y;
 		area_y += curr.x * next.z - curr.z * next.x;
 		area_z += curr.x * next.y - curr.y * next.x;
-		for (auto apx = as.begin(); apx != as.end(); ++apx) {
-			auto modify = apx->matches(curr.x, curr.y, curr.z,
-									   next.x, next.y, next.z,
-				                       eps);
-			if (modify == approximated_curve::FORWARD_MATCH) {
-				forward_matches.push_back(apx);
-				break;
-			}
-			else if (modify == approximated_curve::REVERSE_MATCH) {
-				reverse_matches.push_back(apx);
-				break;
-			}
-		}
-	}
-	if (forward_matches.empty() && reverse_matches.empty()) {
-		return boost::optional<float>();
 	}
 	direction_3 n(a, b, c);
 	a = abs(a);
@@ -160,31 +174,33 @@ boost::optional<float> calculate_corrected_area(
 	if (a >= b && a >= c) { orig_area = abs(area_x / 2 * mag / a); }
 	else if (b >= a && b >= c) { orig_area = abs(area_y / 2 * mag / b); }
 	else /*if (c >= a && c >= b)*/ { orig_area = abs(area_z / 2 * mag / c); }
-	for (auto m = forward_matches.begin(); m != forward_matches.end(); ++m) {
+	for (auto m = matches.forward.begin(); m != matches.forward.end(); ++m) {
+		const approximated_curve & curve = as[*m];
 		if (number_collection<K>::are_effectively_perpendicular(
 			n,
-			(*m)->original_plane_normal(),
+			curve.original_plane_normal(),
 			eps))
 		{
-			return static_cast<float>(orig_area * (*m)->true_length_ratio());
+			return static_cast<float>(orig_area * curve.true_length_ratio());
 		}
-		else if (share_sense(n, (*m)->original_plane_normal())) {
-			area_change -= (*m)->true_area_on_left();
+		else if (share_sense(n, curve.original_plane_normal())) {
+			area_change -= curve.true_area_on_left();
 		}
-		else { area_change += (*m)->true_area_on_left(); }
+		else { area_change += curve.true_area_on_left(); }
 	}
-	for (auto m = reverse_matches.begin(); m != reverse_matches.end(); ++m) {
+	for (auto m = matches.reverse.begin(); m != matches.reverse.end(); ++m) {
+		const approximated_curve & curve = as[*m];
 		if (number_collection<K>::are_effectively_perpendicular(
 			n,
-			(*m)->original_plane_normal(),
+			curve.original_plane_normal(),
 			eps))
 		{
-			return static_cast<float>(orig_area * (*m)->true_length_ratio());
+			return static_cast<float>(orig_area * curve.true_length_ratio());
 		}
-		else if (share_sense(n, (*m)->original_plane_normal())) {
-			area_change += (*m)->true_area_on_left();
+		else if (share_sense(n, curve.original_plane_normal())) {
+			area_change += curve.true_area_on_left();
 		}
-		else { area_change -= (*m)->true_area_on_left(); }
+		else { area_change -= curve.true_area_on_left(); }
 	}
 	return static_cast<float>(orig_area + area_change);
 }
@@ -195,9 +211,16 @@ float * calculate_corrected_areas(
 	const std::vector<approximated_curve> & as,
 	double eps)
 {
+	// Finding the matches only involves doubles, so it's done on all cores.
+	// The corrections themselves involve exact numbers, so they aren't.
+	approximated_curve_index index(as, eps);
+	std::vector<loop_matches> matches(sb_count);
+	Concurrency::parallel_for((size_t)0, sb_count, [&](size_t i) {
+		matches[i] = find_matches(index, sbs[i]->geometry);
+	});
 	std::map<space_boundary *, float> corrected_areas;
 	for (size_t i = 0; i < sb_count; ++i) {
-		auto corrected = calculate_corrected_area(as, sbs[i]->geometry, eps);
+		auto corrected = calculate_corrected_area(as, matches[i], sbs[i]->geometry, eps);
 		assert(!corrected || *corrected >= 0.0);
 		if (corrected) { corrected_areas[sbs[i]] = *corrected; }
 	}
@@ -344,6 +367,10 @@ ifcadapter_return_t execute(
 			{
 				notify(fmt("Writing model to %s...") % output_filename);
 				m.write(output_filename);
+				if (!m.last_error().empty()) {
+					opts.error_func(const_cast<char *>((m.last_error() + "\n").c_str()));
+					return IFCADAPT_IFC_ERROR;
+				}
 				notify("done.\n");
 			}
 		}
@@ -382,6 +409,83 @@ ifcadapter_return_t execute(
 	}
 }
 
+ifcadapter_return_t extract_input_snapshot(
+	char * input_filename,
+	char * snapshot_filename,
+	sb_calculation_options opts)
+{
+	typedef boost::format fmt;
+	if (opts.notify_func == NULL) { opts.notify_func = &do_nothing; }
+	if (opts.warn_func == NULL) { opts.warn_func = &do_nothing; }
+	if (opts.error_func == NULL) { opts.error_func = &do_nothing; }
+	g_opts = opts;
+	if (!input_filename || !snapshot_filename) { return IFCADAPT_INVALID_ARGS; }
+	number_collection<K> ctxt(opts.tolernace_in_meters);
+	notify(fmt("Processing file %s.\n") % input_filename);
+
+	ifc_interface::model m(input_filename);
+	if (!m.loaded_ok()) {
+		opts.error_func(const_cast<char *>((m.last_error() + "\n").c_str()));
+		return IFCADAPT_IFC_ERROR;
+	}
+
+	size_t element_count = 0;
+	element_info ** elements = nullptr;
+	double * composite_layer_dxs = nullptr;
+	double * composite_layer_dys = nullptr;
+	double * composite_layer_dzs = nullptr;
+	size_t space_count = 0;
+	space_info ** spaces = nullptr;
+	std::vector<element_info *> shadings;
+	std::vector<approximated_curve> approximated_curves;
+	unit_scaler scaler(m.length_units_per_meter());
+	ifcadapter_return_t res = extract_from_model(
+		&m,
+		&element_count,
+		&elements,
+		&composite_layer_dxs,
+		&composite_layer_dys,
+		&composite_layer_dzs,
+		&space_count,
+		&spaces,
+		scaler,
+		g_opts.notify_func,
+		g_opts.warn_func,
+		create_guid_filter(opts.element_filter, opts.element_filter_count),
+		create_guid_filter(opts.space_filter, opts.space_filter_count),
+		&ctxt,
+		&shadings,
+		&approximated_curves,
+		&opts.tolernace_in_meters);
+	if (res == IFCADAPT_OK) {
+		// As far as the SBT core is concerned, everything is in meters.
+		opts.length_units_per_meter = 1.0;
+		notify(fmt("Writing input snapshot to %s...") % snapshot_filename);
+		if (write_input_snapshot(
+			snapshot_filename,
+			element_count,
+			elements,
+			space_count,
+			spaces,
+			opts) == SBT_OK)
+		{
+			notify("done.\n");
+		}
+		else {
+			opts.error_func("Couldn't write the input snapshot.\n");
+			res = IFCADAPT_UNKNOWN;
+		}
+	}
+
+	release_list(elements, element_count);
+	release_list(spaces, space_count);
+	boost::for_each(shadings, [](element_info * e) { release(e); });
+	free(composite_layer_dxs);
+	free(composite_layer_dys);
+	free(composite_layer_dzs);
+	return res;
+}
+
 void release_elements(element_info ** elements, size_t count) {
 	release_list(elements, count);
 }
@@ -38,6 +38,14 @@ __declspec(SBT_IFC_INTERFACE) enum ifcadapter_return_t execute(
 	int * totalFaces,
 	int * totalSolids);
 
+// Extracts the elements and spaces from an IFC file and writes them to an
+// input snapshot (see sbt-core.h) instead of processing them, so that
+// subsequent core-only runs can skip the IFC toolkit entirely.
+__declspec(SBT_IFC_INTERFACE) enum ifcadapter_return_t extract_input_snapshot(
+	char * input_filename,
+	char * snapshot_filename,
+	struct sb_calculation_options opts);
+
 __declspec(SBT_IFC_INTERFACE) 
 void release_elements(struct element_info ** elements, size_t count);
 
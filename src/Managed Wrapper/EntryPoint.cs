@@ -62,7 +62,13 @@ namespace Sbt
         [Flags]
         public enum SbtFlags : int
         {
-            None = 0x0
+            None = 0x0,
+            RegionOfInterest = 0x1,
+            RationalOrientations = 0x2,
+            // Experimental. Ignored unless the IFC adapter was built with
+            // SBT_THREAD_SAFE_LEDA (see sbt-core.h).
+            ExperimentalParallelExtraction = 0x4,
+            ApproximateOutput = 0x8
         }
 
         public enum IfcAdapterResult : int
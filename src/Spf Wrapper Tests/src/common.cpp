@@ -0,0 +1,38 @@
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+
+#include <gtest/gtest.h>
+
+#include "common.h"
+
+temp_file::temp_file(const std::string & contents) {
+	static int next = 0;
+	const ::testing::TestInfo * info = ::testing::UnitTest::GetInstance()->current_test_info();
+	path_ = ::testing::TempDir() + "spf-" + info->test_case_name() + "-" + info->name() + "-" + std::to_string(next++) + ".ifc";
+	std::ofstream out(path_.c_str(), std::ios::binary);
+	out.write(contents.data(), contents.size());
+}
+
+temp_file::~temp_file() {
+	remove(path_.c_str());
+}
+
+std::string ifc_file(const std::string & data) {
+	return
+		"ISO-10303-21;\n"
+		"HEADER;\n"
+		"FILE_DESCRIPTION(('ViewDefinition [CoordinationView]'),'2;1');\n"
+		"FILE_NAME('test.ifc','2013-01-01T00:00:00',(''),(''),'','','');\n"
+		"FILE_SCHEMA(('IFC2X3'));\n"
+		"ENDSEC;\n"
+		"DATA;\n" +
+		data +
+		"ENDSEC;\n"
+		"END-ISO-10303-21;\n";
+}
+
+std::string read_file(const char * path) {
+	std::ifstream in(path, std::ios::binary);
+	return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
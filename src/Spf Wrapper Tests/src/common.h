@@ -0,0 +1,24 @@
+#pragma once
+
+#include <string>
+
+// A file in GoogleTest's temporary directory that's deleted with this.
+class temp_file {
+public:
+	explicit temp_file(const std::string & contents);
+	~temp_file();
+
+	const char * path() const { return path_.c_str(); }
+
+private:
+	std::string path_;
+
+	temp_file(const temp_file & disabled);
+	temp_file & operator = (const temp_file & disabled);
+};
+
+// A minimal IFC-SPF file with the given DATA section records.
+std::string ifc_file(const std::string & data);
+
+// The file's contents, byte for byte.
+std::string read_file(const char * path);
@@ -0,0 +1,213 @@
+#include <algorithm>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <gtest/gtest.h>
+
+#include "../../Spf Wrapper/instance_store.h"
+
+#include "common.h"
+
+using namespace spf;
+
+namespace {
+
+const char * SPATIAL_STRUCTURE =
+	"#1=IFCBUILDINGSTOREY('s',$,'Ground',$,$,$,$,$,.ELEMENT.,0.);\n"
+	"#2=IFCWALL('w1',$,$,$,$,$,$,$);\n"
+	"#3=IFCWALL('w2',$,$,$,$,$,$,$);\n"
+	"#4=IFCRELCONTAINEDINSPATIALSTRUCTURE('r',$,$,$,(#2,#3),#1);\n";
+
+std::vector<entity_id> references(const value & list) {
+	std::vector<entity_id> res;
+	for (auto v = list.items.begin(); v != list.items.end(); ++v) { res.push_back(v->ref); }
+	return res;
+}
+
+std::vector<double> direction_ratios(instance_store * store, const value & direction) {
+	value ratios;
+	EXPECT_TRUE(store->field(direction.ref, "DirectionRatios", &ratios));
+	std::vector<double> res;
+	for (auto r = ratios.items.begin(); r != ratios.items.end(); ++r) { res.push_back(r->number); }
+	return res;
+}
+
+TEST(InstanceStoreFields, ExplicitAttributesByName) {
+	temp_file t(ifc_file(SPATIAL_STRUCTURE));
+	instance_store store;
+	store.open(t.path());
+	value v;
+	ASSERT_TRUE(store.field(1, "LongName", &v));
+	EXPECT_EQ(value::UNSET, v.kind);
+	ASSERT_TRUE(store.field(1, "CompositionType", &v));
+	EXPECT_EQ("ELEMENT", v.text);
+	EXPECT_FALSE(store.field(1, "NoSuchAttribute", &v));
+	EXPECT_EQ(schema::ifc2x3().find("IfcWall"), store.type_of(2));
+}
+
+TEST(InstanceStoreFields, DerivedPlacementAxes) {
+	temp_file t(ifc_file(
+		"#1=IFCCARTESIANPOINT((0.,0.,0.));\n"
+		"#2=IFCDIRECTION((0.,0.,1.));\n"
+		"#3=IFCDIRECTION((0.,2.,0.));\n"
+		"#4=IFCAXIS2PLACEMENT3D(#1,#2,#3);\n"));
+	instance_store store;
+	store.open(t.path());
+	value p;
+	ASSERT_TRUE(store.field(4, "P", &p));
+	ASSERT_EQ(3, p.items.size());
+	EXPECT_EQ(std::vector<double>({ 0, 1, 0 }), direction_ratios(&store, p.items[0]));
+	EXPECT_EQ(std::vector<double>({ -1, 0, 0 }), direction_ratios(&store, p.items[1]));
+	EXPECT_EQ(std::vector<double>({ 0, 0, 1 }), direction_ratios(&store, p.items[2]));
+}
+
+TEST(InstanceStoreFields, DerivedDirectionsDroppedWhenAttributesChange) {
+	temp_file t(ifc_file(
+		"#1=IFCCARTESIANPOINT((0.,0.,0.));\n"
+		"#2=IFCDIRECTION((0.,0.,1.));\n"
+		"#3=IFCDIRECTION((0.,2.,0.));\n"
+		"#4=IFCAXIS2PLACEMENT3D(#1,#2,#3);\n"));
+	instance_store store;
+	store.open(t.path());
+	value p;
+	ASSERT_TRUE(store.field(4, "P", &p));
+	ASSERT_EQ(3, p.items.size());
+	entity_id made_up = p.items[0].ref;
+	ASSERT_TRUE(store.get(made_up));
+	value x(value::LIST);
+	x.items.push_back(value::make_real(1.0));
+	x.items.push_back(value::make_real(0.0));
+	x.items.push_back(value::make_real(0.0));
+	ASSERT_TRUE(store.set_field(3, "DirectionRatios", x));
+	EXPECT_FALSE(store.get(made_up));
+	ASSERT_TRUE(store.field(4, "P", &p));
+	EXPECT_EQ(std::vector<double>({ 1, 0, 0 }), direction_ratios(&store, p.items[0]));
+}
+
+TEST(InstanceStoreFields, InverseAttributes) {
+	temp_file t(ifc_file(SPATIAL_STRUCTURE));
+	instance_store store;
+	store.open(t.path());
+	value v;
+	ASSERT_TRUE(store.field(1, "ContainsElements", &v));
+	EXPECT_EQ(std::vector<entity_id>(1, 4), references(v));
+	ASSERT_TRUE(store.field(3, "ContainedInStructure", &v));
+	EXPECT_EQ(std::vector<entity_id>(1, 4), references(v));
+
+	value related(value::LIST);
+	related.items.push_back(value::make_reference(2));
+	ASSERT_TRUE(store.set_field(4, "RelatedElements", related));
+	ASSERT_TRUE(store.field(3, "ContainedInStructure", &v));
+	EXPECT_TRUE(v.items.empty());
+	ASSERT_TRUE(store.field(2, "ContainedInStructure", &v));
+	EXPECT_EQ(std::vector<entity_id>(1, 4), references(v));
+}
+
+TEST(InstanceStoreCache, StaysBounded) {
+	std::string data;
+	for (int i = 1; i <= 100; ++i) { data += "#" + std::to_string(i) + "=IFCWALL('w',$,$,$,$,$,$,$);\n"; }
+	temp_file t(ifc_file(data));
+	instance_store store(8);
+	store.open(t.path());
+	ASSERT_TRUE(store.set_field(1, "Name", value::make_string("changed")));
+	for (entity_id id = 1; id <= 100; ++id) {
+		ASSERT_TRUE(store.get(id));
+		EXPECT_LE(store.cached_count(), 8);
+	}
+	value v;
+	ASSERT_TRUE(store.field(1, "Name", &v));
+	EXPECT_EQ("changed", v.text);
+	ASSERT_TRUE(store.field(2, "GlobalId", &v));
+	EXPECT_EQ("w", v.text);
+}
+
+TEST(InstanceStoreCache, InstancesInUseSurviveEviction) {
+	std::string data;
+	for (int i = 1; i <= 10; ++i) { data += "#" + std::to_string(i) + "=IFCWALL('w',$,$,$,$,$,$,$);\n"; }
+	temp_file t(ifc_file(data));
+	instance_store store(2);
+	store.open(t.path());
+	std::shared_ptr<const instance> first = store.get(1);
+	for (entity_id id = 2; id <= 10; ++id) { store.get(id); }
+	EXPECT_EQ("w", first->attributes[0].text);
+}
+
+TEST(InstanceStoreWrite, UnchangedFileRoundTripsExactly) {
+	std::string contents = ifc_file(
+		"/* comment */\n"
+		"#1=IFCBUILDINGSTOREY('s',$,'\\X2\\00E4\\X0\\ ''x''',$,$,$,$,$,.ELEMENT.,0.);\n"
+		"#2  =  IFCWALL ( 'w1' , $,$,$,$,$,$,$ ) ;\n"
+		"#3=(IFCCONVERSIONBASEDUNIT(#2,.LENGTHUNIT.,'FOOT',#3)IFCNAMEDUNIT(*,.LENGTHUNIT.));\n"
+		"#4=IFCPROPERTYSINGLEVALUE('Width',$,IFCLENGTHMEASURE(1.5E-3),$);\n");
+	temp_file in(contents);
+	temp_file out("");
+	instance_store store;
+	store.open(in.path());
+	value v;
+	ASSERT_TRUE(store.field(1, "Name", &v));
+	store.write(out.path());
+	EXPECT_EQ(contents, read_file(out.path()));
+}
+
+TEST(InstanceStoreWrite, OnlyChangedRecordsAreRewritten) {
+	temp_file in(ifc_file(SPATIAL_STRUCTURE));
+	temp_file out("");
+	instance_store store;
+	store.open(in.path());
+	ASSERT_TRUE(store.set_field(2, "Name", value::make_string("\xC3\xA4")));
+	entity_id created = store.clone(3);
+	store.remove(3);
+	store.write(out.path());
+	EXPECT_EQ(ifc_file(
+		"#1=IFCBUILDINGSTOREY('s',$,'Ground',$,$,$,$,$,.ELEMENT.,0.);\n"
+		"#2=IFCWALL('w1',$,'\\X2\\00E4\\X0\\',$,$,$,$,$);\n"
+		"#4=IFCRELCONTAINEDINSPATIALSTRUCTURE('r',$,$,$,(#2,#3),#1);\n"
+		"#" + std::to_string(created) + "=IFCWALL('w2',$,$,$,$,$,$,$);\n"), read_file(out.path()));
+}
+
+#ifndef _WIN32
+TEST(InstanceStoreWrite, CanReplaceItsOwnInput) {
+	temp_file in(ifc_file(SPATIAL_STRUCTURE));
+	instance_store store;
+	store.open(in.path());
+	ASSERT_TRUE(store.set_field(2, "Name", value::make_string("x")));
+	store.write(in.path());
+	EXPECT_EQ(ifc_file(
+		"#1=IFCBUILDINGSTOREY('s',$,'Ground',$,$,$,$,$,.ELEMENT.,0.);\n"
+		"#2=IFCWALL('w1',$,'x',$,$,$,$,$);\n"
+		"#3=IFCWALL('w2',$,$,$,$,$,$,$);\n"
+		"#4=IFCRELCONTAINEDINSPATIALSTRUCTURE('r',$,$,$,(#2,#3),#1);\n"), read_file(in.path()));
+}
+
+TEST(InstanceStoreWrite, KeepsTheOutputIfItCantReplaceTheTarget) {
+	std::string contents = ifc_file(SPATIAL_STRUCTURE);
+	temp_file in(contents);
+	std::string target = std::string(in.path()) + ".dir";
+	ASSERT_EQ(0, mkdir(target.c_str(), 0700));
+	instance_store store;
+	store.open(in.path());
+	EXPECT_THROW(store.write(target), std::runtime_error);
+	EXPECT_EQ(contents, read_file((target + ".tmp").c_str()));
+	remove((target + ".tmp").c_str());
+	rmdir(target.c_str());
+}
+#endif
+
+TEST(InstanceStoreWrite, ThrowsIfNoFileIsOpen) {
+	temp_file out("");
+	instance_store store;
+	EXPECT_THROW(store.write(out.path()), std::runtime_error);
+}
+
+TEST(InstanceStoreWrite, ThrowsIfTheOutputCantBeWritten) {
+	temp_file in(ifc_file(SPATIAL_STRUCTURE));
+	instance_store store;
+	store.open(in.path());
+	EXPECT_THROW(store.write(std::string(in.path()) + ".missing/out.ifc"), std::runtime_error);
+}
+
+} // namespace
@@ -0,0 +1,176 @@
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "../../Spf Wrapper/spf_file.h"
+
+#include "common.h"
+
+using namespace spf;
+
+namespace {
+
+// Everything the index (and parsing through it) says about the file.
+std::string describe(const file & f) {
+	std::string res;
+	f.for_each_id([&f, &res](entity_id id) {
+		instance inst = f.parse(id);
+		value params(value::LIST);
+		params.items = inst.attributes;
+		res += "#" + std::to_string(id) + "=" + (inst.type ? inst.type->name() : "?");
+		params.write(&res);
+		res += "\n";
+	});
+	const entity_type * rel = schema::ifc2x3().find("IfcRelContainedInSpatialStructure");
+	const file::reference_index * refs = f.relationship_references(rel->index(), rel->attribute_index("RelatedElements"));
+	std::vector<std::pair<entity_id, entity_id>> sorted(refs->begin(), refs->end());
+	std::sort(sorted.begin(), sorted.end());
+	for (auto r = sorted.begin(); r != sorted.end(); ++r) {
+		res += std::to_string(r->first) + "<-" + std::to_string(r->second) + "\n";
+	}
+	return res;
+}
+
+instance parse_one(const std::string & record) {
+	temp_file t(ifc_file(record + "\n"));
+	file f(t.path());
+	return f.parse(1);
+}
+
+TEST(SpfStrings, DoubledQuotesAndBackslashes) {
+	instance inst = parse_one("#1=IFCWALL('it''s',$,'a\\\\b',$,$,$,$,$);");
+	ASSERT_EQ(8, inst.attributes.size());
+	EXPECT_EQ(value::STRING, inst.attributes[0].kind);
+	EXPECT_EQ("it's", inst.attributes[0].text);
+	EXPECT_EQ("a\\b", inst.attributes[2].text);
+}
+
+TEST(SpfStrings, EncodedCharactersComeBackAsUtf8) {
+	instance inst = parse_one(
+		"#1=IFCWALL('\\X2\\00E400F6\\X0\\',$,'x\\X\\E9y','\\S\\D',"
+		"'\\X4\\0001F600\\X0\\','\\X2\\D83DDE00\\X0\\','\\PA\\z',$);");
+	ASSERT_EQ(8, inst.attributes.size());
+	EXPECT_EQ("\xC3\xA4\xC3\xB6", inst.attributes[0].text);
+	EXPECT_EQ("x\xC3\xA9y", inst.attributes[2].text);
+	EXPECT_EQ("\xC3\x84", inst.attributes[3].text);
+	EXPECT_EQ("\xF0\x9F\x98\x80", inst.attributes[4].text);
+	EXPECT_EQ("\xF0\x9F\x98\x80", inst.attributes[5].text);
+	EXPECT_EQ("z", inst.attributes[6].text);
+}
+
+TEST(SpfStrings, UnknownEscapesAreKept) {
+	instance inst = parse_one("#1=IFCWALL('C:\\temp',$,$,$,$,$,$,$);");
+	EXPECT_EQ("C:\\temp", inst.attributes[0].text);
+}
+
+TEST(SpfStrings, WrittenWithEscapes) {
+	std::string out;
+	value::make_string("it's \xC3\xA4\\").write(&out);
+	EXPECT_EQ("'it''s \\X2\\00E4\\X0\\\\\\'", out);
+	out.clear();
+	value::make_string("\xF0\x9F\x98\x80").write(&out);
+	EXPECT_EQ("'\\X4\\0001F600\\X0\\'", out);
+}
+
+TEST(SpfStrings, WrittenStringsParseBack) {
+	std::string text = "a''b \xC3\xA4\xC3\xB6 \\X2\\ \xF0\x9F\x98\x80";
+	std::string record = "#1=IFCWALL(";
+	value::make_string(text).write(&record);
+	instance inst = parse_one(record + ",$,$,$,$,$,$,$);");
+	EXPECT_EQ(text, inst.attributes[0].text);
+}
+
+TEST(SpfSyntax, CommentsAreSkipped) {
+	temp_file t(ifc_file(
+		"/* a comment; with 'a quote */\n"
+		"#1=IFCWALL(/* inside */'a',$,'/* not a comment */',$,$,$,$,$);\n"
+		"#2=/* between */IFCWALL('b',$,$,$,$,$,$,$);\n"));
+	file f(t.path());
+	EXPECT_EQ(2, f.instance_count());
+	instance a = f.parse(1);
+	EXPECT_EQ("a", a.attributes[0].text);
+	EXPECT_EQ("/* not a comment */", a.attributes[2].text);
+	ASSERT_TRUE(f.parse(2).type);
+	EXPECT_EQ("IfcWall", f.parse(2).type->name());
+}
+
+TEST(SpfSyntax, UnsetAndDerived) {
+	instance inst = parse_one("#1=IFCSIUNIT(*,.LENGTHUNIT.,$,.METRE.);");
+	ASSERT_EQ(4, inst.attributes.size());
+	EXPECT_EQ(value::DERIVED, inst.attributes[0].kind);
+	EXPECT_EQ(value::UNSET, inst.attributes[2].kind);
+}
+
+TEST(SpfSyntax, TypedAndEnumerationValues) {
+	instance inst = parse_one("#1=IFCPROPERTYSINGLEVALUE('Width',$,IFCLENGTHMEASURE(1.5),.T.);");
+	ASSERT_EQ(4, inst.attributes.size());
+	const value & typed = inst.attributes[2];
+	EXPECT_EQ(value::TYPED, typed.kind);
+	EXPECT_EQ("IFCLENGTHMEASURE", typed.text);
+	EXPECT_EQ(value::REAL, typed.untyped().kind);
+	EXPECT_DOUBLE_EQ(1.5, typed.untyped().number);
+	EXPECT_EQ(value::ENUMERATION, inst.attributes[3].kind);
+	EXPECT_EQ("T", inst.attributes[3].text);
+}
+
+TEST(SpfSyntax, ComplexInstancesAreIndexedButNotParsed) {
+	temp_file t(ifc_file(
+		"#1=(IFCCONVERSIONBASEDUNIT(#2,.LENGTHUNIT.,'FOOT',#3)IFCNAMEDUNIT(*,.LENGTHUNIT.));\n"
+		"#2=IFCWALL('a',$,$,$,$,$,$,$);\n"));
+	file f(t.path());
+	EXPECT_TRUE(f.contains(1));
+	EXPECT_EQ(schema::NO_TYPE, f.type_index(1));
+	instance inst = f.parse(1);
+	EXPECT_FALSE(inst.type);
+	EXPECT_TRUE(inst.attributes.empty());
+	EXPECT_TRUE(f.parse(2).type);
+}
+
+TEST(SpfIndex, SparseIds) {
+	temp_file t(ifc_file(
+		"#4000000000=IFCWALL('c',$,$,$,$,$,$,$);\n"
+		"#7=IFCWALL('b',$,$,$,$,$,$,$);\n"
+		"#2=IFCSLAB('a',$,$,$,$,$,$,$,$);\n"));
+	file f(t.path());
+	EXPECT_EQ(4000000000u, f.max_id());
+	EXPECT_EQ(3, f.instance_count());
+	EXPECT_FALSE(f.contains(3));
+	EXPECT_FALSE(f.contains(4000000001u));
+	EXPECT_EQ(schema::ifc2x3().find("IfcSlab")->index(), f.type_index(2));
+	EXPECT_EQ("c", f.parse(4000000000u).attributes[0].text);
+	std::vector<entity_id> ids;
+	f.for_each_id([&ids](entity_id id) { ids.push_back(id); });
+	ASSERT_EQ(3, ids.size());
+	EXPECT_EQ(2, ids[0]);
+	EXPECT_EQ(7, ids[1]);
+	EXPECT_EQ(4000000000u, ids[2]);
+}
+
+TEST(SpfIndex, ChunkedIndexMatchesSerialIndex) {
+	// The chunk boundaries are guessed by looking for lines that start like
+	// records, so put some inside a string and a comment where the guesses
+	// will find them.
+	std::string data = "#1=IFCBUILDINGSTOREY('s',$,'" + std::string(2000, 'x') + "\n#123=IFCWALL(''fake'',$,$,$,$,$,$,$);\n" + std::string(2000, 'x') + "',$,$,$,$,$,.ELEMENT.,0.);\n";
+	for (int i = 2; i < 40; ++i) { data += "#" + std::to_string(i) + "=IFCWALL('w',$,$,$,$,$,$,$);\n"; }
+	data += "/* " + std::string(2000, 'y') + "\n#124=IFCWALL('fake',$,$,$,$,$,$,$);\n" + std::string(2000, 'y') + " */\n";
+	data += "#40=IFCRELCONTAINEDINSPATIALSTRUCTURE('r',$,$,$,(#2,#3,#39),#1);\n";
+	for (int i = 41; i < 80; ++i) { data += "#" + std::to_string(i) + "=IFCSLAB('s',$,$,$,$,$,$,$,$);\n"; }
+	temp_file t(ifc_file(data));
+
+	file serial(t.path(), 1);
+	EXPECT_FALSE(serial.contains(123));
+	EXPECT_FALSE(serial.contains(124));
+	EXPECT_EQ(79, serial.instance_count());
+	std::string expected = describe(serial);
+	for (size_t chunks = 2; chunks <= 32; ++chunks) {
+		file chunked(t.path(), chunks);
+		EXPECT_EQ(serial.instance_count(), chunked.instance_count()) << chunks << " chunks";
+		EXPECT_EQ(serial.max_id(), chunked.max_id()) << chunks << " chunks";
+		EXPECT_EQ(expected, describe(chunked)) << chunks << " chunks";
+		EXPECT_EQ(serial.data_end() - serial.begin(), chunked.data_end() - chunked.begin()) << chunks << " chunks";
+	}
+}
+
+} // namespace
@@ -0,0 +1,102 @@
+# Generates ifc2x3_schema.cpp, the entity table the SPF wrapper reads IFC
+# files with, from the EXPRESS schema:
+#
+#   python generate_schema.py ../../res/IFC2X3_final.exp ifc2x3_schema.cpp
+#
+# Only what the wrapper needs is extracted: each entity's supertype, its
+# explicit attributes (in order, and whether each is an enumeration), its
+# inverse attributes, and the names of its derived attributes (including
+# explicit attributes of supertypes that it redeclares as derived).
+
+import re
+import sys
+
+SECTION_KEYWORDS = ('INVERSE', 'DERIVE', 'WHERE', 'UNIQUE')
+
+
+def statements(text):
+    # EXPRESS statements end with semicolons; the schema has no string
+    # literals with semicolons in the parts we look at.
+    return [s.strip() for s in text.split(';')]
+
+
+def parse(path):
+    with open(path) as f:
+        text = re.sub(r'\(\*.*?\*\)', '', f.read(), flags=re.S)
+
+    enumerations = set(re.findall(r'TYPE\s+(\w+)\s*=\s*ENUMERATION', text))
+    entities = []
+    for m in re.finditer(r'ENTITY\s+(\w+)(.*?)END_ENTITY;', text, re.S):
+        name, body = m.group(1), m.group(2)
+        entity = {'name': name, 'supertype': None, 'attributes': [], 'inverses': [], 'derived': []}
+        section = 'EXPLICIT'
+        for stmt in statements(body):
+            stmt = ' '.join(stmt.split())
+            for keyword in SECTION_KEYWORDS:
+                if stmt.startswith(keyword + ' ') or stmt == keyword:
+                    section = keyword
+                    stmt = stmt[len(keyword):].strip()
+            if not stmt:
+                continue
+            sub = re.search(r'SUBTYPE OF \((\w+)\)', stmt)
+            if sub:
+                entity['supertype'] = sub.group(1)
+                continue
+            if 'SUPERTYPE OF' in stmt or ':' not in stmt:
+                continue
+            lhs, rhs = [s.strip() for s in stmt.split(':', 1)]
+            if section == 'EXPLICIT':
+                if lhs.startswith('SELF\\'):
+                    continue
+                type_name = rhs.replace('OPTIONAL', '').strip()
+                for attr in [a.strip() for a in lhs.split(',')]:
+                    entity['attributes'].append((attr, type_name in enumerations))
+            elif section == 'INVERSE':
+                inv = re.match(r'(?:(?:SET|BAG) \[[^\]]*\] OF )?(\w+) FOR (\w+)', rhs)
+                entity['inverses'].append((lhs, inv.group(1), inv.group(2)))
+            elif section == 'DERIVE':
+                entity['derived'].append(lhs.split('.')[-1])
+        entities.append(entity)
+    return entities
+
+
+def emit(entities, out):
+    out.write('// Generated from IFC2X3_final.exp by generate_schema.py. Don\'t edit it by\n')
+    out.write('// hand; rerun the script instead.\n\n')
+    out.write('#include "schema.h"\n\nnamespace spf {\n\nnamespace {\n\n')
+    for e in entities:
+        if e['attributes']:
+            out.write('const attribute_definition %s_attributes[] = {\n' % e['name'])
+            for name, is_enum in e['attributes']:
+                out.write('\t{ "%s", %s },\n' % (name, 'true' if is_enum else 'false'))
+            out.write('};\n')
+        if e['inverses']:
+            out.write('const inverse_definition %s_inverses[] = {\n' % e['name'])
+            for name, entity, attr in e['inverses']:
+                out.write('\t{ "%s", "%s", "%s" },\n' % (name, entity, attr))
+            out.write('};\n')
+        if e['derived']:
+            out.write('const char * const %s_derived[] = { %s };\n' % (
+                e['name'], ', '.join('"%s"' % d for d in e['derived'])))
+    out.write('\nconst entity_definition ifc2x3_entities[] = {\n')
+    for e in entities:
+        def table(kind, items):
+            if not items:
+                return 'nullptr, 0'
+            return '%s_%s, %d' % (e['name'], kind, len(items))
+        out.write('\t{ "%s", %s, %s, %s, %s },\n' % (
+            e['name'],
+            '"%s"' % e['supertype'] if e['supertype'] else 'nullptr',
+            table('attributes', e['attributes']),
+            table('inverses', e['inverses']),
+            table('derived', e['derived'])))
+    out.write('};\n\n} // namespace\n\n')
+    out.write('const entity_definition * ifc2x3_entity_definitions() { return ifc2x3_entities; }\n')
+    out.write('size_t ifc2x3_entity_definition_count() { return sizeof(ifc2x3_entities) / sizeof(ifc2x3_entities[0]); }\n\n')
+    out.write('} // namespace spf\n')
+
+
+if __name__ == '__main__':
+    entities = parse(sys.argv[1])
+    with open(sys.argv[2], 'w') as out:
+        emit(entities, out)
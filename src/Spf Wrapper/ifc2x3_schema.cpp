@@ -0,0 +1,3275 @@
+// Generated from IFC2X3_final.exp by generate_schema.py. Don't edit it by
+// hand; rerun the script instead.
+
+#include "schema.h"
+
+namespace spf {
+
+namespace {
+
+const attribute_definition IfcActionRequest_attributes[] = {
+	{ "RequestID", false },
+};
+const attribute_definition IfcActor_attributes[] = {
+	{ "TheActor", false },
+};
+const inverse_definition IfcActor_inverses[] = {
+	{ "IsActingUpon", "IfcRelAssignsToActor", "RelatingActor" },
+};
+const attribute_definition IfcActorRole_attributes[] = {
+	{ "Role", true },
+	{ "UserDefinedRole", false },
+	{ "Description", false },
+};
+const attribute_definition IfcActuatorType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcAddress_attributes[] = {
+	{ "Purpose", true },
+	{ "Description", false },
+	{ "UserDefinedPurpose", false },
+};
+const inverse_definition IfcAddress_inverses[] = {
+	{ "OfPerson", "IfcPerson", "Addresses" },
+	{ "OfOrganization", "IfcOrganization", "Addresses" },
+};
+const attribute_definition IfcAirTerminalBoxType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcAirTerminalType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcAirToAirHeatRecoveryType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcAlarmType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const inverse_definition IfcAnnotation_inverses[] = {
+	{ "ContainedInStructure", "IfcRelContainedInSpatialStructure", "RelatedElements" },
+};
+const attribute_definition IfcAnnotationFillArea_attributes[] = {
+	{ "OuterBoundary", false },
+	{ "InnerBoundaries", false },
+};
+const attribute_definition IfcAnnotationFillAreaOccurrence_attributes[] = {
+	{ "FillStyleTarget", false },
+	{ "GlobalOrLocal", true },
+};
+const attribute_definition IfcAnnotationSurface_attributes[] = {
+	{ "Item", false },
+	{ "TextureCoordinates", false },
+};
+const attribute_definition IfcApplication_attributes[] = {
+	{ "ApplicationDeveloper", false },
+	{ "Version", false },
+	{ "ApplicationFullName", false },
+	{ "ApplicationIdentifier", false },
+};
+const attribute_definition IfcAppliedValue_attributes[] = {
+	{ "Name", false },
+	{ "Description", false },
+	{ "AppliedValue", false },
+	{ "UnitBasis", false },
+	{ "ApplicableDate", false },
+	{ "FixedUntilDate", false },
+};
+const inverse_definition IfcAppliedValue_inverses[] = {
+	{ "ValuesReferenced", "IfcReferencesValueDocument", "ReferencingValues" },
+	{ "ValueOfComponents", "IfcAppliedValueRelationship", "ComponentOfTotal" },
+	{ "IsComponentIn", "IfcAppliedValueRelationship", "Components" },
+};
+const attribute_definition IfcAppliedValueRelationship_attributes[] = {
+	{ "ComponentOfTotal", false },
+	{ "Components", false },
+	{ "ArithmeticOperator", true },
+	{ "Name", false },
+	{ "Description", false },
+};
+const attribute_definition IfcApproval_attributes[] = {
+	{ "Description", false },
+	{ "ApprovalDateTime", false },
+	{ "ApprovalStatus", false },
+	{ "ApprovalLevel", false },
+	{ "ApprovalQualifier", false },
+	{ "Name", false },
+	{ "Identifier", false },
+};
+const inverse_definition IfcApproval_inverses[] = {
+	{ "Actors", "IfcApprovalActorRelationship", "Approval" },
+	{ "IsRelatedWith", "IfcApprovalRelationship", "RelatedApproval" },
+	{ "Relates", "IfcApprovalRelationship", "RelatingApproval" },
+};
+const attribute_definition IfcApprovalActorRelationship_attributes[] = {
+	{ "Actor", false },
+	{ "Approval", false },
+	{ "Role", false },
+};
+const attribute_definition IfcApprovalPropertyRelationship_attributes[] = {
+	{ "ApprovedProperties", false },
+	{ "Approval", false },
+};
+const attribute_definition IfcApprovalRelationship_attributes[] = {
+	{ "RelatedApproval", false },
+	{ "RelatingApproval", false },
+	{ "Description", false },
+	{ "Name", false },
+};
+const attribute_definition IfcArbitraryClosedProfileDef_attributes[] = {
+	{ "OuterCurve", false },
+};
+const attribute_definition IfcArbitraryOpenProfileDef_attributes[] = {
+	{ "Curve", false },
+};
+const attribute_definition IfcArbitraryProfileDefWithVoids_attributes[] = {
+	{ "InnerCurves", false },
+};
+const attribute_definition IfcAsset_attributes[] = {
+	{ "AssetID", false },
+	{ "OriginalValue", false },
+	{ "CurrentValue", false },
+	{ "TotalReplacementCost", false },
+	{ "Owner", false },
+	{ "User", false },
+	{ "ResponsiblePerson", false },
+	{ "IncorporationDate", false },
+	{ "DepreciatedValue", false },
+};
+const attribute_definition IfcAsymmetricIShapeProfileDef_attributes[] = {
+	{ "TopFlangeWidth", false },
+	{ "TopFlangeThickness", false },
+	{ "TopFlangeFilletRadius", false },
+	{ "CentreOfGravityInY", false },
+};
+const attribute_definition IfcAxis1Placement_attributes[] = {
+	{ "Axis", false },
+};
+const char * const IfcAxis1Placement_derived[] = { "Z" };
+const attribute_definition IfcAxis2Placement2D_attributes[] = {
+	{ "RefDirection", false },
+};
+const char * const IfcAxis2Placement2D_derived[] = { "P" };
+const attribute_definition IfcAxis2Placement3D_attributes[] = {
+	{ "Axis", false },
+	{ "RefDirection", false },
+};
+const char * const IfcAxis2Placement3D_derived[] = { "P" };
+const attribute_definition IfcBSplineCurve_attributes[] = {
+	{ "Degree", false },
+	{ "ControlPointsList", false },
+	{ "CurveForm", true },
+	{ "ClosedCurve", false },
+	{ "SelfIntersect", false },
+};
+const char * const IfcBSplineCurve_derived[] = { "ControlPoints", "UpperIndexOnControlPoints" };
+const attribute_definition IfcBeamType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcBlobTexture_attributes[] = {
+	{ "RasterFormat", false },
+	{ "RasterCode", false },
+};
+const attribute_definition IfcBlock_attributes[] = {
+	{ "XLength", false },
+	{ "YLength", false },
+	{ "ZLength", false },
+};
+const attribute_definition IfcBoilerType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcBooleanResult_attributes[] = {
+	{ "Operator", true },
+	{ "FirstOperand", false },
+	{ "SecondOperand", false },
+};
+const char * const IfcBooleanResult_derived[] = { "Dim" };
+const attribute_definition IfcBoundaryCondition_attributes[] = {
+	{ "Name", false },
+};
+const attribute_definition IfcBoundaryEdgeCondition_attributes[] = {
+	{ "LinearStiffnessByLengthX", false },
+	{ "LinearStiffnessByLengthY", false },
+	{ "LinearStiffnessByLengthZ", false },
+	{ "RotationalStiffnessByLengthX", false },
+	{ "RotationalStiffnessByLengthY", false },
+	{ "RotationalStiffnessByLengthZ", false },
+};
+const attribute_definition IfcBoundaryFaceCondition_attributes[] = {
+	{ "LinearStiffnessByAreaX", false },
+	{ "LinearStiffnessByAreaY", false },
+	{ "LinearStiffnessByAreaZ", false },
+};
+const attribute_definition IfcBoundaryNodeCondition_attributes[] = {
+	{ "LinearStiffnessX", false },
+	{ "LinearStiffnessY", false },
+	{ "LinearStiffnessZ", false },
+	{ "RotationalStiffnessX", false },
+	{ "RotationalStiffnessY", false },
+	{ "RotationalStiffnessZ", false },
+};
+const attribute_definition IfcBoundaryNodeConditionWarping_attributes[] = {
+	{ "WarpingStiffness", false },
+};
+const attribute_definition IfcBoundingBox_attributes[] = {
+	{ "Corner", false },
+	{ "XDim", false },
+	{ "YDim", false },
+	{ "ZDim", false },
+};
+const char * const IfcBoundingBox_derived[] = { "Dim" };
+const attribute_definition IfcBoxedHalfSpace_attributes[] = {
+	{ "Enclosure", false },
+};
+const attribute_definition IfcBuilding_attributes[] = {
+	{ "ElevationOfRefHeight", false },
+	{ "ElevationOfTerrain", false },
+	{ "BuildingAddress", false },
+};
+const attribute_definition IfcBuildingElementProxy_attributes[] = {
+	{ "CompositionType", true },
+};
+const attribute_definition IfcBuildingElementProxyType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcBuildingStorey_attributes[] = {
+	{ "Elevation", false },
+};
+const attribute_definition IfcCShapeProfileDef_attributes[] = {
+	{ "Depth", false },
+	{ "Width", false },
+	{ "WallThickness", false },
+	{ "Girth", false },
+	{ "InternalFilletRadius", false },
+	{ "CentreOfGravityInX", false },
+};
+const attribute_definition IfcCableCarrierFittingType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcCableCarrierSegmentType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcCableSegmentType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcCalendarDate_attributes[] = {
+	{ "DayComponent", false },
+	{ "MonthComponent", false },
+	{ "YearComponent", false },
+};
+const attribute_definition IfcCartesianPoint_attributes[] = {
+	{ "Coordinates", false },
+};
+const char * const IfcCartesianPoint_derived[] = { "Dim" };
+const attribute_definition IfcCartesianTransformationOperator_attributes[] = {
+	{ "Axis1", false },
+	{ "Axis2", false },
+	{ "LocalOrigin", false },
+	{ "Scale", false },
+};
+const char * const IfcCartesianTransformationOperator_derived[] = { "Scl", "Dim" };
+const char * const IfcCartesianTransformationOperator2D_derived[] = { "U" };
+const attribute_definition IfcCartesianTransformationOperator2DnonUniform_attributes[] = {
+	{ "Scale2", false },
+};
+const char * const IfcCartesianTransformationOperator2DnonUniform_derived[] = { "Scl2" };
+const attribute_definition IfcCartesianTransformationOperator3D_attributes[] = {
+	{ "Axis3", false },
+};
+const char * const IfcCartesianTransformationOperator3D_derived[] = { "U" };
+const attribute_definition IfcCartesianTransformationOperator3DnonUniform_attributes[] = {
+	{ "Scale2", false },
+	{ "Scale3", false },
+};
+const char * const IfcCartesianTransformationOperator3DnonUniform_derived[] = { "Scl2", "Scl3" };
+const attribute_definition IfcCenterLineProfileDef_attributes[] = {
+	{ "Thickness", false },
+};
+const attribute_definition IfcChamferEdgeFeature_attributes[] = {
+	{ "Width", false },
+	{ "Height", false },
+};
+const attribute_definition IfcChillerType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcCircle_attributes[] = {
+	{ "Radius", false },
+};
+const attribute_definition IfcCircleHollowProfileDef_attributes[] = {
+	{ "WallThickness", false },
+};
+const attribute_definition IfcCircleProfileDef_attributes[] = {
+	{ "Radius", false },
+};
+const attribute_definition IfcClassification_attributes[] = {
+	{ "Source", false },
+	{ "Edition", false },
+	{ "EditionDate", false },
+	{ "Name", false },
+};
+const inverse_definition IfcClassification_inverses[] = {
+	{ "Contains", "IfcClassificationItem", "ItemOf" },
+};
+const attribute_definition IfcClassificationItem_attributes[] = {
+	{ "Notation", false },
+	{ "ItemOf", false },
+	{ "Title", false },
+};
+const inverse_definition IfcClassificationItem_inverses[] = {
+	{ "IsClassifiedItemIn", "IfcClassificationItemRelationship", "RelatedItems" },
+	{ "IsClassifyingItemIn", "IfcClassificationItemRelationship", "RelatingItem" },
+};
+const attribute_definition IfcClassificationItemRelationship_attributes[] = {
+	{ "RelatingItem", false },
+	{ "RelatedItems", false },
+};
+const attribute_definition IfcClassificationNotation_attributes[] = {
+	{ "NotationFacets", false },
+};
+const attribute_definition IfcClassificationNotationFacet_attributes[] = {
+	{ "NotationValue", false },
+};
+const attribute_definition IfcClassificationReference_attributes[] = {
+	{ "ReferencedSource", false },
+};
+const attribute_definition IfcCoilType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcColourRgb_attributes[] = {
+	{ "Red", false },
+	{ "Green", false },
+	{ "Blue", false },
+};
+const attribute_definition IfcColourSpecification_attributes[] = {
+	{ "Name", false },
+};
+const attribute_definition IfcColumnType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcComplexProperty_attributes[] = {
+	{ "UsageName", false },
+	{ "HasProperties", false },
+};
+const attribute_definition IfcCompositeCurve_attributes[] = {
+	{ "Segments", false },
+	{ "SelfIntersect", false },
+};
+const char * const IfcCompositeCurve_derived[] = { "NSegments", "ClosedCurve" };
+const attribute_definition IfcCompositeCurveSegment_attributes[] = {
+	{ "Transition", true },
+	{ "SameSense", false },
+	{ "ParentCurve", false },
+};
+const inverse_definition IfcCompositeCurveSegment_inverses[] = {
+	{ "UsingCurves", "IfcCompositeCurve", "Segments" },
+};
+const char * const IfcCompositeCurveSegment_derived[] = { "Dim" };
+const attribute_definition IfcCompositeProfileDef_attributes[] = {
+	{ "Profiles", false },
+	{ "Label", false },
+};
+const attribute_definition IfcCompressorType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcCondenserType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcConditionCriterion_attributes[] = {
+	{ "Criterion", false },
+	{ "CriterionDateTime", false },
+};
+const attribute_definition IfcConic_attributes[] = {
+	{ "Position", false },
+};
+const attribute_definition IfcConnectedFaceSet_attributes[] = {
+	{ "CfsFaces", false },
+};
+const attribute_definition IfcConnectionCurveGeometry_attributes[] = {
+	{ "CurveOnRelatingElement", false },
+	{ "CurveOnRelatedElement", false },
+};
+const attribute_definition IfcConnectionPointEccentricity_attributes[] = {
+	{ "EccentricityInX", false },
+	{ "EccentricityInY", false },
+	{ "EccentricityInZ", false },
+};
+const attribute_definition IfcConnectionPointGeometry_attributes[] = {
+	{ "PointOnRelatingElement", false },
+	{ "PointOnRelatedElement", false },
+};
+const attribute_definition IfcConnectionPortGeometry_attributes[] = {
+	{ "LocationAtRelatingElement", false },
+	{ "LocationAtRelatedElement", false },
+	{ "ProfileOfPort", false },
+};
+const attribute_definition IfcConnectionSurfaceGeometry_attributes[] = {
+	{ "SurfaceOnRelatingElement", false },
+	{ "SurfaceOnRelatedElement", false },
+};
+const attribute_definition IfcConstraint_attributes[] = {
+	{ "Name", false },
+	{ "Description", false },
+	{ "ConstraintGrade", true },
+	{ "ConstraintSource", false },
+	{ "CreatingActor", false },
+	{ "CreationTime", false },
+	{ "UserDefinedGrade", false },
+};
+const inverse_definition IfcConstraint_inverses[] = {
+	{ "ClassifiedAs", "IfcConstraintClassificationRelationship", "ClassifiedConstraint" },
+	{ "RelatesConstraints", "IfcConstraintRelationship", "RelatingConstraint" },
+	{ "IsRelatedWith", "IfcConstraintRelationship", "RelatedConstraints" },
+	{ "PropertiesForConstraint", "IfcPropertyConstraintRelationship", "RelatingConstraint" },
+	{ "Aggregates", "IfcConstraintAggregationRelationship", "RelatingConstraint" },
+	{ "IsAggregatedIn", "IfcConstraintAggregationRelationship", "RelatedConstraints" },
+};
+const attribute_definition IfcConstraintAggregationRelationship_attributes[] = {
+	{ "Name", false },
+	{ "Description", false },
+	{ "RelatingConstraint", false },
+	{ "RelatedConstraints", false },
+	{ "LogicalAggregator", true },
+};
+const attribute_definition IfcConstraintClassificationRelationship_attributes[] = {
+	{ "ClassifiedConstraint", false },
+	{ "RelatedClassifications", false },
+};
+const attribute_definition IfcConstraintRelationship_attributes[] = {
+	{ "Name", false },
+	{ "Description", false },
+	{ "RelatingConstraint", false },
+	{ "RelatedConstraints", false },
+};
+const attribute_definition IfcConstructionMaterialResource_attributes[] = {
+	{ "Suppliers", false },
+	{ "UsageRatio", false },
+};
+const attribute_definition IfcConstructionResource_attributes[] = {
+	{ "ResourceIdentifier", false },
+	{ "ResourceGroup", false },
+	{ "ResourceConsumption", true },
+	{ "BaseQuantity", false },
+};
+const attribute_definition IfcContextDependentUnit_attributes[] = {
+	{ "Name", false },
+};
+const inverse_definition IfcControl_inverses[] = {
+	{ "Controls", "IfcRelAssignsToControl", "RelatingControl" },
+};
+const attribute_definition IfcControllerType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcConversionBasedUnit_attributes[] = {
+	{ "Name", false },
+	{ "ConversionFactor", false },
+};
+const attribute_definition IfcCooledBeamType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcCoolingTowerType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcCoordinatedUniversalTimeOffset_attributes[] = {
+	{ "HourOffset", false },
+	{ "MinuteOffset", false },
+	{ "Sense", true },
+};
+const attribute_definition IfcCostSchedule_attributes[] = {
+	{ "SubmittedBy", false },
+	{ "PreparedBy", false },
+	{ "SubmittedOn", false },
+	{ "Status", false },
+	{ "TargetUsers", false },
+	{ "UpdateDate", false },
+	{ "ID", false },
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcCostValue_attributes[] = {
+	{ "CostType", false },
+	{ "Condition", false },
+};
+const attribute_definition IfcCovering_attributes[] = {
+	{ "PredefinedType", true },
+};
+const inverse_definition IfcCovering_inverses[] = {
+	{ "CoversSpaces", "IfcRelCoversSpaces", "RelatedCoverings" },
+	{ "Covers", "IfcRelCoversBldgElements", "RelatedCoverings" },
+};
+const attribute_definition IfcCoveringType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcCraneRailAShapeProfileDef_attributes[] = {
+	{ "OverallHeight", false },
+	{ "BaseWidth2", false },
+	{ "Radius", false },
+	{ "HeadWidth", false },
+	{ "HeadDepth2", false },
+	{ "HeadDepth3", false },
+	{ "WebThickness", false },
+	{ "BaseWidth4", false },
+	{ "BaseDepth1", false },
+	{ "BaseDepth2", false },
+	{ "BaseDepth3", false },
+	{ "CentreOfGravityInY", false },
+};
+const attribute_definition IfcCraneRailFShapeProfileDef_attributes[] = {
+	{ "OverallHeight", false },
+	{ "HeadWidth", false },
+	{ "Radius", false },
+	{ "HeadDepth2", false },
+	{ "HeadDepth3", false },
+	{ "WebThickness", false },
+	{ "BaseDepth1", false },
+	{ "BaseDepth2", false },
+	{ "CentreOfGravityInY", false },
+};
+const attribute_definition IfcCsgPrimitive3D_attributes[] = {
+	{ "Position", false },
+};
+const char * const IfcCsgPrimitive3D_derived[] = { "Dim" };
+const attribute_definition IfcCsgSolid_attributes[] = {
+	{ "TreeRootExpression", false },
+};
+const attribute_definition IfcCurrencyRelationship_attributes[] = {
+	{ "RelatingMonetaryUnit", false },
+	{ "RelatedMonetaryUnit", false },
+	{ "ExchangeRate", false },
+	{ "RateDateTime", false },
+	{ "RateSource", false },
+};
+const attribute_definition IfcCurtainWallType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const char * const IfcCurve_derived[] = { "Dim" };
+const attribute_definition IfcCurveBoundedPlane_attributes[] = {
+	{ "BasisSurface", false },
+	{ "OuterBoundary", false },
+	{ "InnerBoundaries", false },
+};
+const char * const IfcCurveBoundedPlane_derived[] = { "Dim" };
+const attribute_definition IfcCurveStyle_attributes[] = {
+	{ "CurveFont", false },
+	{ "CurveWidth", false },
+	{ "CurveColour", false },
+};
+const attribute_definition IfcCurveStyleFont_attributes[] = {
+	{ "Name", false },
+	{ "PatternList", false },
+};
+const attribute_definition IfcCurveStyleFontAndScaling_attributes[] = {
+	{ "Name", false },
+	{ "CurveFont", false },
+	{ "CurveFontScaling", false },
+};
+const attribute_definition IfcCurveStyleFontPattern_attributes[] = {
+	{ "VisibleSegmentLength", false },
+	{ "InvisibleSegmentLength", false },
+};
+const attribute_definition IfcDamperType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcDateAndTime_attributes[] = {
+	{ "DateComponent", false },
+	{ "TimeComponent", false },
+};
+const attribute_definition IfcDefinedSymbol_attributes[] = {
+	{ "Definition", false },
+	{ "Target", false },
+};
+const attribute_definition IfcDerivedProfileDef_attributes[] = {
+	{ "ParentProfile", false },
+	{ "Operator", false },
+	{ "Label", false },
+};
+const attribute_definition IfcDerivedUnit_attributes[] = {
+	{ "Elements", false },
+	{ "UnitType", true },
+	{ "UserDefinedType", false },
+};
+const char * const IfcDerivedUnit_derived[] = { "Dimensions" };
+const attribute_definition IfcDerivedUnitElement_attributes[] = {
+	{ "Unit", false },
+	{ "Exponent", false },
+};
+const inverse_definition IfcDimensionCurve_inverses[] = {
+	{ "AnnotatedBySymbols", "IfcTerminatorSymbol", "AnnotatedCurve" },
+};
+const attribute_definition IfcDimensionCurveTerminator_attributes[] = {
+	{ "Role", true },
+};
+const attribute_definition IfcDimensionalExponents_attributes[] = {
+	{ "LengthExponent", false },
+	{ "MassExponent", false },
+	{ "TimeExponent", false },
+	{ "ElectricCurrentExponent", false },
+	{ "ThermodynamicTemperatureExponent", false },
+	{ "AmountOfSubstanceExponent", false },
+	{ "LuminousIntensityExponent", false },
+};
+const attribute_definition IfcDirection_attributes[] = {
+	{ "DirectionRatios", false },
+};
+const char * const IfcDirection_derived[] = { "Dim" };
+const attribute_definition IfcDistributionChamberElementType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcDistributionControlElement_attributes[] = {
+	{ "ControlElementId", false },
+};
+const inverse_definition IfcDistributionControlElement_inverses[] = {
+	{ "AssignedToFlowElement", "IfcRelFlowControlElements", "RelatedControlElements" },
+};
+const inverse_definition IfcDistributionFlowElement_inverses[] = {
+	{ "HasControlElements", "IfcRelFlowControlElements", "RelatingFlowElement" },
+};
+const attribute_definition IfcDistributionPort_attributes[] = {
+	{ "FlowDirection", true },
+};
+const attribute_definition IfcDocumentElectronicFormat_attributes[] = {
+	{ "FileExtension", false },
+	{ "MimeContentType", false },
+	{ "MimeSubtype", false },
+};
+const attribute_definition IfcDocumentInformation_attributes[] = {
+	{ "DocumentId", false },
+	{ "Name", false },
+	{ "Description", false },
+	{ "DocumentReferences", false },
+	{ "Purpose", false },
+	{ "IntendedUse", false },
+	{ "Scope", false },
+	{ "Revision", false },
+	{ "DocumentOwner", false },
+	{ "Editors", false },
+	{ "CreationTime", false },
+	{ "LastRevisionTime", false },
+	{ "ElectronicFormat", false },
+	{ "ValidFrom", false },
+	{ "ValidUntil", false },
+	{ "Confidentiality", true },
+	{ "Status", true },
+};
+const inverse_definition IfcDocumentInformation_inverses[] = {
+	{ "IsPointedTo", "IfcDocumentInformationRelationship", "RelatedDocuments" },
+	{ "IsPointer", "IfcDocumentInformationRelationship", "RelatingDocument" },
+};
+const attribute_definition IfcDocumentInformationRelationship_attributes[] = {
+	{ "RelatingDocument", false },
+	{ "RelatedDocuments", false },
+	{ "RelationshipType", false },
+};
+const inverse_definition IfcDocumentReference_inverses[] = {
+	{ "ReferenceToDocument", "IfcDocumentInformation", "DocumentReferences" },
+};
+const attribute_definition IfcDoor_attributes[] = {
+	{ "OverallHeight", false },
+	{ "OverallWidth", false },
+};
+const attribute_definition IfcDoorLiningProperties_attributes[] = {
+	{ "LiningDepth", false },
+	{ "LiningThickness", false },
+	{ "ThresholdDepth", false },
+	{ "ThresholdThickness", false },
+	{ "TransomThickness", false },
+	{ "TransomOffset", false },
+	{ "LiningOffset", false },
+	{ "ThresholdOffset", false },
+	{ "CasingThickness", false },
+	{ "CasingDepth", false },
+	{ "ShapeAspectStyle", false },
+};
+const attribute_definition IfcDoorPanelProperties_attributes[] = {
+	{ "PanelDepth", false },
+	{ "PanelOperation", true },
+	{ "PanelWidth", false },
+	{ "PanelPosition", true },
+	{ "ShapeAspectStyle", false },
+};
+const attribute_definition IfcDoorStyle_attributes[] = {
+	{ "OperationType", true },
+	{ "ConstructionType", true },
+	{ "ParameterTakesPrecedence", false },
+	{ "Sizeable", false },
+};
+const attribute_definition IfcDraughtingCallout_attributes[] = {
+	{ "Contents", false },
+};
+const inverse_definition IfcDraughtingCallout_inverses[] = {
+	{ "IsRelatedFromCallout", "IfcDraughtingCalloutRelationship", "RelatedDraughtingCallout" },
+	{ "IsRelatedToCallout", "IfcDraughtingCalloutRelationship", "RelatingDraughtingCallout" },
+};
+const attribute_definition IfcDraughtingCalloutRelationship_attributes[] = {
+	{ "Name", false },
+	{ "Description", false },
+	{ "RelatingDraughtingCallout", false },
+	{ "RelatedDraughtingCallout", false },
+};
+const attribute_definition IfcDuctFittingType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcDuctSegmentType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcDuctSilencerType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcEdge_attributes[] = {
+	{ "EdgeStart", false },
+	{ "EdgeEnd", false },
+};
+const attribute_definition IfcEdgeCurve_attributes[] = {
+	{ "EdgeGeometry", false },
+	{ "SameSense", false },
+};
+const attribute_definition IfcEdgeFeature_attributes[] = {
+	{ "FeatureLength", false },
+};
+const attribute_definition IfcEdgeLoop_attributes[] = {
+	{ "EdgeList", false },
+};
+const char * const IfcEdgeLoop_derived[] = { "Ne" };
+const attribute_definition IfcElectricApplianceType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcElectricDistributionPoint_attributes[] = {
+	{ "DistributionPointFunction", true },
+	{ "UserDefinedFunction", false },
+};
+const attribute_definition IfcElectricFlowStorageDeviceType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcElectricGeneratorType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcElectricHeaterType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcElectricMotorType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcElectricTimeControlType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcElectricalBaseProperties_attributes[] = {
+	{ "ElectricCurrentType", true },
+	{ "InputVoltage", false },
+	{ "InputFrequency", false },
+	{ "FullLoadCurrent", false },
+	{ "MinimumCircuitCurrent", false },
+	{ "MaximumPowerInput", false },
+	{ "RatedPowerInput", false },
+	{ "InputPhase", false },
+};
+const attribute_definition IfcElement_attributes[] = {
+	{ "Tag", false },
+};
+const inverse_definition IfcElement_inverses[] = {
+	{ "FillsVoids", "IfcRelFillsElement", "RelatedBuildingElement" },
+	{ "ConnectedTo", "IfcRelConnectsElements", "RelatingElement" },
+	{ "HasCoverings", "IfcRelCoversBldgElements", "RelatingBuildingElement" },
+	{ "HasProjections", "IfcRelProjectsElement", "RelatingElement" },
+	{ "HasStructuralMember", "IfcRelConnectsStructuralElement", "RelatingElement" },
+	{ "ReferencedInStructures", "IfcRelReferencedInSpatialStructure", "RelatedElements" },
+	{ "HasPorts", "IfcRelConnectsPortToElement", "RelatedElement" },
+	{ "HasOpenings", "IfcRelVoidsElement", "RelatingBuildingElement" },
+	{ "IsConnectionRealization", "IfcRelConnectsWithRealizingElements", "RealizingElements" },
+	{ "ProvidesBoundaries", "IfcRelSpaceBoundary", "RelatedBuildingElement" },
+	{ "ConnectedFrom", "IfcRelConnectsElements", "RelatedElement" },
+	{ "ContainedInStructure", "IfcRelContainedInSpatialStructure", "RelatedElements" },
+};
+const attribute_definition IfcElementAssembly_attributes[] = {
+	{ "AssemblyPlace", true },
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcElementQuantity_attributes[] = {
+	{ "MethodOfMeasurement", false },
+	{ "Quantities", false },
+};
+const attribute_definition IfcElementType_attributes[] = {
+	{ "ElementType", false },
+};
+const attribute_definition IfcElementarySurface_attributes[] = {
+	{ "Position", false },
+};
+const char * const IfcElementarySurface_derived[] = { "Dim" };
+const attribute_definition IfcEllipse_attributes[] = {
+	{ "SemiAxis1", false },
+	{ "SemiAxis2", false },
+};
+const attribute_definition IfcEllipseProfileDef_attributes[] = {
+	{ "SemiAxis1", false },
+	{ "SemiAxis2", false },
+};
+const attribute_definition IfcEnergyProperties_attributes[] = {
+	{ "EnergySequence", true },
+	{ "UserDefinedEnergySequence", false },
+};
+const attribute_definition IfcEnvironmentalImpactValue_attributes[] = {
+	{ "ImpactType", false },
+	{ "Category", true },
+	{ "UserDefinedCategory", false },
+};
+const attribute_definition IfcEvaporativeCoolerType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcEvaporatorType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcExtendedMaterialProperties_attributes[] = {
+	{ "ExtendedProperties", false },
+	{ "Description", false },
+	{ "Name", false },
+};
+const attribute_definition IfcExternalReference_attributes[] = {
+	{ "Location", false },
+	{ "ItemReference", false },
+	{ "Name", false },
+};
+const attribute_definition IfcExtrudedAreaSolid_attributes[] = {
+	{ "ExtrudedDirection", false },
+	{ "Depth", false },
+};
+const attribute_definition IfcFace_attributes[] = {
+	{ "Bounds", false },
+};
+const attribute_definition IfcFaceBasedSurfaceModel_attributes[] = {
+	{ "FbsmFaces", false },
+};
+const char * const IfcFaceBasedSurfaceModel_derived[] = { "Dim" };
+const attribute_definition IfcFaceBound_attributes[] = {
+	{ "Bound", false },
+	{ "Orientation", false },
+};
+const attribute_definition IfcFaceSurface_attributes[] = {
+	{ "FaceSurface", false },
+	{ "SameSense", false },
+};
+const attribute_definition IfcFacetedBrepWithVoids_attributes[] = {
+	{ "Voids", false },
+};
+const attribute_definition IfcFailureConnectionCondition_attributes[] = {
+	{ "TensionFailureX", false },
+	{ "TensionFailureY", false },
+	{ "TensionFailureZ", false },
+	{ "CompressionFailureX", false },
+	{ "CompressionFailureY", false },
+	{ "CompressionFailureZ", false },
+};
+const attribute_definition IfcFanType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const inverse_definition IfcFeatureElementAddition_inverses[] = {
+	{ "ProjectsElements", "IfcRelProjectsElement", "RelatedFeatureElement" },
+};
+const inverse_definition IfcFeatureElementSubtraction_inverses[] = {
+	{ "VoidsElements", "IfcRelVoidsElement", "RelatedOpeningElement" },
+};
+const attribute_definition IfcFillAreaStyle_attributes[] = {
+	{ "FillStyles", false },
+};
+const attribute_definition IfcFillAreaStyleHatching_attributes[] = {
+	{ "HatchLineAppearance", false },
+	{ "StartOfNextHatchLine", false },
+	{ "PointOfReferenceHatchLine", false },
+	{ "PatternStart", false },
+	{ "HatchLineAngle", false },
+};
+const attribute_definition IfcFillAreaStyleTileSymbolWithStyle_attributes[] = {
+	{ "Symbol", false },
+};
+const attribute_definition IfcFillAreaStyleTiles_attributes[] = {
+	{ "TilingPattern", false },
+	{ "Tiles", false },
+	{ "TilingScale", false },
+};
+const attribute_definition IfcFilterType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcFireSuppressionTerminalType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcFlowInstrumentType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcFlowMeterType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcFluidFlowProperties_attributes[] = {
+	{ "PropertySource", true },
+	{ "FlowConditionTimeSeries", false },
+	{ "VelocityTimeSeries", false },
+	{ "FlowrateTimeSeries", false },
+	{ "Fluid", false },
+	{ "PressureTimeSeries", false },
+	{ "UserDefinedPropertySource", false },
+	{ "TemperatureSingleValue", false },
+	{ "WetBulbTemperatureSingleValue", false },
+	{ "WetBulbTemperatureTimeSeries", false },
+	{ "TemperatureTimeSeries", false },
+	{ "FlowrateSingleValue", false },
+	{ "FlowConditionSingleValue", false },
+	{ "VelocitySingleValue", false },
+	{ "PressureSingleValue", false },
+};
+const attribute_definition IfcFooting_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcFuelProperties_attributes[] = {
+	{ "CombustionTemperature", false },
+	{ "CarbonContent", false },
+	{ "LowerHeatingValue", false },
+	{ "HigherHeatingValue", false },
+};
+const attribute_definition IfcFurnitureType_attributes[] = {
+	{ "AssemblyPlace", true },
+};
+const attribute_definition IfcGasTerminalType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcGeneralMaterialProperties_attributes[] = {
+	{ "MolecularWeight", false },
+	{ "Porosity", false },
+	{ "MassDensity", false },
+};
+const attribute_definition IfcGeneralProfileProperties_attributes[] = {
+	{ "PhysicalWeight", false },
+	{ "Perimeter", false },
+	{ "MinimumPlateThickness", false },
+	{ "MaximumPlateThickness", false },
+	{ "CrossSectionArea", false },
+};
+const attribute_definition IfcGeometricRepresentationContext_attributes[] = {
+	{ "CoordinateSpaceDimension", false },
+	{ "Precision", false },
+	{ "WorldCoordinateSystem", false },
+	{ "TrueNorth", false },
+};
+const inverse_definition IfcGeometricRepresentationContext_inverses[] = {
+	{ "HasSubContexts", "IfcGeometricRepresentationSubContext", "ParentContext" },
+};
+const attribute_definition IfcGeometricRepresentationSubContext_attributes[] = {
+	{ "ParentContext", false },
+	{ "TargetScale", false },
+	{ "TargetView", true },
+	{ "UserDefinedTargetView", false },
+};
+const char * const IfcGeometricRepresentationSubContext_derived[] = { "WorldCoordinateSystem", "CoordinateSpaceDimension", "TrueNorth", "Precision" };
+const attribute_definition IfcGeometricSet_attributes[] = {
+	{ "Elements", false },
+};
+const char * const IfcGeometricSet_derived[] = { "Dim" };
+const attribute_definition IfcGrid_attributes[] = {
+	{ "UAxes", false },
+	{ "VAxes", false },
+	{ "WAxes", false },
+};
+const inverse_definition IfcGrid_inverses[] = {
+	{ "ContainedInStructure", "IfcRelContainedInSpatialStructure", "RelatedElements" },
+};
+const attribute_definition IfcGridAxis_attributes[] = {
+	{ "AxisTag", false },
+	{ "AxisCurve", false },
+	{ "SameSense", false },
+};
+const inverse_definition IfcGridAxis_inverses[] = {
+	{ "PartOfW", "IfcGrid", "WAxes" },
+	{ "PartOfV", "IfcGrid", "VAxes" },
+	{ "PartOfU", "IfcGrid", "UAxes" },
+	{ "HasIntersections", "IfcVirtualGridIntersection", "IntersectingAxes" },
+};
+const attribute_definition IfcGridPlacement_attributes[] = {
+	{ "PlacementLocation", false },
+	{ "PlacementRefDirection", false },
+};
+const inverse_definition IfcGroup_inverses[] = {
+	{ "IsGroupedBy", "IfcRelAssignsToGroup", "RelatingGroup" },
+};
+const attribute_definition IfcHalfSpaceSolid_attributes[] = {
+	{ "BaseSurface", false },
+	{ "AgreementFlag", false },
+};
+const char * const IfcHalfSpaceSolid_derived[] = { "Dim" };
+const attribute_definition IfcHeatExchangerType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcHumidifierType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcHygroscopicMaterialProperties_attributes[] = {
+	{ "UpperVaporResistanceFactor", false },
+	{ "LowerVaporResistanceFactor", false },
+	{ "IsothermalMoistureCapacity", false },
+	{ "VaporPermeability", false },
+	{ "MoistureDiffusivity", false },
+};
+const attribute_definition IfcIShapeProfileDef_attributes[] = {
+	{ "OverallWidth", false },
+	{ "OverallDepth", false },
+	{ "WebThickness", false },
+	{ "FlangeThickness", false },
+	{ "FilletRadius", false },
+};
+const attribute_definition IfcImageTexture_attributes[] = {
+	{ "UrlReference", false },
+};
+const attribute_definition IfcInventory_attributes[] = {
+	{ "InventoryType", true },
+	{ "Jurisdiction", false },
+	{ "ResponsiblePersons", false },
+	{ "LastUpdateDate", false },
+	{ "CurrentValue", false },
+	{ "OriginalValue", false },
+};
+const attribute_definition IfcIrregularTimeSeries_attributes[] = {
+	{ "Values", false },
+};
+const attribute_definition IfcIrregularTimeSeriesValue_attributes[] = {
+	{ "TimeStamp", false },
+	{ "ListValues", false },
+};
+const attribute_definition IfcJunctionBoxType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcLShapeProfileDef_attributes[] = {
+	{ "Depth", false },
+	{ "Width", false },
+	{ "Thickness", false },
+	{ "FilletRadius", false },
+	{ "EdgeRadius", false },
+	{ "LegSlope", false },
+	{ "CentreOfGravityInX", false },
+	{ "CentreOfGravityInY", false },
+};
+const attribute_definition IfcLaborResource_attributes[] = {
+	{ "SkillSet", false },
+};
+const attribute_definition IfcLampType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcLibraryInformation_attributes[] = {
+	{ "Name", false },
+	{ "Version", false },
+	{ "Publisher", false },
+	{ "VersionDate", false },
+	{ "LibraryReference", false },
+};
+const inverse_definition IfcLibraryReference_inverses[] = {
+	{ "ReferenceIntoLibrary", "IfcLibraryInformation", "LibraryReference" },
+};
+const attribute_definition IfcLightDistributionData_attributes[] = {
+	{ "MainPlaneAngle", false },
+	{ "SecondaryPlaneAngle", false },
+	{ "LuminousIntensity", false },
+};
+const attribute_definition IfcLightFixtureType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcLightIntensityDistribution_attributes[] = {
+	{ "LightDistributionCurve", true },
+	{ "DistributionData", false },
+};
+const attribute_definition IfcLightSource_attributes[] = {
+	{ "Name", false },
+	{ "LightColour", false },
+	{ "AmbientIntensity", false },
+	{ "Intensity", false },
+};
+const attribute_definition IfcLightSourceDirectional_attributes[] = {
+	{ "Orientation", false },
+};
+const attribute_definition IfcLightSourceGoniometric_attributes[] = {
+	{ "Position", false },
+	{ "ColourAppearance", false },
+	{ "ColourTemperature", false },
+	{ "LuminousFlux", false },
+	{ "LightEmissionSource", true },
+	{ "LightDistributionDataSource", false },
+};
+const attribute_definition IfcLightSourcePositional_attributes[] = {
+	{ "Position", false },
+	{ "Radius", false },
+	{ "ConstantAttenuation", false },
+	{ "DistanceAttenuation", false },
+	{ "QuadricAttenuation", false },
+};
+const attribute_definition IfcLightSourceSpot_attributes[] = {
+	{ "Orientation", false },
+	{ "ConcentrationExponent", false },
+	{ "SpreadAngle", false },
+	{ "BeamWidthAngle", false },
+};
+const attribute_definition IfcLine_attributes[] = {
+	{ "Pnt", false },
+	{ "Dir", false },
+};
+const attribute_definition IfcLocalPlacement_attributes[] = {
+	{ "PlacementRelTo", false },
+	{ "RelativePlacement", false },
+};
+const attribute_definition IfcLocalTime_attributes[] = {
+	{ "HourComponent", false },
+	{ "MinuteComponent", false },
+	{ "SecondComponent", false },
+	{ "Zone", false },
+	{ "DaylightSavingOffset", false },
+};
+const attribute_definition IfcManifoldSolidBrep_attributes[] = {
+	{ "Outer", false },
+};
+const attribute_definition IfcMappedItem_attributes[] = {
+	{ "MappingSource", false },
+	{ "MappingTarget", false },
+};
+const attribute_definition IfcMaterial_attributes[] = {
+	{ "Name", false },
+};
+const inverse_definition IfcMaterial_inverses[] = {
+	{ "HasRepresentation", "IfcMaterialDefinitionRepresentation", "RepresentedMaterial" },
+	{ "ClassifiedAs", "IfcMaterialClassificationRelationship", "ClassifiedMaterial" },
+};
+const attribute_definition IfcMaterialClassificationRelationship_attributes[] = {
+	{ "MaterialClassifications", false },
+	{ "ClassifiedMaterial", false },
+};
+const attribute_definition IfcMaterialDefinitionRepresentation_attributes[] = {
+	{ "RepresentedMaterial", false },
+};
+const attribute_definition IfcMaterialLayer_attributes[] = {
+	{ "Material", false },
+	{ "LayerThickness", false },
+	{ "IsVentilated", false },
+};
+const inverse_definition IfcMaterialLayer_inverses[] = {
+	{ "ToMaterialLayerSet", "IfcMaterialLayerSet", "MaterialLayers" },
+};
+const attribute_definition IfcMaterialLayerSet_attributes[] = {
+	{ "MaterialLayers", false },
+	{ "LayerSetName", false },
+};
+const char * const IfcMaterialLayerSet_derived[] = { "TotalThickness" };
+const attribute_definition IfcMaterialLayerSetUsage_attributes[] = {
+	{ "ForLayerSet", false },
+	{ "LayerSetDirection", true },
+	{ "DirectionSense", true },
+	{ "OffsetFromReferenceLine", false },
+};
+const attribute_definition IfcMaterialList_attributes[] = {
+	{ "Materials", false },
+};
+const attribute_definition IfcMaterialProperties_attributes[] = {
+	{ "Material", false },
+};
+const attribute_definition IfcMeasureWithUnit_attributes[] = {
+	{ "ValueComponent", false },
+	{ "UnitComponent", false },
+};
+const attribute_definition IfcMechanicalConcreteMaterialProperties_attributes[] = {
+	{ "CompressiveStrength", false },
+	{ "MaxAggregateSize", false },
+	{ "AdmixturesDescription", false },
+	{ "Workability", false },
+	{ "ProtectivePoreRatio", false },
+	{ "WaterImpermeability", false },
+};
+const attribute_definition IfcMechanicalFastener_attributes[] = {
+	{ "NominalDiameter", false },
+	{ "NominalLength", false },
+};
+const attribute_definition IfcMechanicalMaterialProperties_attributes[] = {
+	{ "DynamicViscosity", false },
+	{ "YoungModulus", false },
+	{ "ShearModulus", false },
+	{ "PoissonRatio", false },
+	{ "ThermalExpansionCoefficient", false },
+};
+const attribute_definition IfcMechanicalSteelMaterialProperties_attributes[] = {
+	{ "YieldStress", false },
+	{ "UltimateStress", false },
+	{ "UltimateStrain", false },
+	{ "HardeningModule", false },
+	{ "ProportionalStress", false },
+	{ "PlasticStrain", false },
+	{ "Relaxations", false },
+};
+const attribute_definition IfcMemberType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcMetric_attributes[] = {
+	{ "Benchmark", true },
+	{ "ValueSource", false },
+	{ "DataValue", false },
+};
+const attribute_definition IfcMonetaryUnit_attributes[] = {
+	{ "Currency", true },
+};
+const attribute_definition IfcMotorConnectionType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcMove_attributes[] = {
+	{ "MoveFrom", false },
+	{ "MoveTo", false },
+	{ "PunchList", false },
+};
+const attribute_definition IfcNamedUnit_attributes[] = {
+	{ "Dimensions", false },
+	{ "UnitType", true },
+};
+const attribute_definition IfcObject_attributes[] = {
+	{ "ObjectType", false },
+};
+const inverse_definition IfcObject_inverses[] = {
+	{ "IsDefinedBy", "IfcRelDefines", "RelatedObjects" },
+};
+const inverse_definition IfcObjectDefinition_inverses[] = {
+	{ "HasAssignments", "IfcRelAssigns", "RelatedObjects" },
+	{ "IsDecomposedBy", "IfcRelDecomposes", "RelatingObject" },
+	{ "Decomposes", "IfcRelDecomposes", "RelatedObjects" },
+	{ "HasAssociations", "IfcRelAssociates", "RelatedObjects" },
+};
+const inverse_definition IfcObjectPlacement_inverses[] = {
+	{ "PlacesObject", "IfcProduct", "ObjectPlacement" },
+	{ "ReferencedByPlacements", "IfcLocalPlacement", "PlacementRelTo" },
+};
+const attribute_definition IfcObjective_attributes[] = {
+	{ "BenchmarkValues", false },
+	{ "ResultValues", false },
+	{ "ObjectiveQualifier", true },
+	{ "UserDefinedQualifier", false },
+};
+const attribute_definition IfcOccupant_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcOffsetCurve2D_attributes[] = {
+	{ "BasisCurve", false },
+	{ "Distance", false },
+	{ "SelfIntersect", false },
+};
+const attribute_definition IfcOffsetCurve3D_attributes[] = {
+	{ "BasisCurve", false },
+	{ "Distance", false },
+	{ "SelfIntersect", false },
+	{ "RefDirection", false },
+};
+const attribute_definition IfcOneDirectionRepeatFactor_attributes[] = {
+	{ "RepeatFactor", false },
+};
+const inverse_definition IfcOpeningElement_inverses[] = {
+	{ "HasFillings", "IfcRelFillsElement", "RelatingOpeningElement" },
+};
+const attribute_definition IfcOpticalMaterialProperties_attributes[] = {
+	{ "VisibleTransmittance", false },
+	{ "SolarTransmittance", false },
+	{ "ThermalIrTransmittance", false },
+	{ "ThermalIrEmissivityBack", false },
+	{ "ThermalIrEmissivityFront", false },
+	{ "VisibleReflectanceBack", false },
+	{ "VisibleReflectanceFront", false },
+	{ "SolarReflectanceFront", false },
+	{ "SolarReflectanceBack", false },
+};
+const attribute_definition IfcOrderAction_attributes[] = {
+	{ "ActionID", false },
+};
+const attribute_definition IfcOrganization_attributes[] = {
+	{ "Id", false },
+	{ "Name", false },
+	{ "Description", false },
+	{ "Roles", false },
+	{ "Addresses", false },
+};
+const inverse_definition IfcOrganization_inverses[] = {
+	{ "IsRelatedBy", "IfcOrganizationRelationship", "RelatedOrganizations" },
+	{ "Relates", "IfcOrganizationRelationship", "RelatingOrganization" },
+	{ "Engages", "IfcPersonAndOrganization", "TheOrganization" },
+};
+const attribute_definition IfcOrganizationRelationship_attributes[] = {
+	{ "Name", false },
+	{ "Description", false },
+	{ "RelatingOrganization", false },
+	{ "RelatedOrganizations", false },
+};
+const attribute_definition IfcOrientedEdge_attributes[] = {
+	{ "EdgeElement", false },
+	{ "Orientation", false },
+};
+const char * const IfcOrientedEdge_derived[] = { "EdgeStart", "EdgeEnd" };
+const attribute_definition IfcOutletType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcOwnerHistory_attributes[] = {
+	{ "OwningUser", false },
+	{ "OwningApplication", false },
+	{ "State", true },
+	{ "ChangeAction", true },
+	{ "LastModifiedDate", false },
+	{ "LastModifyingUser", false },
+	{ "LastModifyingApplication", false },
+	{ "CreationDate", false },
+};
+const attribute_definition IfcParameterizedProfileDef_attributes[] = {
+	{ "Position", false },
+};
+const attribute_definition IfcPath_attributes[] = {
+	{ "EdgeList", false },
+};
+const attribute_definition IfcPerformanceHistory_attributes[] = {
+	{ "LifeCyclePhase", false },
+};
+const attribute_definition IfcPermeableCoveringProperties_attributes[] = {
+	{ "OperationType", true },
+	{ "PanelPosition", true },
+	{ "FrameDepth", false },
+	{ "FrameThickness", false },
+	{ "ShapeAspectStyle", false },
+};
+const attribute_definition IfcPermit_attributes[] = {
+	{ "PermitID", false },
+};
+const attribute_definition IfcPerson_attributes[] = {
+	{ "Id", false },
+	{ "FamilyName", false },
+	{ "GivenName", false },
+	{ "MiddleNames", false },
+	{ "PrefixTitles", false },
+	{ "SuffixTitles", false },
+	{ "Roles", false },
+	{ "Addresses", false },
+};
+const inverse_definition IfcPerson_inverses[] = {
+	{ "EngagedIn", "IfcPersonAndOrganization", "ThePerson" },
+};
+const attribute_definition IfcPersonAndOrganization_attributes[] = {
+	{ "ThePerson", false },
+	{ "TheOrganization", false },
+	{ "Roles", false },
+};
+const attribute_definition IfcPhysicalComplexQuantity_attributes[] = {
+	{ "HasQuantities", false },
+	{ "Discrimination", false },
+	{ "Quality", false },
+	{ "Usage", false },
+};
+const attribute_definition IfcPhysicalQuantity_attributes[] = {
+	{ "Name", false },
+	{ "Description", false },
+};
+const inverse_definition IfcPhysicalQuantity_inverses[] = {
+	{ "PartOfComplex", "IfcPhysicalComplexQuantity", "HasQuantities" },
+};
+const attribute_definition IfcPhysicalSimpleQuantity_attributes[] = {
+	{ "Unit", false },
+};
+const attribute_definition IfcPile_attributes[] = {
+	{ "PredefinedType", true },
+	{ "ConstructionType", true },
+};
+const attribute_definition IfcPipeFittingType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcPipeSegmentType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcPixelTexture_attributes[] = {
+	{ "Width", false },
+	{ "Height", false },
+	{ "ColourComponents", false },
+	{ "Pixel", false },
+};
+const attribute_definition IfcPlacement_attributes[] = {
+	{ "Location", false },
+};
+const char * const IfcPlacement_derived[] = { "Dim" };
+const attribute_definition IfcPlanarBox_attributes[] = {
+	{ "Placement", false },
+};
+const attribute_definition IfcPlanarExtent_attributes[] = {
+	{ "SizeInX", false },
+	{ "SizeInY", false },
+};
+const attribute_definition IfcPlateType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcPointOnCurve_attributes[] = {
+	{ "BasisCurve", false },
+	{ "PointParameter", false },
+};
+const char * const IfcPointOnCurve_derived[] = { "Dim" };
+const attribute_definition IfcPointOnSurface_attributes[] = {
+	{ "BasisSurface", false },
+	{ "PointParameterU", false },
+	{ "PointParameterV", false },
+};
+const char * const IfcPointOnSurface_derived[] = { "Dim" };
+const attribute_definition IfcPolyLoop_attributes[] = {
+	{ "Polygon", false },
+};
+const attribute_definition IfcPolygonalBoundedHalfSpace_attributes[] = {
+	{ "Position", false },
+	{ "PolygonalBoundary", false },
+};
+const attribute_definition IfcPolyline_attributes[] = {
+	{ "Points", false },
+};
+const inverse_definition IfcPort_inverses[] = {
+	{ "ContainedIn", "IfcRelConnectsPortToElement", "RelatingPort" },
+	{ "ConnectedFrom", "IfcRelConnectsPorts", "RelatedPort" },
+	{ "ConnectedTo", "IfcRelConnectsPorts", "RelatingPort" },
+};
+const attribute_definition IfcPostalAddress_attributes[] = {
+	{ "InternalLocation", false },
+	{ "AddressLines", false },
+	{ "PostalBox", false },
+	{ "Town", false },
+	{ "Region", false },
+	{ "PostalCode", false },
+	{ "Country", false },
+};
+const attribute_definition IfcPreDefinedItem_attributes[] = {
+	{ "Name", false },
+};
+const attribute_definition IfcPresentationLayerAssignment_attributes[] = {
+	{ "Name", false },
+	{ "Description", false },
+	{ "AssignedItems", false },
+	{ "Identifier", false },
+};
+const attribute_definition IfcPresentationLayerWithStyle_attributes[] = {
+	{ "LayerOn", false },
+	{ "LayerFrozen", false },
+	{ "LayerBlocked", false },
+	{ "LayerStyles", false },
+};
+const attribute_definition IfcPresentationStyle_attributes[] = {
+	{ "Name", false },
+};
+const attribute_definition IfcPresentationStyleAssignment_attributes[] = {
+	{ "Styles", false },
+};
+const attribute_definition IfcProcedure_attributes[] = {
+	{ "ProcedureID", false },
+	{ "ProcedureType", true },
+	{ "UserDefinedProcedureType", false },
+};
+const inverse_definition IfcProcess_inverses[] = {
+	{ "OperatesOn", "IfcRelAssignsToProcess", "RelatingProcess" },
+	{ "IsSuccessorFrom", "IfcRelSequence", "RelatedProcess" },
+	{ "IsPredecessorTo", "IfcRelSequence", "RelatingProcess" },
+};
+const attribute_definition IfcProduct_attributes[] = {
+	{ "ObjectPlacement", false },
+	{ "Representation", false },
+};
+const inverse_definition IfcProduct_inverses[] = {
+	{ "ReferencedBy", "IfcRelAssignsToProduct", "RelatingProduct" },
+};
+const inverse_definition IfcProductDefinitionShape_inverses[] = {
+	{ "ShapeOfProduct", "IfcProduct", "Representation" },
+	{ "HasShapeAspects", "IfcShapeAspect", "PartOfProductDefinitionShape" },
+};
+const attribute_definition IfcProductRepresentation_attributes[] = {
+	{ "Name", false },
+	{ "Description", false },
+	{ "Representations", false },
+};
+const attribute_definition IfcProductsOfCombustionProperties_attributes[] = {
+	{ "SpecificHeatCapacity", false },
+	{ "N20Content", false },
+	{ "COContent", false },
+	{ "CO2Content", false },
+};
+const attribute_definition IfcProfileDef_attributes[] = {
+	{ "ProfileType", true },
+	{ "ProfileName", false },
+};
+const attribute_definition IfcProfileProperties_attributes[] = {
+	{ "ProfileName", false },
+	{ "ProfileDefinition", false },
+};
+const attribute_definition IfcProject_attributes[] = {
+	{ "LongName", false },
+	{ "Phase", false },
+	{ "RepresentationContexts", false },
+	{ "UnitsInContext", false },
+};
+const attribute_definition IfcProjectOrder_attributes[] = {
+	{ "ID", false },
+	{ "PredefinedType", true },
+	{ "Status", false },
+};
+const attribute_definition IfcProjectOrderRecord_attributes[] = {
+	{ "Records", false },
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcProperty_attributes[] = {
+	{ "Name", false },
+	{ "Description", false },
+};
+const inverse_definition IfcProperty_inverses[] = {
+	{ "PropertyForDependance", "IfcPropertyDependencyRelationship", "DependingProperty" },
+	{ "PropertyDependsOn", "IfcPropertyDependencyRelationship", "DependantProperty" },
+	{ "PartOfComplex", "IfcComplexProperty", "HasProperties" },
+};
+const attribute_definition IfcPropertyBoundedValue_attributes[] = {
+	{ "UpperBoundValue", false },
+	{ "LowerBoundValue", false },
+	{ "Unit", false },
+};
+const attribute_definition IfcPropertyConstraintRelationship_attributes[] = {
+	{ "RelatingConstraint", false },
+	{ "RelatedProperties", false },
+	{ "Name", false },
+	{ "Description", false },
+};
+const inverse_definition IfcPropertyDefinition_inverses[] = {
+	{ "HasAssociations", "IfcRelAssociates", "RelatedObjects" },
+};
+const attribute_definition IfcPropertyDependencyRelationship_attributes[] = {
+	{ "DependingProperty", false },
+	{ "DependantProperty", false },
+	{ "Name", false },
+	{ "Description", false },
+	{ "Expression", false },
+};
+const attribute_definition IfcPropertyEnumeratedValue_attributes[] = {
+	{ "EnumerationValues", false },
+	{ "EnumerationReference", false },
+};
+const attribute_definition IfcPropertyEnumeration_attributes[] = {
+	{ "Name", false },
+	{ "EnumerationValues", false },
+	{ "Unit", false },
+};
+const attribute_definition IfcPropertyListValue_attributes[] = {
+	{ "ListValues", false },
+	{ "Unit", false },
+};
+const attribute_definition IfcPropertyReferenceValue_attributes[] = {
+	{ "UsageName", false },
+	{ "PropertyReference", false },
+};
+const attribute_definition IfcPropertySet_attributes[] = {
+	{ "HasProperties", false },
+};
+const inverse_definition IfcPropertySetDefinition_inverses[] = {
+	{ "PropertyDefinitionOf", "IfcRelDefinesByProperties", "RelatingPropertyDefinition" },
+	{ "DefinesType", "IfcTypeObject", "HasPropertySets" },
+};
+const attribute_definition IfcPropertySingleValue_attributes[] = {
+	{ "NominalValue", false },
+	{ "Unit", false },
+};
+const attribute_definition IfcPropertyTableValue_attributes[] = {
+	{ "DefiningValues", false },
+	{ "DefinedValues", false },
+	{ "Expression", false },
+	{ "DefiningUnit", false },
+	{ "DefinedUnit", false },
+};
+const attribute_definition IfcProtectiveDeviceType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcProxy_attributes[] = {
+	{ "ProxyType", true },
+	{ "Tag", false },
+};
+const attribute_definition IfcPumpType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcQuantityArea_attributes[] = {
+	{ "AreaValue", false },
+};
+const attribute_definition IfcQuantityCount_attributes[] = {
+	{ "CountValue", false },
+};
+const attribute_definition IfcQuantityLength_attributes[] = {
+	{ "LengthValue", false },
+};
+const attribute_definition IfcQuantityTime_attributes[] = {
+	{ "TimeValue", false },
+};
+const attribute_definition IfcQuantityVolume_attributes[] = {
+	{ "VolumeValue", false },
+};
+const attribute_definition IfcQuantityWeight_attributes[] = {
+	{ "WeightValue", false },
+};
+const attribute_definition IfcRailing_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcRailingType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcRamp_attributes[] = {
+	{ "ShapeType", true },
+};
+const attribute_definition IfcRampFlightType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcRationalBezierCurve_attributes[] = {
+	{ "WeightsData", false },
+};
+const char * const IfcRationalBezierCurve_derived[] = { "Weights" };
+const attribute_definition IfcRectangleHollowProfileDef_attributes[] = {
+	{ "WallThickness", false },
+	{ "InnerFilletRadius", false },
+	{ "OuterFilletRadius", false },
+};
+const attribute_definition IfcRectangleProfileDef_attributes[] = {
+	{ "XDim", false },
+	{ "YDim", false },
+};
+const attribute_definition IfcRectangularPyramid_attributes[] = {
+	{ "XLength", false },
+	{ "YLength", false },
+	{ "Height", false },
+};
+const attribute_definition IfcRectangularTrimmedSurface_attributes[] = {
+	{ "BasisSurface", false },
+	{ "U1", false },
+	{ "V1", false },
+	{ "U2", false },
+	{ "V2", false },
+	{ "Usense", false },
+	{ "Vsense", false },
+};
+const char * const IfcRectangularTrimmedSurface_derived[] = { "Dim" };
+const attribute_definition IfcReferencesValueDocument_attributes[] = {
+	{ "ReferencedDocument", false },
+	{ "ReferencingValues", false },
+	{ "Name", false },
+	{ "Description", false },
+};
+const attribute_definition IfcRegularTimeSeries_attributes[] = {
+	{ "TimeStep", false },
+	{ "Values", false },
+};
+const attribute_definition IfcReinforcementBarProperties_attributes[] = {
+	{ "TotalCrossSectionArea", false },
+	{ "SteelGrade", false },
+	{ "BarSurface", true },
+	{ "EffectiveDepth", false },
+	{ "NominalBarDiameter", false },
+	{ "BarCount", false },
+};
+const attribute_definition IfcReinforcementDefinitionProperties_attributes[] = {
+	{ "DefinitionType", false },
+	{ "ReinforcementSectionDefinitions", false },
+};
+const attribute_definition IfcReinforcingBar_attributes[] = {
+	{ "NominalDiameter", false },
+	{ "CrossSectionArea", false },
+	{ "BarLength", false },
+	{ "BarRole", true },
+	{ "BarSurface", true },
+};
+const attribute_definition IfcReinforcingElement_attributes[] = {
+	{ "SteelGrade", false },
+};
+const attribute_definition IfcReinforcingMesh_attributes[] = {
+	{ "MeshLength", false },
+	{ "MeshWidth", false },
+	{ "LongitudinalBarNominalDiameter", false },
+	{ "TransverseBarNominalDiameter", false },
+	{ "LongitudinalBarCrossSectionArea", false },
+	{ "TransverseBarCrossSectionArea", false },
+	{ "LongitudinalBarSpacing", false },
+	{ "TransverseBarSpacing", false },
+};
+const attribute_definition IfcRelAssigns_attributes[] = {
+	{ "RelatedObjects", false },
+	{ "RelatedObjectsType", true },
+};
+const attribute_definition IfcRelAssignsTasks_attributes[] = {
+	{ "TimeForTask", false },
+};
+const attribute_definition IfcRelAssignsToActor_attributes[] = {
+	{ "RelatingActor", false },
+	{ "ActingRole", false },
+};
+const attribute_definition IfcRelAssignsToControl_attributes[] = {
+	{ "RelatingControl", false },
+};
+const attribute_definition IfcRelAssignsToGroup_attributes[] = {
+	{ "RelatingGroup", false },
+};
+const attribute_definition IfcRelAssignsToProcess_attributes[] = {
+	{ "RelatingProcess", false },
+	{ "QuantityInProcess", false },
+};
+const attribute_definition IfcRelAssignsToProduct_attributes[] = {
+	{ "RelatingProduct", false },
+};
+const attribute_definition IfcRelAssignsToResource_attributes[] = {
+	{ "RelatingResource", false },
+};
+const attribute_definition IfcRelAssociates_attributes[] = {
+	{ "RelatedObjects", false },
+};
+const attribute_definition IfcRelAssociatesAppliedValue_attributes[] = {
+	{ "RelatingAppliedValue", false },
+};
+const attribute_definition IfcRelAssociatesApproval_attributes[] = {
+	{ "RelatingApproval", false },
+};
+const attribute_definition IfcRelAssociatesClassification_attributes[] = {
+	{ "RelatingClassification", false },
+};
+const attribute_definition IfcRelAssociatesConstraint_attributes[] = {
+	{ "Intent", false },
+	{ "RelatingConstraint", false },
+};
+const attribute_definition IfcRelAssociatesDocument_attributes[] = {
+	{ "RelatingDocument", false },
+};
+const attribute_definition IfcRelAssociatesLibrary_attributes[] = {
+	{ "RelatingLibrary", false },
+};
+const attribute_definition IfcRelAssociatesMaterial_attributes[] = {
+	{ "RelatingMaterial", false },
+};
+const attribute_definition IfcRelAssociatesProfileProperties_attributes[] = {
+	{ "RelatingProfileProperties", false },
+	{ "ProfileSectionLocation", false },
+	{ "ProfileOrientation", false },
+};
+const attribute_definition IfcRelConnectsElements_attributes[] = {
+	{ "ConnectionGeometry", false },
+	{ "RelatingElement", false },
+	{ "RelatedElement", false },
+};
+const attribute_definition IfcRelConnectsPathElements_attributes[] = {
+	{ "RelatingPriorities", false },
+	{ "RelatedPriorities", false },
+	{ "RelatedConnectionType", true },
+	{ "RelatingConnectionType", true },
+};
+const char * const IfcRelConnectsPathElements_derived[] = { "RelatedLayerCount", "RelatingLayerCount" };
+const attribute_definition IfcRelConnectsPortToElement_attributes[] = {
+	{ "RelatingPort", false },
+	{ "RelatedElement", false },
+};
+const attribute_definition IfcRelConnectsPorts_attributes[] = {
+	{ "RelatingPort", false },
+	{ "RelatedPort", false },
+	{ "RealizingElement", false },
+};
+const attribute_definition IfcRelConnectsStructuralActivity_attributes[] = {
+	{ "RelatingElement", false },
+	{ "RelatedStructuralActivity", false },
+};
+const attribute_definition IfcRelConnectsStructuralElement_attributes[] = {
+	{ "RelatingElement", false },
+	{ "RelatedStructuralMember", false },
+};
+const attribute_definition IfcRelConnectsStructuralMember_attributes[] = {
+	{ "RelatingStructuralMember", false },
+	{ "RelatedStructuralConnection", false },
+	{ "AppliedCondition", false },
+	{ "AdditionalConditions", false },
+	{ "SupportedLength", false },
+	{ "ConditionCoordinateSystem", false },
+};
+const attribute_definition IfcRelConnectsWithEccentricity_attributes[] = {
+	{ "ConnectionConstraint", false },
+};
+const attribute_definition IfcRelConnectsWithRealizingElements_attributes[] = {
+	{ "RealizingElements", false },
+	{ "ConnectionType", false },
+};
+const attribute_definition IfcRelContainedInSpatialStructure_attributes[] = {
+	{ "RelatedElements", false },
+	{ "RelatingStructure", false },
+};
+const attribute_definition IfcRelCoversBldgElements_attributes[] = {
+	{ "RelatingBuildingElement", false },
+	{ "RelatedCoverings", false },
+};
+const attribute_definition IfcRelCoversSpaces_attributes[] = {
+	{ "RelatedSpace", false },
+	{ "RelatedCoverings", false },
+};
+const attribute_definition IfcRelDecomposes_attributes[] = {
+	{ "RelatingObject", false },
+	{ "RelatedObjects", false },
+};
+const attribute_definition IfcRelDefines_attributes[] = {
+	{ "RelatedObjects", false },
+};
+const attribute_definition IfcRelDefinesByProperties_attributes[] = {
+	{ "RelatingPropertyDefinition", false },
+};
+const attribute_definition IfcRelDefinesByType_attributes[] = {
+	{ "RelatingType", false },
+};
+const attribute_definition IfcRelFillsElement_attributes[] = {
+	{ "RelatingOpeningElement", false },
+	{ "RelatedBuildingElement", false },
+};
+const attribute_definition IfcRelFlowControlElements_attributes[] = {
+	{ "RelatedControlElements", false },
+	{ "RelatingFlowElement", false },
+};
+const attribute_definition IfcRelInteractionRequirements_attributes[] = {
+	{ "DailyInteraction", false },
+	{ "ImportanceRating", false },
+	{ "LocationOfInteraction", false },
+	{ "RelatedSpaceProgram", false },
+	{ "RelatingSpaceProgram", false },
+};
+const attribute_definition IfcRelOverridesProperties_attributes[] = {
+	{ "OverridingProperties", false },
+};
+const attribute_definition IfcRelProjectsElement_attributes[] = {
+	{ "RelatingElement", false },
+	{ "RelatedFeatureElement", false },
+};
+const attribute_definition IfcRelReferencedInSpatialStructure_attributes[] = {
+	{ "RelatedElements", false },
+	{ "RelatingStructure", false },
+};
+const attribute_definition IfcRelSequence_attributes[] = {
+	{ "RelatingProcess", false },
+	{ "RelatedProcess", false },
+	{ "TimeLag", false },
+	{ "SequenceType", true },
+};
+const attribute_definition IfcRelServicesBuildings_attributes[] = {
+	{ "RelatingSystem", false },
+	{ "RelatedBuildings", false },
+};
+const attribute_definition IfcRelSpaceBoundary_attributes[] = {
+	{ "RelatingSpace", false },
+	{ "RelatedBuildingElement", false },
+	{ "ConnectionGeometry", false },
+	{ "PhysicalOrVirtualBoundary", true },
+	{ "InternalOrExternalBoundary", true },
+};
+const attribute_definition IfcRelVoidsElement_attributes[] = {
+	{ "RelatingBuildingElement", false },
+	{ "RelatedOpeningElement", false },
+};
+const attribute_definition IfcRelaxation_attributes[] = {
+	{ "RelaxationValue", false },
+	{ "InitialStress", false },
+};
+const attribute_definition IfcRepresentation_attributes[] = {
+	{ "ContextOfItems", false },
+	{ "RepresentationIdentifier", false },
+	{ "RepresentationType", false },
+	{ "Items", false },
+};
+const inverse_definition IfcRepresentation_inverses[] = {
+	{ "RepresentationMap", "IfcRepresentationMap", "MappedRepresentation" },
+	{ "LayerAssignments", "IfcPresentationLayerAssignment", "Assigneditems" },
+	{ "OfProductRepresentation", "IfcProductRepresentation", "Representations" },
+};
+const attribute_definition IfcRepresentationContext_attributes[] = {
+	{ "ContextIdentifier", false },
+	{ "ContextType", false },
+};
+const inverse_definition IfcRepresentationContext_inverses[] = {
+	{ "RepresentationsInContext", "IfcRepresentation", "ContextOfItems" },
+};
+const inverse_definition IfcRepresentationItem_inverses[] = {
+	{ "LayerAssignments", "IfcPresentationLayerAssignment", "AssignedItems" },
+	{ "StyledByItem", "IfcStyledItem", "Item" },
+};
+const attribute_definition IfcRepresentationMap_attributes[] = {
+	{ "MappingOrigin", false },
+	{ "MappedRepresentation", false },
+};
+const inverse_definition IfcRepresentationMap_inverses[] = {
+	{ "MapUsage", "IfcMappedItem", "MappingSource" },
+};
+const inverse_definition IfcResource_inverses[] = {
+	{ "ResourceOf", "IfcRelAssignsToResource", "RelatingResource" },
+};
+const attribute_definition IfcRevolvedAreaSolid_attributes[] = {
+	{ "Axis", false },
+	{ "Angle", false },
+};
+const char * const IfcRevolvedAreaSolid_derived[] = { "AxisLine" };
+const attribute_definition IfcRibPlateProfileProperties_attributes[] = {
+	{ "Thickness", false },
+	{ "RibHeight", false },
+	{ "RibWidth", false },
+	{ "RibSpacing", false },
+	{ "Direction", true },
+};
+const attribute_definition IfcRightCircularCone_attributes[] = {
+	{ "Height", false },
+	{ "BottomRadius", false },
+};
+const attribute_definition IfcRightCircularCylinder_attributes[] = {
+	{ "Height", false },
+	{ "Radius", false },
+};
+const attribute_definition IfcRoof_attributes[] = {
+	{ "ShapeType", true },
+};
+const attribute_definition IfcRoot_attributes[] = {
+	{ "GlobalId", false },
+	{ "OwnerHistory", false },
+	{ "Name", false },
+	{ "Description", false },
+};
+const attribute_definition IfcRoundedEdgeFeature_attributes[] = {
+	{ "Radius", false },
+};
+const attribute_definition IfcRoundedRectangleProfileDef_attributes[] = {
+	{ "RoundingRadius", false },
+};
+const attribute_definition IfcSIUnit_attributes[] = {
+	{ "Prefix", true },
+	{ "Name", true },
+};
+const char * const IfcSIUnit_derived[] = { "Dimensions" };
+const attribute_definition IfcSanitaryTerminalType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcScheduleTimeControl_attributes[] = {
+	{ "ActualStart", false },
+	{ "EarlyStart", false },
+	{ "LateStart", false },
+	{ "ScheduleStart", false },
+	{ "ActualFinish", false },
+	{ "EarlyFinish", false },
+	{ "LateFinish", false },
+	{ "ScheduleFinish", false },
+	{ "ScheduleDuration", false },
+	{ "ActualDuration", false },
+	{ "RemainingTime", false },
+	{ "FreeFloat", false },
+	{ "TotalFloat", false },
+	{ "IsCritical", false },
+	{ "StatusTime", false },
+	{ "StartFloat", false },
+	{ "FinishFloat", false },
+	{ "Completion", false },
+};
+const inverse_definition IfcScheduleTimeControl_inverses[] = {
+	{ "ScheduleTimeControlAssigned", "IfcRelAssignsTasks", "TimeForTask" },
+};
+const attribute_definition IfcSectionProperties_attributes[] = {
+	{ "SectionType", true },
+	{ "StartProfile", false },
+	{ "EndProfile", false },
+};
+const attribute_definition IfcSectionReinforcementProperties_attributes[] = {
+	{ "LongitudinalStartPosition", false },
+	{ "LongitudinalEndPosition", false },
+	{ "TransversePosition", false },
+	{ "ReinforcementRole", true },
+	{ "SectionDefinition", false },
+	{ "CrossSectionReinforcementDefinitions", false },
+};
+const attribute_definition IfcSectionedSpine_attributes[] = {
+	{ "SpineCurve", false },
+	{ "CrossSections", false },
+	{ "CrossSectionPositions", false },
+};
+const char * const IfcSectionedSpine_derived[] = { "Dim" };
+const attribute_definition IfcSensorType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcServiceLife_attributes[] = {
+	{ "ServiceLifeType", true },
+	{ "ServiceLifeDuration", false },
+};
+const attribute_definition IfcServiceLifeFactor_attributes[] = {
+	{ "PredefinedType", true },
+	{ "UpperValue", false },
+	{ "MostUsedValue", false },
+	{ "LowerValue", false },
+};
+const attribute_definition IfcShapeAspect_attributes[] = {
+	{ "ShapeRepresentations", false },
+	{ "Name", false },
+	{ "Description", false },
+	{ "ProductDefinitional", false },
+	{ "PartOfProductDefinitionShape", false },
+};
+const inverse_definition IfcShapeModel_inverses[] = {
+	{ "OfShapeAspect", "IfcShapeAspect", "ShapeRepresentations" },
+};
+const attribute_definition IfcShellBasedSurfaceModel_attributes[] = {
+	{ "SbsmBoundary", false },
+};
+const char * const IfcShellBasedSurfaceModel_derived[] = { "Dim" };
+const attribute_definition IfcSite_attributes[] = {
+	{ "RefLatitude", false },
+	{ "RefLongitude", false },
+	{ "RefElevation", false },
+	{ "LandTitleNumber", false },
+	{ "SiteAddress", false },
+};
+const attribute_definition IfcSlab_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcSlabType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcSlippageConnectionCondition_attributes[] = {
+	{ "SlippageX", false },
+	{ "SlippageY", false },
+	{ "SlippageZ", false },
+};
+const char * const IfcSolidModel_derived[] = { "Dim" };
+const attribute_definition IfcSoundProperties_attributes[] = {
+	{ "IsAttenuating", false },
+	{ "SoundScale", true },
+	{ "SoundValues", false },
+};
+const attribute_definition IfcSoundValue_attributes[] = {
+	{ "SoundLevelTimeSeries", false },
+	{ "Frequency", false },
+	{ "SoundLevelSingleValue", false },
+};
+const attribute_definition IfcSpace_attributes[] = {
+	{ "InteriorOrExteriorSpace", true },
+	{ "ElevationWithFlooring", false },
+};
+const inverse_definition IfcSpace_inverses[] = {
+	{ "HasCoverings", "IfcRelCoversSpaces", "RelatedSpace" },
+	{ "BoundedBy", "IfcRelSpaceBoundary", "RelatingSpace" },
+};
+const attribute_definition IfcSpaceHeaterType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcSpaceProgram_attributes[] = {
+	{ "SpaceProgramIdentifier", false },
+	{ "MaxRequiredArea", false },
+	{ "MinRequiredArea", false },
+	{ "RequestedLocation", false },
+	{ "StandardRequiredArea", false },
+};
+const inverse_definition IfcSpaceProgram_inverses[] = {
+	{ "HasInteractionReqsFrom", "IfcRelInteractionRequirements", "RelatedSpaceProgram" },
+	{ "HasInteractionReqsTo", "IfcRelInteractionRequirements", "RelatingSpaceProgram" },
+};
+const attribute_definition IfcSpaceThermalLoadProperties_attributes[] = {
+	{ "ApplicableValueRatio", false },
+	{ "ThermalLoadSource", true },
+	{ "PropertySource", true },
+	{ "SourceDescription", false },
+	{ "MaximumValue", false },
+	{ "MinimumValue", false },
+	{ "ThermalLoadTimeSeriesValues", false },
+	{ "UserDefinedThermalLoadSource", false },
+	{ "UserDefinedPropertySource", false },
+	{ "ThermalLoadType", true },
+};
+const attribute_definition IfcSpaceType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcSpatialStructureElement_attributes[] = {
+	{ "LongName", false },
+	{ "CompositionType", true },
+};
+const inverse_definition IfcSpatialStructureElement_inverses[] = {
+	{ "ReferencesElements", "IfcRelReferencedInSpatialStructure", "RelatingStructure" },
+	{ "ServicedBySystems", "IfcRelServicesBuildings", "RelatedBuildings" },
+	{ "ContainsElements", "IfcRelContainedInSpatialStructure", "RelatingStructure" },
+};
+const attribute_definition IfcSphere_attributes[] = {
+	{ "Radius", false },
+};
+const attribute_definition IfcStackTerminalType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcStair_attributes[] = {
+	{ "ShapeType", true },
+};
+const attribute_definition IfcStairFlight_attributes[] = {
+	{ "NumberOfRiser", false },
+	{ "NumberOfTreads", false },
+	{ "RiserHeight", false },
+	{ "TreadLength", false },
+};
+const attribute_definition IfcStairFlightType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcStructuralAction_attributes[] = {
+	{ "DestabilizingLoad", false },
+	{ "CausedBy", false },
+};
+const attribute_definition IfcStructuralActivity_attributes[] = {
+	{ "AppliedLoad", false },
+	{ "GlobalOrLocal", true },
+};
+const inverse_definition IfcStructuralActivity_inverses[] = {
+	{ "AssignedToStructuralItem", "IfcRelConnectsStructuralActivity", "RelatedStructuralActivity" },
+};
+const attribute_definition IfcStructuralAnalysisModel_attributes[] = {
+	{ "PredefinedType", true },
+	{ "OrientationOf2DPlane", false },
+	{ "LoadedBy", false },
+	{ "HasResults", false },
+};
+const attribute_definition IfcStructuralConnection_attributes[] = {
+	{ "AppliedCondition", false },
+};
+const inverse_definition IfcStructuralConnection_inverses[] = {
+	{ "ConnectsStructuralMembers", "IfcRelConnectsStructuralMember", "RelatedStructuralConnection" },
+};
+const attribute_definition IfcStructuralConnectionCondition_attributes[] = {
+	{ "Name", false },
+};
+const attribute_definition IfcStructuralCurveMember_attributes[] = {
+	{ "PredefinedType", true },
+};
+const inverse_definition IfcStructuralItem_inverses[] = {
+	{ "AssignedStructuralActivity", "IfcRelConnectsStructuralActivity", "RelatingElement" },
+};
+const attribute_definition IfcStructuralLinearAction_attributes[] = {
+	{ "ProjectedOrTrue", true },
+};
+const attribute_definition IfcStructuralLinearActionVarying_attributes[] = {
+	{ "VaryingAppliedLoadLocation", false },
+	{ "SubsequentAppliedLoads", false },
+};
+const char * const IfcStructuralLinearActionVarying_derived[] = { "VaryingAppliedLoads" };
+const attribute_definition IfcStructuralLoad_attributes[] = {
+	{ "Name", false },
+};
+const attribute_definition IfcStructuralLoadGroup_attributes[] = {
+	{ "PredefinedType", true },
+	{ "ActionType", true },
+	{ "ActionSource", true },
+	{ "Coefficient", false },
+	{ "Purpose", false },
+};
+const inverse_definition IfcStructuralLoadGroup_inverses[] = {
+	{ "SourceOfResultGroup", "IfcStructuralResultGroup", "ResultForLoadGroup" },
+	{ "LoadGroupFor", "IfcStructuralAnalysisModel", "LoadedBy" },
+};
+const attribute_definition IfcStructuralLoadLinearForce_attributes[] = {
+	{ "LinearForceX", false },
+	{ "LinearForceY", false },
+	{ "LinearForceZ", false },
+	{ "LinearMomentX", false },
+	{ "LinearMomentY", false },
+	{ "LinearMomentZ", false },
+};
+const attribute_definition IfcStructuralLoadPlanarForce_attributes[] = {
+	{ "PlanarForceX", false },
+	{ "PlanarForceY", false },
+	{ "PlanarForceZ", false },
+};
+const attribute_definition IfcStructuralLoadSingleDisplacement_attributes[] = {
+	{ "DisplacementX", false },
+	{ "DisplacementY", false },
+	{ "DisplacementZ", false },
+	{ "RotationalDisplacementRX", false },
+	{ "RotationalDisplacementRY", false },
+	{ "RotationalDisplacementRZ", false },
+};
+const attribute_definition IfcStructuralLoadSingleDisplacementDistortion_attributes[] = {
+	{ "Distortion", false },
+};
+const attribute_definition IfcStructuralLoadSingleForce_attributes[] = {
+	{ "ForceX", false },
+	{ "ForceY", false },
+	{ "ForceZ", false },
+	{ "MomentX", false },
+	{ "MomentY", false },
+	{ "MomentZ", false },
+};
+const attribute_definition IfcStructuralLoadSingleForceWarping_attributes[] = {
+	{ "WarpingMoment", false },
+};
+const attribute_definition IfcStructuralLoadTemperature_attributes[] = {
+	{ "DeltaT_Constant", false },
+	{ "DeltaT_Y", false },
+	{ "DeltaT_Z", false },
+};
+const inverse_definition IfcStructuralMember_inverses[] = {
+	{ "ReferencesElement", "IfcRelConnectsStructuralElement", "RelatedStructuralMember" },
+	{ "ConnectedBy", "IfcRelConnectsStructuralMember", "RelatingStructuralMember" },
+};
+const attribute_definition IfcStructuralPlanarAction_attributes[] = {
+	{ "ProjectedOrTrue", true },
+};
+const attribute_definition IfcStructuralPlanarActionVarying_attributes[] = {
+	{ "VaryingAppliedLoadLocation", false },
+	{ "SubsequentAppliedLoads", false },
+};
+const char * const IfcStructuralPlanarActionVarying_derived[] = { "VaryingAppliedLoads" };
+const attribute_definition IfcStructuralProfileProperties_attributes[] = {
+	{ "TorsionalConstantX", false },
+	{ "MomentOfInertiaYZ", false },
+	{ "MomentOfInertiaY", false },
+	{ "MomentOfInertiaZ", false },
+	{ "WarpingConstant", false },
+	{ "ShearCentreZ", false },
+	{ "ShearCentreY", false },
+	{ "ShearDeformationAreaZ", false },
+	{ "ShearDeformationAreaY", false },
+	{ "MaximumSectionModulusY", false },
+	{ "MinimumSectionModulusY", false },
+	{ "MaximumSectionModulusZ", false },
+	{ "MinimumSectionModulusZ", false },
+	{ "TorsionalSectionModulus", false },
+	{ "CentreOfGravityInX", false },
+	{ "CentreOfGravityInY", false },
+};
+const inverse_definition IfcStructuralReaction_inverses[] = {
+	{ "Causes", "IfcStructuralAction", "CausedBy" },
+};
+const attribute_definition IfcStructuralResultGroup_attributes[] = {
+	{ "TheoryType", true },
+	{ "ResultForLoadGroup", false },
+	{ "IsLinear", false },
+};
+const inverse_definition IfcStructuralResultGroup_inverses[] = {
+	{ "ResultGroupFor", "IfcStructuralAnalysisModel", "HasResults" },
+};
+const attribute_definition IfcStructuralSteelProfileProperties_attributes[] = {
+	{ "ShearAreaZ", false },
+	{ "ShearAreaY", false },
+	{ "PlasticShapeFactorY", false },
+	{ "PlasticShapeFactorZ", false },
+};
+const attribute_definition IfcStructuralSurfaceMember_attributes[] = {
+	{ "PredefinedType", true },
+	{ "Thickness", false },
+};
+const attribute_definition IfcStructuralSurfaceMemberVarying_attributes[] = {
+	{ "SubsequentThickness", false },
+	{ "VaryingThicknessLocation", false },
+};
+const char * const IfcStructuralSurfaceMemberVarying_derived[] = { "VaryingThickness" };
+const attribute_definition IfcStyledItem_attributes[] = {
+	{ "Item", false },
+	{ "Styles", false },
+	{ "Name", false },
+};
+const attribute_definition IfcSubContractResource_attributes[] = {
+	{ "SubContractor", false },
+	{ "JobDescription", false },
+};
+const attribute_definition IfcSubedge_attributes[] = {
+	{ "ParentEdge", false },
+};
+const attribute_definition IfcSurfaceCurveSweptAreaSolid_attributes[] = {
+	{ "Directrix", false },
+	{ "StartParam", false },
+	{ "EndParam", false },
+	{ "ReferenceSurface", false },
+};
+const attribute_definition IfcSurfaceOfLinearExtrusion_attributes[] = {
+	{ "ExtrudedDirection", false },
+	{ "Depth", false },
+};
+const char * const IfcSurfaceOfLinearExtrusion_derived[] = { "ExtrusionAxis" };
+const attribute_definition IfcSurfaceOfRevolution_attributes[] = {
+	{ "AxisPosition", false },
+};
+const char * const IfcSurfaceOfRevolution_derived[] = { "AxisLine" };
+const attribute_definition IfcSurfaceStyle_attributes[] = {
+	{ "Side", true },
+	{ "Styles", false },
+};
+const attribute_definition IfcSurfaceStyleLighting_attributes[] = {
+	{ "DiffuseTransmissionColour", false },
+	{ "DiffuseReflectionColour", false },
+	{ "TransmissionColour", false },
+	{ "ReflectanceColour", false },
+};
+const attribute_definition IfcSurfaceStyleRefraction_attributes[] = {
+	{ "RefractionIndex", false },
+	{ "DispersionFactor", false },
+};
+const attribute_definition IfcSurfaceStyleRendering_attributes[] = {
+	{ "Transparency", false },
+	{ "DiffuseColour", false },
+	{ "TransmissionColour", false },
+	{ "DiffuseTransmissionColour", false },
+	{ "ReflectionColour", false },
+	{ "SpecularColour", false },
+	{ "SpecularHighlight", false },
+	{ "ReflectanceMethod", true },
+};
+const attribute_definition IfcSurfaceStyleShading_attributes[] = {
+	{ "SurfaceColour", false },
+};
+const attribute_definition IfcSurfaceStyleWithTextures_attributes[] = {
+	{ "Textures", false },
+};
+const attribute_definition IfcSurfaceTexture_attributes[] = {
+	{ "RepeatS", false },
+	{ "RepeatT", false },
+	{ "TextureType", true },
+	{ "TextureTransform", false },
+};
+const attribute_definition IfcSweptAreaSolid_attributes[] = {
+	{ "SweptArea", false },
+	{ "Position", false },
+};
+const attribute_definition IfcSweptDiskSolid_attributes[] = {
+	{ "Directrix", false },
+	{ "Radius", false },
+	{ "InnerRadius", false },
+	{ "StartParam", false },
+	{ "EndParam", false },
+};
+const attribute_definition IfcSweptSurface_attributes[] = {
+	{ "SweptCurve", false },
+	{ "Position", false },
+};
+const char * const IfcSweptSurface_derived[] = { "Dim" };
+const attribute_definition IfcSwitchingDeviceType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcSymbolStyle_attributes[] = {
+	{ "StyleOfSymbol", false },
+};
+const inverse_definition IfcSystem_inverses[] = {
+	{ "ServicesBuildings", "IfcRelServicesBuildings", "RelatingSystem" },
+};
+const attribute_definition IfcTShapeProfileDef_attributes[] = {
+	{ "Depth", false },
+	{ "FlangeWidth", false },
+	{ "WebThickness", false },
+	{ "FlangeThickness", false },
+	{ "FilletRadius", false },
+	{ "FlangeEdgeRadius", false },
+	{ "WebEdgeRadius", false },
+	{ "WebSlope", false },
+	{ "FlangeSlope", false },
+	{ "CentreOfGravityInY", false },
+};
+const attribute_definition IfcTable_attributes[] = {
+	{ "Name", false },
+	{ "Rows", false },
+};
+const char * const IfcTable_derived[] = { "NumberOfCellsInRow", "NumberOfHeadings", "NumberOfDataRows" };
+const attribute_definition IfcTableRow_attributes[] = {
+	{ "RowCells", false },
+	{ "IsHeading", false },
+};
+const inverse_definition IfcTableRow_inverses[] = {
+	{ "OfTable", "IfcTable", "Rows" },
+};
+const attribute_definition IfcTankType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcTask_attributes[] = {
+	{ "TaskId", false },
+	{ "Status", false },
+	{ "WorkMethod", false },
+	{ "IsMilestone", false },
+	{ "Priority", false },
+};
+const attribute_definition IfcTelecomAddress_attributes[] = {
+	{ "TelephoneNumbers", false },
+	{ "FacsimileNumbers", false },
+	{ "PagerNumber", false },
+	{ "ElectronicMailAddresses", false },
+	{ "WWWHomePageURL", false },
+};
+const attribute_definition IfcTendon_attributes[] = {
+	{ "PredefinedType", true },
+	{ "NominalDiameter", false },
+	{ "CrossSectionArea", false },
+	{ "TensionForce", false },
+	{ "PreStress", false },
+	{ "FrictionCoefficient", false },
+	{ "AnchorageSlip", false },
+	{ "MinCurvatureRadius", false },
+};
+const attribute_definition IfcTerminatorSymbol_attributes[] = {
+	{ "AnnotatedCurve", false },
+};
+const attribute_definition IfcTextLiteral_attributes[] = {
+	{ "Literal", false },
+	{ "Placement", false },
+	{ "Path", true },
+};
+const attribute_definition IfcTextLiteralWithExtent_attributes[] = {
+	{ "Extent", false },
+	{ "BoxAlignment", false },
+};
+const attribute_definition IfcTextStyle_attributes[] = {
+	{ "TextCharacterAppearance", false },
+	{ "TextStyle", false },
+	{ "TextFontStyle", false },
+};
+const attribute_definition IfcTextStyleFontModel_attributes[] = {
+	{ "FontFamily", false },
+	{ "FontStyle", false },
+	{ "FontVariant", false },
+	{ "FontWeight", false },
+	{ "FontSize", false },
+};
+const attribute_definition IfcTextStyleForDefinedFont_attributes[] = {
+	{ "Colour", false },
+	{ "BackgroundColour", false },
+};
+const attribute_definition IfcTextStyleTextModel_attributes[] = {
+	{ "TextIndent", false },
+	{ "TextAlign", false },
+	{ "TextDecoration", false },
+	{ "LetterSpacing", false },
+	{ "WordSpacing", false },
+	{ "TextTransform", false },
+	{ "LineHeight", false },
+};
+const attribute_definition IfcTextStyleWithBoxCharacteristics_attributes[] = {
+	{ "BoxHeight", false },
+	{ "BoxWidth", false },
+	{ "BoxSlantAngle", false },
+	{ "BoxRotateAngle", false },
+	{ "CharacterSpacing", false },
+};
+const inverse_definition IfcTextureCoordinate_inverses[] = {
+	{ "AnnotatedSurface", "IfcAnnotationSurface", "TextureCoordinates" },
+};
+const attribute_definition IfcTextureCoordinateGenerator_attributes[] = {
+	{ "Mode", false },
+	{ "Parameter", false },
+};
+const attribute_definition IfcTextureMap_attributes[] = {
+	{ "TextureMaps", false },
+};
+const attribute_definition IfcTextureVertex_attributes[] = {
+	{ "Coordinates", false },
+};
+const attribute_definition IfcThermalMaterialProperties_attributes[] = {
+	{ "SpecificHeatCapacity", false },
+	{ "BoilingPoint", false },
+	{ "FreezingPoint", false },
+	{ "ThermalConductivity", false },
+};
+const attribute_definition IfcTimeSeries_attributes[] = {
+	{ "Name", false },
+	{ "Description", false },
+	{ "StartTime", false },
+	{ "EndTime", false },
+	{ "TimeSeriesDataType", true },
+	{ "DataOrigin", true },
+	{ "UserDefinedDataOrigin", false },
+	{ "Unit", false },
+};
+const inverse_definition IfcTimeSeries_inverses[] = {
+	{ "DocumentedBy", "IfcTimeSeriesReferenceRelationship", "ReferencedTimeSeries" },
+};
+const attribute_definition IfcTimeSeriesReferenceRelationship_attributes[] = {
+	{ "ReferencedTimeSeries", false },
+	{ "TimeSeriesReferences", false },
+};
+const attribute_definition IfcTimeSeriesSchedule_attributes[] = {
+	{ "ApplicableDates", false },
+	{ "TimeSeriesScheduleType", true },
+	{ "TimeSeries", false },
+};
+const attribute_definition IfcTimeSeriesValue_attributes[] = {
+	{ "ListValues", false },
+};
+const attribute_definition IfcTransformerType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcTransportElement_attributes[] = {
+	{ "OperationType", true },
+	{ "CapacityByWeight", false },
+	{ "CapacityByNumber", false },
+};
+const attribute_definition IfcTransportElementType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcTrapeziumProfileDef_attributes[] = {
+	{ "BottomXDim", false },
+	{ "TopXDim", false },
+	{ "YDim", false },
+	{ "TopXOffset", false },
+};
+const attribute_definition IfcTrimmedCurve_attributes[] = {
+	{ "BasisCurve", false },
+	{ "Trim1", false },
+	{ "Trim2", false },
+	{ "SenseAgreement", false },
+	{ "MasterRepresentation", true },
+};
+const attribute_definition IfcTubeBundleType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcTwoDirectionRepeatFactor_attributes[] = {
+	{ "SecondRepeatFactor", false },
+};
+const attribute_definition IfcTypeObject_attributes[] = {
+	{ "ApplicableOccurrence", false },
+	{ "HasPropertySets", false },
+};
+const inverse_definition IfcTypeObject_inverses[] = {
+	{ "ObjectTypeOf", "IfcRelDefinesByType", "RelatingType" },
+};
+const attribute_definition IfcTypeProduct_attributes[] = {
+	{ "RepresentationMaps", false },
+	{ "Tag", false },
+};
+const attribute_definition IfcUShapeProfileDef_attributes[] = {
+	{ "Depth", false },
+	{ "FlangeWidth", false },
+	{ "WebThickness", false },
+	{ "FlangeThickness", false },
+	{ "FilletRadius", false },
+	{ "EdgeRadius", false },
+	{ "FlangeSlope", false },
+	{ "CentreOfGravityInX", false },
+};
+const attribute_definition IfcUnitAssignment_attributes[] = {
+	{ "Units", false },
+};
+const attribute_definition IfcUnitaryEquipmentType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcValveType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcVector_attributes[] = {
+	{ "Orientation", false },
+	{ "Magnitude", false },
+};
+const char * const IfcVector_derived[] = { "Dim" };
+const attribute_definition IfcVertexBasedTextureMap_attributes[] = {
+	{ "TextureVertices", false },
+	{ "TexturePoints", false },
+};
+const attribute_definition IfcVertexLoop_attributes[] = {
+	{ "LoopVertex", false },
+};
+const attribute_definition IfcVertexPoint_attributes[] = {
+	{ "VertexGeometry", false },
+};
+const attribute_definition IfcVibrationIsolatorType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcVirtualGridIntersection_attributes[] = {
+	{ "IntersectingAxes", false },
+	{ "OffsetDistances", false },
+};
+const attribute_definition IfcWallType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcWasteTerminalType_attributes[] = {
+	{ "PredefinedType", true },
+};
+const attribute_definition IfcWaterProperties_attributes[] = {
+	{ "IsPotable", false },
+	{ "Hardness", false },
+	{ "AlkalinityConcentration", false },
+	{ "AcidityConcentration", false },
+	{ "ImpuritiesContent", false },
+	{ "PHLevel", false },
+	{ "DissolvedSolidsContent", false },
+};
+const attribute_definition IfcWindow_attributes[] = {
+	{ "OverallHeight", false },
+	{ "OverallWidth", false },
+};
+const attribute_definition IfcWindowLiningProperties_attributes[] = {
+	{ "LiningDepth", false },
+	{ "LiningThickness", false },
+	{ "TransomThickness", false },
+	{ "MullionThickness", false },
+	{ "FirstTransomOffset", false },
+	{ "SecondTransomOffset", false },
+	{ "FirstMullionOffset", false },
+	{ "SecondMullionOffset", false },
+	{ "ShapeAspectStyle", false },
+};
+const attribute_definition IfcWindowPanelProperties_attributes[] = {
+	{ "OperationType", true },
+	{ "PanelPosition", true },
+	{ "FrameDepth", false },
+	{ "FrameThickness", false },
+	{ "ShapeAspectStyle", false },
+};
+const attribute_definition IfcWindowStyle_attributes[] = {
+	{ "ConstructionType", true },
+	{ "OperationType", true },
+	{ "ParameterTakesPrecedence", false },
+	{ "Sizeable", false },
+};
+const attribute_definition IfcWorkControl_attributes[] = {
+	{ "Identifier", false },
+	{ "CreationDate", false },
+	{ "Creators", false },
+	{ "Purpose", false },
+	{ "Duration", false },
+	{ "TotalFloat", false },
+	{ "StartTime", false },
+	{ "FinishTime", false },
+	{ "WorkControlType", true },
+	{ "UserDefinedControlType", false },
+};
+const attribute_definition IfcZShapeProfileDef_attributes[] = {
+	{ "Depth", false },
+	{ "FlangeWidth", false },
+	{ "WebThickness", false },
+	{ "FlangeThickness", false },
+	{ "FilletRadius", false },
+	{ "EdgeRadius", false },
+};
+
+const entity_definition ifc2x3_entities[] = {
+	{ "Ifc2DCompositeCurve", "IfcCompositeCurve", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcActionRequest", "IfcControl", IfcActionRequest_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcActor", "IfcObject", IfcActor_attributes, 1, IfcActor_inverses, 1, nullptr, 0 },
+	{ "IfcActorRole", nullptr, IfcActorRole_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcActuatorType", "IfcDistributionControlElementType", IfcActuatorType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcAddress", nullptr, IfcAddress_attributes, 3, IfcAddress_inverses, 2, nullptr, 0 },
+	{ "IfcAirTerminalBoxType", "IfcFlowControllerType", IfcAirTerminalBoxType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcAirTerminalType", "IfcFlowTerminalType", IfcAirTerminalType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcAirToAirHeatRecoveryType", "IfcEnergyConversionDeviceType", IfcAirToAirHeatRecoveryType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcAlarmType", "IfcDistributionControlElementType", IfcAlarmType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcAngularDimension", "IfcDimensionCurveDirectedCallout", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcAnnotation", "IfcProduct", nullptr, 0, IfcAnnotation_inverses, 1, nullptr, 0 },
+	{ "IfcAnnotationCurveOccurrence", "IfcAnnotationOccurrence", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcAnnotationFillArea", "IfcGeometricRepresentationItem", IfcAnnotationFillArea_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcAnnotationFillAreaOccurrence", "IfcAnnotationOccurrence", IfcAnnotationFillAreaOccurrence_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcAnnotationOccurrence", "IfcStyledItem", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcAnnotationSurface", "IfcGeometricRepresentationItem", IfcAnnotationSurface_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcAnnotationSurfaceOccurrence", "IfcAnnotationOccurrence", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcAnnotationSymbolOccurrence", "IfcAnnotationOccurrence", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcAnnotationTextOccurrence", "IfcAnnotationOccurrence", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcApplication", nullptr, IfcApplication_attributes, 4, nullptr, 0, nullptr, 0 },
+	{ "IfcAppliedValue", nullptr, IfcAppliedValue_attributes, 6, IfcAppliedValue_inverses, 3, nullptr, 0 },
+	{ "IfcAppliedValueRelationship", nullptr, IfcAppliedValueRelationship_attributes, 5, nullptr, 0, nullptr, 0 },
+	{ "IfcApproval", nullptr, IfcApproval_attributes, 7, IfcApproval_inverses, 3, nullptr, 0 },
+	{ "IfcApprovalActorRelationship", nullptr, IfcApprovalActorRelationship_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcApprovalPropertyRelationship", nullptr, IfcApprovalPropertyRelationship_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcApprovalRelationship", nullptr, IfcApprovalRelationship_attributes, 4, nullptr, 0, nullptr, 0 },
+	{ "IfcArbitraryClosedProfileDef", "IfcProfileDef", IfcArbitraryClosedProfileDef_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcArbitraryOpenProfileDef", "IfcProfileDef", IfcArbitraryOpenProfileDef_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcArbitraryProfileDefWithVoids", "IfcArbitraryClosedProfileDef", IfcArbitraryProfileDefWithVoids_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcAsset", "IfcGroup", IfcAsset_attributes, 9, nullptr, 0, nullptr, 0 },
+	{ "IfcAsymmetricIShapeProfileDef", "IfcIShapeProfileDef", IfcAsymmetricIShapeProfileDef_attributes, 4, nullptr, 0, nullptr, 0 },
+	{ "IfcAxis1Placement", "IfcPlacement", IfcAxis1Placement_attributes, 1, nullptr, 0, IfcAxis1Placement_derived, 1 },
+	{ "IfcAxis2Placement2D", "IfcPlacement", IfcAxis2Placement2D_attributes, 1, nullptr, 0, IfcAxis2Placement2D_derived, 1 },
+	{ "IfcAxis2Placement3D", "IfcPlacement", IfcAxis2Placement3D_attributes, 2, nullptr, 0, IfcAxis2Placement3D_derived, 1 },
+	{ "IfcBSplineCurve", "IfcBoundedCurve", IfcBSplineCurve_attributes, 5, nullptr, 0, IfcBSplineCurve_derived, 2 },
+	{ "IfcBeam", "IfcBuildingElement", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcBeamType", "IfcBuildingElementType", IfcBeamType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcBezierCurve", "IfcBSplineCurve", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcBlobTexture", "IfcSurfaceTexture", IfcBlobTexture_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcBlock", "IfcCsgPrimitive3D", IfcBlock_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcBoilerType", "IfcEnergyConversionDeviceType", IfcBoilerType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcBooleanClippingResult", "IfcBooleanResult", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcBooleanResult", "IfcGeometricRepresentationItem", IfcBooleanResult_attributes, 3, nullptr, 0, IfcBooleanResult_derived, 1 },
+	{ "IfcBoundaryCondition", nullptr, IfcBoundaryCondition_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcBoundaryEdgeCondition", "IfcBoundaryCondition", IfcBoundaryEdgeCondition_attributes, 6, nullptr, 0, nullptr, 0 },
+	{ "IfcBoundaryFaceCondition", "IfcBoundaryCondition", IfcBoundaryFaceCondition_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcBoundaryNodeCondition", "IfcBoundaryCondition", IfcBoundaryNodeCondition_attributes, 6, nullptr, 0, nullptr, 0 },
+	{ "IfcBoundaryNodeConditionWarping", "IfcBoundaryNodeCondition", IfcBoundaryNodeConditionWarping_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcBoundedCurve", "IfcCurve", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcBoundedSurface", "IfcSurface", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcBoundingBox", "IfcGeometricRepresentationItem", IfcBoundingBox_attributes, 4, nullptr, 0, IfcBoundingBox_derived, 1 },
+	{ "IfcBoxedHalfSpace", "IfcHalfSpaceSolid", IfcBoxedHalfSpace_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcBuilding", "IfcSpatialStructureElement", IfcBuilding_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcBuildingElement", "IfcElement", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcBuildingElementComponent", "IfcBuildingElement", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcBuildingElementPart", "IfcBuildingElementComponent", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcBuildingElementProxy", "IfcBuildingElement", IfcBuildingElementProxy_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcBuildingElementProxyType", "IfcBuildingElementType", IfcBuildingElementProxyType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcBuildingElementType", "IfcElementType", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcBuildingStorey", "IfcSpatialStructureElement", IfcBuildingStorey_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcCShapeProfileDef", "IfcParameterizedProfileDef", IfcCShapeProfileDef_attributes, 6, nullptr, 0, nullptr, 0 },
+	{ "IfcCableCarrierFittingType", "IfcFlowFittingType", IfcCableCarrierFittingType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcCableCarrierSegmentType", "IfcFlowSegmentType", IfcCableCarrierSegmentType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcCableSegmentType", "IfcFlowSegmentType", IfcCableSegmentType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcCalendarDate", nullptr, IfcCalendarDate_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcCartesianPoint", "IfcPoint", IfcCartesianPoint_attributes, 1, nullptr, 0, IfcCartesianPoint_derived, 1 },
+	{ "IfcCartesianTransformationOperator", "IfcGeometricRepresentationItem", IfcCartesianTransformationOperator_attributes, 4, nullptr, 0, IfcCartesianTransformationOperator_derived, 2 },
+	{ "IfcCartesianTransformationOperator2D", "IfcCartesianTransformationOperator", nullptr, 0, nullptr, 0, IfcCartesianTransformationOperator2D_derived, 1 },
+	{ "IfcCartesianTransformationOperator2DnonUniform", "IfcCartesianTransformationOperator2D", IfcCartesianTransformationOperator2DnonUniform_attributes, 1, nullptr, 0, IfcCartesianTransformationOperator2DnonUniform_derived, 1 },
+	{ "IfcCartesianTransformationOperator3D", "IfcCartesianTransformationOperator", IfcCartesianTransformationOperator3D_attributes, 1, nullptr, 0, IfcCartesianTransformationOperator3D_derived, 1 },
+	{ "IfcCartesianTransformationOperator3DnonUniform", "IfcCartesianTransformationOperator3D", IfcCartesianTransformationOperator3DnonUniform_attributes, 2, nullptr, 0, IfcCartesianTransformationOperator3DnonUniform_derived, 2 },
+	{ "IfcCenterLineProfileDef", "IfcArbitraryOpenProfileDef", IfcCenterLineProfileDef_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcChamferEdgeFeature", "IfcEdgeFeature", IfcChamferEdgeFeature_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcChillerType", "IfcEnergyConversionDeviceType", IfcChillerType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcCircle", "IfcConic", IfcCircle_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcCircleHollowProfileDef", "IfcCircleProfileDef", IfcCircleHollowProfileDef_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcCircleProfileDef", "IfcParameterizedProfileDef", IfcCircleProfileDef_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcClassification", nullptr, IfcClassification_attributes, 4, IfcClassification_inverses, 1, nullptr, 0 },
+	{ "IfcClassificationItem", nullptr, IfcClassificationItem_attributes, 3, IfcClassificationItem_inverses, 2, nullptr, 0 },
+	{ "IfcClassificationItemRelationship", nullptr, IfcClassificationItemRelationship_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcClassificationNotation", nullptr, IfcClassificationNotation_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcClassificationNotationFacet", nullptr, IfcClassificationNotationFacet_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcClassificationReference", "IfcExternalReference", IfcClassificationReference_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcClosedShell", "IfcConnectedFaceSet", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcCoilType", "IfcEnergyConversionDeviceType", IfcCoilType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcColourRgb", "IfcColourSpecification", IfcColourRgb_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcColourSpecification", nullptr, IfcColourSpecification_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcColumn", "IfcBuildingElement", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcColumnType", "IfcBuildingElementType", IfcColumnType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcComplexProperty", "IfcProperty", IfcComplexProperty_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcCompositeCurve", "IfcBoundedCurve", IfcCompositeCurve_attributes, 2, nullptr, 0, IfcCompositeCurve_derived, 2 },
+	{ "IfcCompositeCurveSegment", "IfcGeometricRepresentationItem", IfcCompositeCurveSegment_attributes, 3, IfcCompositeCurveSegment_inverses, 1, IfcCompositeCurveSegment_derived, 1 },
+	{ "IfcCompositeProfileDef", "IfcProfileDef", IfcCompositeProfileDef_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcCompressorType", "IfcFlowMovingDeviceType", IfcCompressorType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcCondenserType", "IfcEnergyConversionDeviceType", IfcCondenserType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcCondition", "IfcGroup", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcConditionCriterion", "IfcControl", IfcConditionCriterion_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcConic", "IfcCurve", IfcConic_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcConnectedFaceSet", "IfcTopologicalRepresentationItem", IfcConnectedFaceSet_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcConnectionCurveGeometry", "IfcConnectionGeometry", IfcConnectionCurveGeometry_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcConnectionGeometry", nullptr, nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcConnectionPointEccentricity", "IfcConnectionPointGeometry", IfcConnectionPointEccentricity_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcConnectionPointGeometry", "IfcConnectionGeometry", IfcConnectionPointGeometry_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcConnectionPortGeometry", "IfcConnectionGeometry", IfcConnectionPortGeometry_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcConnectionSurfaceGeometry", "IfcConnectionGeometry", IfcConnectionSurfaceGeometry_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcConstraint", nullptr, IfcConstraint_attributes, 7, IfcConstraint_inverses, 6, nullptr, 0 },
+	{ "IfcConstraintAggregationRelationship", nullptr, IfcConstraintAggregationRelationship_attributes, 5, nullptr, 0, nullptr, 0 },
+	{ "IfcConstraintClassificationRelationship", nullptr, IfcConstraintClassificationRelationship_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcConstraintRelationship", nullptr, IfcConstraintRelationship_attributes, 4, nullptr, 0, nullptr, 0 },
+	{ "IfcConstructionEquipmentResource", "IfcConstructionResource", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcConstructionMaterialResource", "IfcConstructionResource", IfcConstructionMaterialResource_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcConstructionProductResource", "IfcConstructionResource", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcConstructionResource", "IfcResource", IfcConstructionResource_attributes, 4, nullptr, 0, nullptr, 0 },
+	{ "IfcContextDependentUnit", "IfcNamedUnit", IfcContextDependentUnit_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcControl", "IfcObject", nullptr, 0, IfcControl_inverses, 1, nullptr, 0 },
+	{ "IfcControllerType", "IfcDistributionControlElementType", IfcControllerType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcConversionBasedUnit", "IfcNamedUnit", IfcConversionBasedUnit_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcCooledBeamType", "IfcEnergyConversionDeviceType", IfcCooledBeamType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcCoolingTowerType", "IfcEnergyConversionDeviceType", IfcCoolingTowerType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcCoordinatedUniversalTimeOffset", nullptr, IfcCoordinatedUniversalTimeOffset_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcCostItem", "IfcControl", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcCostSchedule", "IfcControl", IfcCostSchedule_attributes, 8, nullptr, 0, nullptr, 0 },
+	{ "IfcCostValue", "IfcAppliedValue", IfcCostValue_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcCovering", "IfcBuildingElement", IfcCovering_attributes, 1, IfcCovering_inverses, 2, nullptr, 0 },
+	{ "IfcCoveringType", "IfcBuildingElementType", IfcCoveringType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcCraneRailAShapeProfileDef", "IfcParameterizedProfileDef", IfcCraneRailAShapeProfileDef_attributes, 12, nullptr, 0, nullptr, 0 },
+	{ "IfcCraneRailFShapeProfileDef", "IfcParameterizedProfileDef", IfcCraneRailFShapeProfileDef_attributes, 9, nullptr, 0, nullptr, 0 },
+	{ "IfcCrewResource", "IfcConstructionResource", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcCsgPrimitive3D", "IfcGeometricRepresentationItem", IfcCsgPrimitive3D_attributes, 1, nullptr, 0, IfcCsgPrimitive3D_derived, 1 },
+	{ "IfcCsgSolid", "IfcSolidModel", IfcCsgSolid_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcCurrencyRelationship", nullptr, IfcCurrencyRelationship_attributes, 5, nullptr, 0, nullptr, 0 },
+	{ "IfcCurtainWall", "IfcBuildingElement", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcCurtainWallType", "IfcBuildingElementType", IfcCurtainWallType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcCurve", "IfcGeometricRepresentationItem", nullptr, 0, nullptr, 0, IfcCurve_derived, 1 },
+	{ "IfcCurveBoundedPlane", "IfcBoundedSurface", IfcCurveBoundedPlane_attributes, 3, nullptr, 0, IfcCurveBoundedPlane_derived, 1 },
+	{ "IfcCurveStyle", "IfcPresentationStyle", IfcCurveStyle_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcCurveStyleFont", nullptr, IfcCurveStyleFont_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcCurveStyleFontAndScaling", nullptr, IfcCurveStyleFontAndScaling_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcCurveStyleFontPattern", nullptr, IfcCurveStyleFontPattern_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcDamperType", "IfcFlowControllerType", IfcDamperType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcDateAndTime", nullptr, IfcDateAndTime_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcDefinedSymbol", "IfcGeometricRepresentationItem", IfcDefinedSymbol_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcDerivedProfileDef", "IfcProfileDef", IfcDerivedProfileDef_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcDerivedUnit", nullptr, IfcDerivedUnit_attributes, 3, nullptr, 0, IfcDerivedUnit_derived, 1 },
+	{ "IfcDerivedUnitElement", nullptr, IfcDerivedUnitElement_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcDiameterDimension", "IfcDimensionCurveDirectedCallout", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcDimensionCalloutRelationship", "IfcDraughtingCalloutRelationship", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcDimensionCurve", "IfcAnnotationCurveOccurrence", nullptr, 0, IfcDimensionCurve_inverses, 1, nullptr, 0 },
+	{ "IfcDimensionCurveDirectedCallout", "IfcDraughtingCallout", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcDimensionCurveTerminator", "IfcTerminatorSymbol", IfcDimensionCurveTerminator_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcDimensionPair", "IfcDraughtingCalloutRelationship", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcDimensionalExponents", nullptr, IfcDimensionalExponents_attributes, 7, nullptr, 0, nullptr, 0 },
+	{ "IfcDirection", "IfcGeometricRepresentationItem", IfcDirection_attributes, 1, nullptr, 0, IfcDirection_derived, 1 },
+	{ "IfcDiscreteAccessory", "IfcElementComponent", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcDiscreteAccessoryType", "IfcElementComponentType", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcDistributionChamberElement", "IfcDistributionFlowElement", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcDistributionChamberElementType", "IfcDistributionFlowElementType", IfcDistributionChamberElementType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcDistributionControlElement", "IfcDistributionElement", IfcDistributionControlElement_attributes, 1, IfcDistributionControlElement_inverses, 1, nullptr, 0 },
+	{ "IfcDistributionControlElementType", "IfcDistributionElementType", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcDistributionElement", "IfcElement", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcDistributionElementType", "IfcElementType", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcDistributionFlowElement", "IfcDistributionElement", nullptr, 0, IfcDistributionFlowElement_inverses, 1, nullptr, 0 },
+	{ "IfcDistributionFlowElementType", "IfcDistributionElementType", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcDistributionPort", "IfcPort", IfcDistributionPort_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcDocumentElectronicFormat", nullptr, IfcDocumentElectronicFormat_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcDocumentInformation", nullptr, IfcDocumentInformation_attributes, 17, IfcDocumentInformation_inverses, 2, nullptr, 0 },
+	{ "IfcDocumentInformationRelationship", nullptr, IfcDocumentInformationRelationship_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcDocumentReference", "IfcExternalReference", nullptr, 0, IfcDocumentReference_inverses, 1, nullptr, 0 },
+	{ "IfcDoor", "IfcBuildingElement", IfcDoor_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcDoorLiningProperties", "IfcPropertySetDefinition", IfcDoorLiningProperties_attributes, 11, nullptr, 0, nullptr, 0 },
+	{ "IfcDoorPanelProperties", "IfcPropertySetDefinition", IfcDoorPanelProperties_attributes, 5, nullptr, 0, nullptr, 0 },
+	{ "IfcDoorStyle", "IfcTypeProduct", IfcDoorStyle_attributes, 4, nullptr, 0, nullptr, 0 },
+	{ "IfcDraughtingCallout", "IfcGeometricRepresentationItem", IfcDraughtingCallout_attributes, 1, IfcDraughtingCallout_inverses, 2, nullptr, 0 },
+	{ "IfcDraughtingCalloutRelationship", nullptr, IfcDraughtingCalloutRelationship_attributes, 4, nullptr, 0, nullptr, 0 },
+	{ "IfcDraughtingPreDefinedColour", "IfcPreDefinedColour", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcDraughtingPreDefinedCurveFont", "IfcPreDefinedCurveFont", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcDraughtingPreDefinedTextFont", "IfcPreDefinedTextFont", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcDuctFittingType", "IfcFlowFittingType", IfcDuctFittingType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcDuctSegmentType", "IfcFlowSegmentType", IfcDuctSegmentType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcDuctSilencerType", "IfcFlowTreatmentDeviceType", IfcDuctSilencerType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcEdge", "IfcTopologicalRepresentationItem", IfcEdge_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcEdgeCurve", "IfcEdge", IfcEdgeCurve_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcEdgeFeature", "IfcFeatureElementSubtraction", IfcEdgeFeature_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcEdgeLoop", "IfcLoop", IfcEdgeLoop_attributes, 1, nullptr, 0, IfcEdgeLoop_derived, 1 },
+	{ "IfcElectricApplianceType", "IfcFlowTerminalType", IfcElectricApplianceType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcElectricDistributionPoint", "IfcFlowController", IfcElectricDistributionPoint_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcElectricFlowStorageDeviceType", "IfcFlowStorageDeviceType", IfcElectricFlowStorageDeviceType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcElectricGeneratorType", "IfcEnergyConversionDeviceType", IfcElectricGeneratorType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcElectricHeaterType", "IfcFlowTerminalType", IfcElectricHeaterType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcElectricMotorType", "IfcEnergyConversionDeviceType", IfcElectricMotorType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcElectricTimeControlType", "IfcFlowControllerType", IfcElectricTimeControlType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcElectricalBaseProperties", "IfcEnergyProperties", IfcElectricalBaseProperties_attributes, 8, nullptr, 0, nullptr, 0 },
+	{ "IfcElectricalCircuit", "IfcSystem", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcElectricalElement", "IfcElement", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcElement", "IfcProduct", IfcElement_attributes, 1, IfcElement_inverses, 12, nullptr, 0 },
+	{ "IfcElementAssembly", "IfcElement", IfcElementAssembly_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcElementComponent", "IfcElement", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcElementComponentType", "IfcElementType", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcElementQuantity", "IfcPropertySetDefinition", IfcElementQuantity_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcElementType", "IfcTypeProduct", IfcElementType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcElementarySurface", "IfcSurface", IfcElementarySurface_attributes, 1, nullptr, 0, IfcElementarySurface_derived, 1 },
+	{ "IfcEllipse", "IfcConic", IfcEllipse_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcEllipseProfileDef", "IfcParameterizedProfileDef", IfcEllipseProfileDef_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcEnergyConversionDevice", "IfcDistributionFlowElement", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcEnergyConversionDeviceType", "IfcDistributionFlowElementType", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcEnergyProperties", "IfcPropertySetDefinition", IfcEnergyProperties_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcEnvironmentalImpactValue", "IfcAppliedValue", IfcEnvironmentalImpactValue_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcEquipmentElement", "IfcElement", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcEquipmentStandard", "IfcControl", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcEvaporativeCoolerType", "IfcEnergyConversionDeviceType", IfcEvaporativeCoolerType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcEvaporatorType", "IfcEnergyConversionDeviceType", IfcEvaporatorType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcExtendedMaterialProperties", "IfcMaterialProperties", IfcExtendedMaterialProperties_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcExternalReference", nullptr, IfcExternalReference_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcExternallyDefinedHatchStyle", "IfcExternalReference", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcExternallyDefinedSurfaceStyle", "IfcExternalReference", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcExternallyDefinedSymbol", "IfcExternalReference", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcExternallyDefinedTextFont", "IfcExternalReference", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcExtrudedAreaSolid", "IfcSweptAreaSolid", IfcExtrudedAreaSolid_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcFace", "IfcTopologicalRepresentationItem", IfcFace_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcFaceBasedSurfaceModel", "IfcGeometricRepresentationItem", IfcFaceBasedSurfaceModel_attributes, 1, nullptr, 0, IfcFaceBasedSurfaceModel_derived, 1 },
+	{ "IfcFaceBound", "IfcTopologicalRepresentationItem", IfcFaceBound_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcFaceOuterBound", "IfcFaceBound", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcFaceSurface", "IfcFace", IfcFaceSurface_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcFacetedBrep", "IfcManifoldSolidBrep", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcFacetedBrepWithVoids", "IfcManifoldSolidBrep", IfcFacetedBrepWithVoids_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcFailureConnectionCondition", "IfcStructuralConnectionCondition", IfcFailureConnectionCondition_attributes, 6, nullptr, 0, nullptr, 0 },
+	{ "IfcFanType", "IfcFlowMovingDeviceType", IfcFanType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcFastener", "IfcElementComponent", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcFastenerType", "IfcElementComponentType", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcFeatureElement", "IfcElement", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcFeatureElementAddition", "IfcFeatureElement", nullptr, 0, IfcFeatureElementAddition_inverses, 1, nullptr, 0 },
+	{ "IfcFeatureElementSubtraction", "IfcFeatureElement", nullptr, 0, IfcFeatureElementSubtraction_inverses, 1, nullptr, 0 },
+	{ "IfcFillAreaStyle", "IfcPresentationStyle", IfcFillAreaStyle_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcFillAreaStyleHatching", "IfcGeometricRepresentationItem", IfcFillAreaStyleHatching_attributes, 5, nullptr, 0, nullptr, 0 },
+	{ "IfcFillAreaStyleTileSymbolWithStyle", "IfcGeometricRepresentationItem", IfcFillAreaStyleTileSymbolWithStyle_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcFillAreaStyleTiles", "IfcGeometricRepresentationItem", IfcFillAreaStyleTiles_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcFilterType", "IfcFlowTreatmentDeviceType", IfcFilterType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcFireSuppressionTerminalType", "IfcFlowTerminalType", IfcFireSuppressionTerminalType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcFlowController", "IfcDistributionFlowElement", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcFlowControllerType", "IfcDistributionFlowElementType", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcFlowFitting", "IfcDistributionFlowElement", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcFlowFittingType", "IfcDistributionFlowElementType", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcFlowInstrumentType", "IfcDistributionControlElementType", IfcFlowInstrumentType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcFlowMeterType", "IfcFlowControllerType", IfcFlowMeterType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcFlowMovingDevice", "IfcDistributionFlowElement", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcFlowMovingDeviceType", "IfcDistributionFlowElementType", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcFlowSegment", "IfcDistributionFlowElement", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcFlowSegmentType", "IfcDistributionFlowElementType", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcFlowStorageDevice", "IfcDistributionFlowElement", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcFlowStorageDeviceType", "IfcDistributionFlowElementType", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcFlowTerminal", "IfcDistributionFlowElement", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcFlowTerminalType", "IfcDistributionFlowElementType", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcFlowTreatmentDevice", "IfcDistributionFlowElement", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcFlowTreatmentDeviceType", "IfcDistributionFlowElementType", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcFluidFlowProperties", "IfcPropertySetDefinition", IfcFluidFlowProperties_attributes, 15, nullptr, 0, nullptr, 0 },
+	{ "IfcFooting", "IfcBuildingElement", IfcFooting_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcFuelProperties", "IfcMaterialProperties", IfcFuelProperties_attributes, 4, nullptr, 0, nullptr, 0 },
+	{ "IfcFurnishingElement", "IfcElement", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcFurnishingElementType", "IfcElementType", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcFurnitureStandard", "IfcControl", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcFurnitureType", "IfcFurnishingElementType", IfcFurnitureType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcGasTerminalType", "IfcFlowTerminalType", IfcGasTerminalType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcGeneralMaterialProperties", "IfcMaterialProperties", IfcGeneralMaterialProperties_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcGeneralProfileProperties", "IfcProfileProperties", IfcGeneralProfileProperties_attributes, 5, nullptr, 0, nullptr, 0 },
+	{ "IfcGeometricCurveSet", "IfcGeometricSet", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcGeometricRepresentationContext", "IfcRepresentationContext", IfcGeometricRepresentationContext_attributes, 4, IfcGeometricRepresentationContext_inverses, 1, nullptr, 0 },
+	{ "IfcGeometricRepresentationItem", "IfcRepresentationItem", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcGeometricRepresentationSubContext", "IfcGeometricRepresentationContext", IfcGeometricRepresentationSubContext_attributes, 4, nullptr, 0, IfcGeometricRepresentationSubContext_derived, 4 },
+	{ "IfcGeometricSet", "IfcGeometricRepresentationItem", IfcGeometricSet_attributes, 1, nullptr, 0, IfcGeometricSet_derived, 1 },
+	{ "IfcGrid", "IfcProduct", IfcGrid_attributes, 3, IfcGrid_inverses, 1, nullptr, 0 },
+	{ "IfcGridAxis", nullptr, IfcGridAxis_attributes, 3, IfcGridAxis_inverses, 4, nullptr, 0 },
+	{ "IfcGridPlacement", "IfcObjectPlacement", IfcGridPlacement_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcGroup", "IfcObject", nullptr, 0, IfcGroup_inverses, 1, nullptr, 0 },
+	{ "IfcHalfSpaceSolid", "IfcGeometricRepresentationItem", IfcHalfSpaceSolid_attributes, 2, nullptr, 0, IfcHalfSpaceSolid_derived, 1 },
+	{ "IfcHeatExchangerType", "IfcEnergyConversionDeviceType", IfcHeatExchangerType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcHumidifierType", "IfcEnergyConversionDeviceType", IfcHumidifierType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcHygroscopicMaterialProperties", "IfcMaterialProperties", IfcHygroscopicMaterialProperties_attributes, 5, nullptr, 0, nullptr, 0 },
+	{ "IfcIShapeProfileDef", "IfcParameterizedProfileDef", IfcIShapeProfileDef_attributes, 5, nullptr, 0, nullptr, 0 },
+	{ "IfcImageTexture", "IfcSurfaceTexture", IfcImageTexture_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcInventory", "IfcGroup", IfcInventory_attributes, 6, nullptr, 0, nullptr, 0 },
+	{ "IfcIrregularTimeSeries", "IfcTimeSeries", IfcIrregularTimeSeries_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcIrregularTimeSeriesValue", nullptr, IfcIrregularTimeSeriesValue_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcJunctionBoxType", "IfcFlowFittingType", IfcJunctionBoxType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcLShapeProfileDef", "IfcParameterizedProfileDef", IfcLShapeProfileDef_attributes, 8, nullptr, 0, nullptr, 0 },
+	{ "IfcLaborResource", "IfcConstructionResource", IfcLaborResource_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcLampType", "IfcFlowTerminalType", IfcLampType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcLibraryInformation", nullptr, IfcLibraryInformation_attributes, 5, nullptr, 0, nullptr, 0 },
+	{ "IfcLibraryReference", "IfcExternalReference", nullptr, 0, IfcLibraryReference_inverses, 1, nullptr, 0 },
+	{ "IfcLightDistributionData", nullptr, IfcLightDistributionData_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcLightFixtureType", "IfcFlowTerminalType", IfcLightFixtureType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcLightIntensityDistribution", nullptr, IfcLightIntensityDistribution_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcLightSource", "IfcGeometricRepresentationItem", IfcLightSource_attributes, 4, nullptr, 0, nullptr, 0 },
+	{ "IfcLightSourceAmbient", "IfcLightSource", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcLightSourceDirectional", "IfcLightSource", IfcLightSourceDirectional_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcLightSourceGoniometric", "IfcLightSource", IfcLightSourceGoniometric_attributes, 6, nullptr, 0, nullptr, 0 },
+	{ "IfcLightSourcePositional", "IfcLightSource", IfcLightSourcePositional_attributes, 5, nullptr, 0, nullptr, 0 },
+	{ "IfcLightSourceSpot", "IfcLightSourcePositional", IfcLightSourceSpot_attributes, 4, nullptr, 0, nullptr, 0 },
+	{ "IfcLine", "IfcCurve", IfcLine_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcLinearDimension", "IfcDimensionCurveDirectedCallout", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcLocalPlacement", "IfcObjectPlacement", IfcLocalPlacement_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcLocalTime", nullptr, IfcLocalTime_attributes, 5, nullptr, 0, nullptr, 0 },
+	{ "IfcLoop", "IfcTopologicalRepresentationItem", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcManifoldSolidBrep", "IfcSolidModel", IfcManifoldSolidBrep_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcMappedItem", "IfcRepresentationItem", IfcMappedItem_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcMaterial", nullptr, IfcMaterial_attributes, 1, IfcMaterial_inverses, 2, nullptr, 0 },
+	{ "IfcMaterialClassificationRelationship", nullptr, IfcMaterialClassificationRelationship_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcMaterialDefinitionRepresentation", "IfcProductRepresentation", IfcMaterialDefinitionRepresentation_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcMaterialLayer", nullptr, IfcMaterialLayer_attributes, 3, IfcMaterialLayer_inverses, 1, nullptr, 0 },
+	{ "IfcMaterialLayerSet", nullptr, IfcMaterialLayerSet_attributes, 2, nullptr, 0, IfcMaterialLayerSet_derived, 1 },
+	{ "IfcMaterialLayerSetUsage", nullptr, IfcMaterialLayerSetUsage_attributes, 4, nullptr, 0, nullptr, 0 },
+	{ "IfcMaterialList", nullptr, IfcMaterialList_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcMaterialProperties", nullptr, IfcMaterialProperties_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcMeasureWithUnit", nullptr, IfcMeasureWithUnit_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcMechanicalConcreteMaterialProperties", "IfcMechanicalMaterialProperties", IfcMechanicalConcreteMaterialProperties_attributes, 6, nullptr, 0, nullptr, 0 },
+	{ "IfcMechanicalFastener", "IfcFastener", IfcMechanicalFastener_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcMechanicalFastenerType", "IfcFastenerType", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcMechanicalMaterialProperties", "IfcMaterialProperties", IfcMechanicalMaterialProperties_attributes, 5, nullptr, 0, nullptr, 0 },
+	{ "IfcMechanicalSteelMaterialProperties", "IfcMechanicalMaterialProperties", IfcMechanicalSteelMaterialProperties_attributes, 7, nullptr, 0, nullptr, 0 },
+	{ "IfcMember", "IfcBuildingElement", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcMemberType", "IfcBuildingElementType", IfcMemberType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcMetric", "IfcConstraint", IfcMetric_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcMonetaryUnit", nullptr, IfcMonetaryUnit_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcMotorConnectionType", "IfcEnergyConversionDeviceType", IfcMotorConnectionType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcMove", "IfcTask", IfcMove_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcNamedUnit", nullptr, IfcNamedUnit_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcObject", "IfcObjectDefinition", IfcObject_attributes, 1, IfcObject_inverses, 1, nullptr, 0 },
+	{ "IfcObjectDefinition", "IfcRoot", nullptr, 0, IfcObjectDefinition_inverses, 4, nullptr, 0 },
+	{ "IfcObjectPlacement", nullptr, nullptr, 0, IfcObjectPlacement_inverses, 2, nullptr, 0 },
+	{ "IfcObjective", "IfcConstraint", IfcObjective_attributes, 4, nullptr, 0, nullptr, 0 },
+	{ "IfcOccupant", "IfcActor", IfcOccupant_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcOffsetCurve2D", "IfcCurve", IfcOffsetCurve2D_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcOffsetCurve3D", "IfcCurve", IfcOffsetCurve3D_attributes, 4, nullptr, 0, nullptr, 0 },
+	{ "IfcOneDirectionRepeatFactor", "IfcGeometricRepresentationItem", IfcOneDirectionRepeatFactor_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcOpenShell", "IfcConnectedFaceSet", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcOpeningElement", "IfcFeatureElementSubtraction", nullptr, 0, IfcOpeningElement_inverses, 1, nullptr, 0 },
+	{ "IfcOpticalMaterialProperties", "IfcMaterialProperties", IfcOpticalMaterialProperties_attributes, 9, nullptr, 0, nullptr, 0 },
+	{ "IfcOrderAction", "IfcTask", IfcOrderAction_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcOrganization", nullptr, IfcOrganization_attributes, 5, IfcOrganization_inverses, 3, nullptr, 0 },
+	{ "IfcOrganizationRelationship", nullptr, IfcOrganizationRelationship_attributes, 4, nullptr, 0, nullptr, 0 },
+	{ "IfcOrientedEdge", "IfcEdge", IfcOrientedEdge_attributes, 2, nullptr, 0, IfcOrientedEdge_derived, 2 },
+	{ "IfcOutletType", "IfcFlowTerminalType", IfcOutletType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcOwnerHistory", nullptr, IfcOwnerHistory_attributes, 8, nullptr, 0, nullptr, 0 },
+	{ "IfcParameterizedProfileDef", "IfcProfileDef", IfcParameterizedProfileDef_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcPath", "IfcTopologicalRepresentationItem", IfcPath_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcPerformanceHistory", "IfcControl", IfcPerformanceHistory_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcPermeableCoveringProperties", "IfcPropertySetDefinition", IfcPermeableCoveringProperties_attributes, 5, nullptr, 0, nullptr, 0 },
+	{ "IfcPermit", "IfcControl", IfcPermit_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcPerson", nullptr, IfcPerson_attributes, 8, IfcPerson_inverses, 1, nullptr, 0 },
+	{ "IfcPersonAndOrganization", nullptr, IfcPersonAndOrganization_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcPhysicalComplexQuantity", "IfcPhysicalQuantity", IfcPhysicalComplexQuantity_attributes, 4, nullptr, 0, nullptr, 0 },
+	{ "IfcPhysicalQuantity", nullptr, IfcPhysicalQuantity_attributes, 2, IfcPhysicalQuantity_inverses, 1, nullptr, 0 },
+	{ "IfcPhysicalSimpleQuantity", "IfcPhysicalQuantity", IfcPhysicalSimpleQuantity_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcPile", "IfcBuildingElement", IfcPile_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcPipeFittingType", "IfcFlowFittingType", IfcPipeFittingType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcPipeSegmentType", "IfcFlowSegmentType", IfcPipeSegmentType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcPixelTexture", "IfcSurfaceTexture", IfcPixelTexture_attributes, 4, nullptr, 0, nullptr, 0 },
+	{ "IfcPlacement", "IfcGeometricRepresentationItem", IfcPlacement_attributes, 1, nullptr, 0, IfcPlacement_derived, 1 },
+	{ "IfcPlanarBox", "IfcPlanarExtent", IfcPlanarBox_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcPlanarExtent", "IfcGeometricRepresentationItem", IfcPlanarExtent_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcPlane", "IfcElementarySurface", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcPlate", "IfcBuildingElement", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcPlateType", "IfcBuildingElementType", IfcPlateType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcPoint", "IfcGeometricRepresentationItem", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcPointOnCurve", "IfcPoint", IfcPointOnCurve_attributes, 2, nullptr, 0, IfcPointOnCurve_derived, 1 },
+	{ "IfcPointOnSurface", "IfcPoint", IfcPointOnSurface_attributes, 3, nullptr, 0, IfcPointOnSurface_derived, 1 },
+	{ "IfcPolyLoop", "IfcLoop", IfcPolyLoop_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcPolygonalBoundedHalfSpace", "IfcHalfSpaceSolid", IfcPolygonalBoundedHalfSpace_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcPolyline", "IfcBoundedCurve", IfcPolyline_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcPort", "IfcProduct", nullptr, 0, IfcPort_inverses, 3, nullptr, 0 },
+	{ "IfcPostalAddress", "IfcAddress", IfcPostalAddress_attributes, 7, nullptr, 0, nullptr, 0 },
+	{ "IfcPreDefinedColour", "IfcPreDefinedItem", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcPreDefinedCurveFont", "IfcPreDefinedItem", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcPreDefinedDimensionSymbol", "IfcPreDefinedSymbol", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcPreDefinedItem", nullptr, IfcPreDefinedItem_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcPreDefinedPointMarkerSymbol", "IfcPreDefinedSymbol", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcPreDefinedSymbol", "IfcPreDefinedItem", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcPreDefinedTerminatorSymbol", "IfcPreDefinedSymbol", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcPreDefinedTextFont", "IfcPreDefinedItem", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcPresentationLayerAssignment", nullptr, IfcPresentationLayerAssignment_attributes, 4, nullptr, 0, nullptr, 0 },
+	{ "IfcPresentationLayerWithStyle", "IfcPresentationLayerAssignment", IfcPresentationLayerWithStyle_attributes, 4, nullptr, 0, nullptr, 0 },
+	{ "IfcPresentationStyle", nullptr, IfcPresentationStyle_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcPresentationStyleAssignment", nullptr, IfcPresentationStyleAssignment_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcProcedure", "IfcProcess", IfcProcedure_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcProcess", "IfcObject", nullptr, 0, IfcProcess_inverses, 3, nullptr, 0 },
+	{ "IfcProduct", "IfcObject", IfcProduct_attributes, 2, IfcProduct_inverses, 1, nullptr, 0 },
+	{ "IfcProductDefinitionShape", "IfcProductRepresentation", nullptr, 0, IfcProductDefinitionShape_inverses, 2, nullptr, 0 },
+	{ "IfcProductRepresentation", nullptr, IfcProductRepresentation_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcProductsOfCombustionProperties", "IfcMaterialProperties", IfcProductsOfCombustionProperties_attributes, 4, nullptr, 0, nullptr, 0 },
+	{ "IfcProfileDef", nullptr, IfcProfileDef_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcProfileProperties", nullptr, IfcProfileProperties_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcProject", "IfcObject", IfcProject_attributes, 4, nullptr, 0, nullptr, 0 },
+	{ "IfcProjectOrder", "IfcControl", IfcProjectOrder_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcProjectOrderRecord", "IfcControl", IfcProjectOrderRecord_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcProjectionCurve", "IfcAnnotationCurveOccurrence", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcProjectionElement", "IfcFeatureElementAddition", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcProperty", nullptr, IfcProperty_attributes, 2, IfcProperty_inverses, 3, nullptr, 0 },
+	{ "IfcPropertyBoundedValue", "IfcSimpleProperty", IfcPropertyBoundedValue_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcPropertyConstraintRelationship", nullptr, IfcPropertyConstraintRelationship_attributes, 4, nullptr, 0, nullptr, 0 },
+	{ "IfcPropertyDefinition", "IfcRoot", nullptr, 0, IfcPropertyDefinition_inverses, 1, nullptr, 0 },
+	{ "IfcPropertyDependencyRelationship", nullptr, IfcPropertyDependencyRelationship_attributes, 5, nullptr, 0, nullptr, 0 },
+	{ "IfcPropertyEnumeratedValue", "IfcSimpleProperty", IfcPropertyEnumeratedValue_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcPropertyEnumeration", nullptr, IfcPropertyEnumeration_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcPropertyListValue", "IfcSimpleProperty", IfcPropertyListValue_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcPropertyReferenceValue", "IfcSimpleProperty", IfcPropertyReferenceValue_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcPropertySet", "IfcPropertySetDefinition", IfcPropertySet_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcPropertySetDefinition", "IfcPropertyDefinition", nullptr, 0, IfcPropertySetDefinition_inverses, 2, nullptr, 0 },
+	{ "IfcPropertySingleValue", "IfcSimpleProperty", IfcPropertySingleValue_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcPropertyTableValue", "IfcSimpleProperty", IfcPropertyTableValue_attributes, 5, nullptr, 0, nullptr, 0 },
+	{ "IfcProtectiveDeviceType", "IfcFlowControllerType", IfcProtectiveDeviceType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcProxy", "IfcProduct", IfcProxy_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcPumpType", "IfcFlowMovingDeviceType", IfcPumpType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcQuantityArea", "IfcPhysicalSimpleQuantity", IfcQuantityArea_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcQuantityCount", "IfcPhysicalSimpleQuantity", IfcQuantityCount_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcQuantityLength", "IfcPhysicalSimpleQuantity", IfcQuantityLength_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcQuantityTime", "IfcPhysicalSimpleQuantity", IfcQuantityTime_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcQuantityVolume", "IfcPhysicalSimpleQuantity", IfcQuantityVolume_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcQuantityWeight", "IfcPhysicalSimpleQuantity", IfcQuantityWeight_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcRadiusDimension", "IfcDimensionCurveDirectedCallout", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcRailing", "IfcBuildingElement", IfcRailing_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcRailingType", "IfcBuildingElementType", IfcRailingType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcRamp", "IfcBuildingElement", IfcRamp_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcRampFlight", "IfcBuildingElement", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcRampFlightType", "IfcBuildingElementType", IfcRampFlightType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcRationalBezierCurve", "IfcBezierCurve", IfcRationalBezierCurve_attributes, 1, nullptr, 0, IfcRationalBezierCurve_derived, 1 },
+	{ "IfcRectangleHollowProfileDef", "IfcRectangleProfileDef", IfcRectangleHollowProfileDef_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcRectangleProfileDef", "IfcParameterizedProfileDef", IfcRectangleProfileDef_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcRectangularPyramid", "IfcCsgPrimitive3D", IfcRectangularPyramid_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcRectangularTrimmedSurface", "IfcBoundedSurface", IfcRectangularTrimmedSurface_attributes, 7, nullptr, 0, IfcRectangularTrimmedSurface_derived, 1 },
+	{ "IfcReferencesValueDocument", nullptr, IfcReferencesValueDocument_attributes, 4, nullptr, 0, nullptr, 0 },
+	{ "IfcRegularTimeSeries", "IfcTimeSeries", IfcRegularTimeSeries_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcReinforcementBarProperties", nullptr, IfcReinforcementBarProperties_attributes, 6, nullptr, 0, nullptr, 0 },
+	{ "IfcReinforcementDefinitionProperties", "IfcPropertySetDefinition", IfcReinforcementDefinitionProperties_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcReinforcingBar", "IfcReinforcingElement", IfcReinforcingBar_attributes, 5, nullptr, 0, nullptr, 0 },
+	{ "IfcReinforcingElement", "IfcBuildingElementComponent", IfcReinforcingElement_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcReinforcingMesh", "IfcReinforcingElement", IfcReinforcingMesh_attributes, 8, nullptr, 0, nullptr, 0 },
+	{ "IfcRelAggregates", "IfcRelDecomposes", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcRelAssigns", "IfcRelationship", IfcRelAssigns_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcRelAssignsTasks", "IfcRelAssignsToControl", IfcRelAssignsTasks_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcRelAssignsToActor", "IfcRelAssigns", IfcRelAssignsToActor_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcRelAssignsToControl", "IfcRelAssigns", IfcRelAssignsToControl_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcRelAssignsToGroup", "IfcRelAssigns", IfcRelAssignsToGroup_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcRelAssignsToProcess", "IfcRelAssigns", IfcRelAssignsToProcess_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcRelAssignsToProduct", "IfcRelAssigns", IfcRelAssignsToProduct_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcRelAssignsToProjectOrder", "IfcRelAssignsToControl", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcRelAssignsToResource", "IfcRelAssigns", IfcRelAssignsToResource_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcRelAssociates", "IfcRelationship", IfcRelAssociates_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcRelAssociatesAppliedValue", "IfcRelAssociates", IfcRelAssociatesAppliedValue_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcRelAssociatesApproval", "IfcRelAssociates", IfcRelAssociatesApproval_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcRelAssociatesClassification", "IfcRelAssociates", IfcRelAssociatesClassification_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcRelAssociatesConstraint", "IfcRelAssociates", IfcRelAssociatesConstraint_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcRelAssociatesDocument", "IfcRelAssociates", IfcRelAssociatesDocument_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcRelAssociatesLibrary", "IfcRelAssociates", IfcRelAssociatesLibrary_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcRelAssociatesMaterial", "IfcRelAssociates", IfcRelAssociatesMaterial_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcRelAssociatesProfileProperties", "IfcRelAssociates", IfcRelAssociatesProfileProperties_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcRelConnects", "IfcRelationship", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcRelConnectsElements", "IfcRelConnects", IfcRelConnectsElements_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcRelConnectsPathElements", "IfcRelConnectsElements", IfcRelConnectsPathElements_attributes, 4, nullptr, 0, IfcRelConnectsPathElements_derived, 2 },
+	{ "IfcRelConnectsPortToElement", "IfcRelConnects", IfcRelConnectsPortToElement_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcRelConnectsPorts", "IfcRelConnects", IfcRelConnectsPorts_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcRelConnectsStructuralActivity", "IfcRelConnects", IfcRelConnectsStructuralActivity_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcRelConnectsStructuralElement", "IfcRelConnects", IfcRelConnectsStructuralElement_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcRelConnectsStructuralMember", "IfcRelConnects", IfcRelConnectsStructuralMember_attributes, 6, nullptr, 0, nullptr, 0 },
+	{ "IfcRelConnectsWithEccentricity", "IfcRelConnectsStructuralMember", IfcRelConnectsWithEccentricity_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcRelConnectsWithRealizingElements", "IfcRelConnectsElements", IfcRelConnectsWithRealizingElements_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcRelContainedInSpatialStructure", "IfcRelConnects", IfcRelContainedInSpatialStructure_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcRelCoversBldgElements", "IfcRelConnects", IfcRelCoversBldgElements_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcRelCoversSpaces", "IfcRelConnects", IfcRelCoversSpaces_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcRelDecomposes", "IfcRelationship", IfcRelDecomposes_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcRelDefines", "IfcRelationship", IfcRelDefines_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcRelDefinesByProperties", "IfcRelDefines", IfcRelDefinesByProperties_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcRelDefinesByType", "IfcRelDefines", IfcRelDefinesByType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcRelFillsElement", "IfcRelConnects", IfcRelFillsElement_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcRelFlowControlElements", "IfcRelConnects", IfcRelFlowControlElements_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcRelInteractionRequirements", "IfcRelConnects", IfcRelInteractionRequirements_attributes, 5, nullptr, 0, nullptr, 0 },
+	{ "IfcRelNests", "IfcRelDecomposes", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcRelOccupiesSpaces", "IfcRelAssignsToActor", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcRelOverridesProperties", "IfcRelDefinesByProperties", IfcRelOverridesProperties_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcRelProjectsElement", "IfcRelConnects", IfcRelProjectsElement_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcRelReferencedInSpatialStructure", "IfcRelConnects", IfcRelReferencedInSpatialStructure_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcRelSchedulesCostItems", "IfcRelAssignsToControl", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcRelSequence", "IfcRelConnects", IfcRelSequence_attributes, 4, nullptr, 0, nullptr, 0 },
+	{ "IfcRelServicesBuildings", "IfcRelConnects", IfcRelServicesBuildings_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcRelSpaceBoundary", "IfcRelConnects", IfcRelSpaceBoundary_attributes, 5, nullptr, 0, nullptr, 0 },
+	{ "IfcRelVoidsElement", "IfcRelConnects", IfcRelVoidsElement_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcRelationship", "IfcRoot", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcRelaxation", nullptr, IfcRelaxation_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcRepresentation", nullptr, IfcRepresentation_attributes, 4, IfcRepresentation_inverses, 3, nullptr, 0 },
+	{ "IfcRepresentationContext", nullptr, IfcRepresentationContext_attributes, 2, IfcRepresentationContext_inverses, 1, nullptr, 0 },
+	{ "IfcRepresentationItem", nullptr, nullptr, 0, IfcRepresentationItem_inverses, 2, nullptr, 0 },
+	{ "IfcRepresentationMap", nullptr, IfcRepresentationMap_attributes, 2, IfcRepresentationMap_inverses, 1, nullptr, 0 },
+	{ "IfcResource", "IfcObject", nullptr, 0, IfcResource_inverses, 1, nullptr, 0 },
+	{ "IfcRevolvedAreaSolid", "IfcSweptAreaSolid", IfcRevolvedAreaSolid_attributes, 2, nullptr, 0, IfcRevolvedAreaSolid_derived, 1 },
+	{ "IfcRibPlateProfileProperties", "IfcProfileProperties", IfcRibPlateProfileProperties_attributes, 5, nullptr, 0, nullptr, 0 },
+	{ "IfcRightCircularCone", "IfcCsgPrimitive3D", IfcRightCircularCone_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcRightCircularCylinder", "IfcCsgPrimitive3D", IfcRightCircularCylinder_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcRoof", "IfcBuildingElement", IfcRoof_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcRoot", nullptr, IfcRoot_attributes, 4, nullptr, 0, nullptr, 0 },
+	{ "IfcRoundedEdgeFeature", "IfcEdgeFeature", IfcRoundedEdgeFeature_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcRoundedRectangleProfileDef", "IfcRectangleProfileDef", IfcRoundedRectangleProfileDef_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcSIUnit", "IfcNamedUnit", IfcSIUnit_attributes, 2, nullptr, 0, IfcSIUnit_derived, 1 },
+	{ "IfcSanitaryTerminalType", "IfcFlowTerminalType", IfcSanitaryTerminalType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcScheduleTimeControl", "IfcControl", IfcScheduleTimeControl_attributes, 18, IfcScheduleTimeControl_inverses, 1, nullptr, 0 },
+	{ "IfcSectionProperties", nullptr, IfcSectionProperties_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcSectionReinforcementProperties", nullptr, IfcSectionReinforcementProperties_attributes, 6, nullptr, 0, nullptr, 0 },
+	{ "IfcSectionedSpine", "IfcGeometricRepresentationItem", IfcSectionedSpine_attributes, 3, nullptr, 0, IfcSectionedSpine_derived, 1 },
+	{ "IfcSensorType", "IfcDistributionControlElementType", IfcSensorType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcServiceLife", "IfcControl", IfcServiceLife_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcServiceLifeFactor", "IfcPropertySetDefinition", IfcServiceLifeFactor_attributes, 4, nullptr, 0, nullptr, 0 },
+	{ "IfcShapeAspect", nullptr, IfcShapeAspect_attributes, 5, nullptr, 0, nullptr, 0 },
+	{ "IfcShapeModel", "IfcRepresentation", nullptr, 0, IfcShapeModel_inverses, 1, nullptr, 0 },
+	{ "IfcShapeRepresentation", "IfcShapeModel", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcShellBasedSurfaceModel", "IfcGeometricRepresentationItem", IfcShellBasedSurfaceModel_attributes, 1, nullptr, 0, IfcShellBasedSurfaceModel_derived, 1 },
+	{ "IfcSimpleProperty", "IfcProperty", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcSite", "IfcSpatialStructureElement", IfcSite_attributes, 5, nullptr, 0, nullptr, 0 },
+	{ "IfcSlab", "IfcBuildingElement", IfcSlab_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcSlabType", "IfcBuildingElementType", IfcSlabType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcSlippageConnectionCondition", "IfcStructuralConnectionCondition", IfcSlippageConnectionCondition_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcSolidModel", "IfcGeometricRepresentationItem", nullptr, 0, nullptr, 0, IfcSolidModel_derived, 1 },
+	{ "IfcSoundProperties", "IfcPropertySetDefinition", IfcSoundProperties_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcSoundValue", "IfcPropertySetDefinition", IfcSoundValue_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcSpace", "IfcSpatialStructureElement", IfcSpace_attributes, 2, IfcSpace_inverses, 2, nullptr, 0 },
+	{ "IfcSpaceHeaterType", "IfcEnergyConversionDeviceType", IfcSpaceHeaterType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcSpaceProgram", "IfcControl", IfcSpaceProgram_attributes, 5, IfcSpaceProgram_inverses, 2, nullptr, 0 },
+	{ "IfcSpaceThermalLoadProperties", "IfcPropertySetDefinition", IfcSpaceThermalLoadProperties_attributes, 10, nullptr, 0, nullptr, 0 },
+	{ "IfcSpaceType", "IfcSpatialStructureElementType", IfcSpaceType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcSpatialStructureElement", "IfcProduct", IfcSpatialStructureElement_attributes, 2, IfcSpatialStructureElement_inverses, 3, nullptr, 0 },
+	{ "IfcSpatialStructureElementType", "IfcElementType", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcSphere", "IfcCsgPrimitive3D", IfcSphere_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcStackTerminalType", "IfcFlowTerminalType", IfcStackTerminalType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcStair", "IfcBuildingElement", IfcStair_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcStairFlight", "IfcBuildingElement", IfcStairFlight_attributes, 4, nullptr, 0, nullptr, 0 },
+	{ "IfcStairFlightType", "IfcBuildingElementType", IfcStairFlightType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcStructuralAction", "IfcStructuralActivity", IfcStructuralAction_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcStructuralActivity", "IfcProduct", IfcStructuralActivity_attributes, 2, IfcStructuralActivity_inverses, 1, nullptr, 0 },
+	{ "IfcStructuralAnalysisModel", "IfcSystem", IfcStructuralAnalysisModel_attributes, 4, nullptr, 0, nullptr, 0 },
+	{ "IfcStructuralConnection", "IfcStructuralItem", IfcStructuralConnection_attributes, 1, IfcStructuralConnection_inverses, 1, nullptr, 0 },
+	{ "IfcStructuralConnectionCondition", nullptr, IfcStructuralConnectionCondition_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcStructuralCurveConnection", "IfcStructuralConnection", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcStructuralCurveMember", "IfcStructuralMember", IfcStructuralCurveMember_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcStructuralCurveMemberVarying", "IfcStructuralCurveMember", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcStructuralItem", "IfcProduct", nullptr, 0, IfcStructuralItem_inverses, 1, nullptr, 0 },
+	{ "IfcStructuralLinearAction", "IfcStructuralAction", IfcStructuralLinearAction_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcStructuralLinearActionVarying", "IfcStructuralLinearAction", IfcStructuralLinearActionVarying_attributes, 2, nullptr, 0, IfcStructuralLinearActionVarying_derived, 1 },
+	{ "IfcStructuralLoad", nullptr, IfcStructuralLoad_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcStructuralLoadGroup", "IfcGroup", IfcStructuralLoadGroup_attributes, 5, IfcStructuralLoadGroup_inverses, 2, nullptr, 0 },
+	{ "IfcStructuralLoadLinearForce", "IfcStructuralLoadStatic", IfcStructuralLoadLinearForce_attributes, 6, nullptr, 0, nullptr, 0 },
+	{ "IfcStructuralLoadPlanarForce", "IfcStructuralLoadStatic", IfcStructuralLoadPlanarForce_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcStructuralLoadSingleDisplacement", "IfcStructuralLoadStatic", IfcStructuralLoadSingleDisplacement_attributes, 6, nullptr, 0, nullptr, 0 },
+	{ "IfcStructuralLoadSingleDisplacementDistortion", "IfcStructuralLoadSingleDisplacement", IfcStructuralLoadSingleDisplacementDistortion_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcStructuralLoadSingleForce", "IfcStructuralLoadStatic", IfcStructuralLoadSingleForce_attributes, 6, nullptr, 0, nullptr, 0 },
+	{ "IfcStructuralLoadSingleForceWarping", "IfcStructuralLoadSingleForce", IfcStructuralLoadSingleForceWarping_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcStructuralLoadStatic", "IfcStructuralLoad", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcStructuralLoadTemperature", "IfcStructuralLoadStatic", IfcStructuralLoadTemperature_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcStructuralMember", "IfcStructuralItem", nullptr, 0, IfcStructuralMember_inverses, 2, nullptr, 0 },
+	{ "IfcStructuralPlanarAction", "IfcStructuralAction", IfcStructuralPlanarAction_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcStructuralPlanarActionVarying", "IfcStructuralPlanarAction", IfcStructuralPlanarActionVarying_attributes, 2, nullptr, 0, IfcStructuralPlanarActionVarying_derived, 1 },
+	{ "IfcStructuralPointAction", "IfcStructuralAction", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcStructuralPointConnection", "IfcStructuralConnection", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcStructuralPointReaction", "IfcStructuralReaction", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcStructuralProfileProperties", "IfcGeneralProfileProperties", IfcStructuralProfileProperties_attributes, 16, nullptr, 0, nullptr, 0 },
+	{ "IfcStructuralReaction", "IfcStructuralActivity", nullptr, 0, IfcStructuralReaction_inverses, 1, nullptr, 0 },
+	{ "IfcStructuralResultGroup", "IfcGroup", IfcStructuralResultGroup_attributes, 3, IfcStructuralResultGroup_inverses, 1, nullptr, 0 },
+	{ "IfcStructuralSteelProfileProperties", "IfcStructuralProfileProperties", IfcStructuralSteelProfileProperties_attributes, 4, nullptr, 0, nullptr, 0 },
+	{ "IfcStructuralSurfaceConnection", "IfcStructuralConnection", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcStructuralSurfaceMember", "IfcStructuralMember", IfcStructuralSurfaceMember_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcStructuralSurfaceMemberVarying", "IfcStructuralSurfaceMember", IfcStructuralSurfaceMemberVarying_attributes, 2, nullptr, 0, IfcStructuralSurfaceMemberVarying_derived, 1 },
+	{ "IfcStructuredDimensionCallout", "IfcDraughtingCallout", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcStyleModel", "IfcRepresentation", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcStyledItem", "IfcRepresentationItem", IfcStyledItem_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcStyledRepresentation", "IfcStyleModel", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcSubContractResource", "IfcConstructionResource", IfcSubContractResource_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcSubedge", "IfcEdge", IfcSubedge_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcSurface", "IfcGeometricRepresentationItem", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcSurfaceCurveSweptAreaSolid", "IfcSweptAreaSolid", IfcSurfaceCurveSweptAreaSolid_attributes, 4, nullptr, 0, nullptr, 0 },
+	{ "IfcSurfaceOfLinearExtrusion", "IfcSweptSurface", IfcSurfaceOfLinearExtrusion_attributes, 2, nullptr, 0, IfcSurfaceOfLinearExtrusion_derived, 1 },
+	{ "IfcSurfaceOfRevolution", "IfcSweptSurface", IfcSurfaceOfRevolution_attributes, 1, nullptr, 0, IfcSurfaceOfRevolution_derived, 1 },
+	{ "IfcSurfaceStyle", "IfcPresentationStyle", IfcSurfaceStyle_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcSurfaceStyleLighting", nullptr, IfcSurfaceStyleLighting_attributes, 4, nullptr, 0, nullptr, 0 },
+	{ "IfcSurfaceStyleRefraction", nullptr, IfcSurfaceStyleRefraction_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcSurfaceStyleRendering", "IfcSurfaceStyleShading", IfcSurfaceStyleRendering_attributes, 8, nullptr, 0, nullptr, 0 },
+	{ "IfcSurfaceStyleShading", nullptr, IfcSurfaceStyleShading_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcSurfaceStyleWithTextures", nullptr, IfcSurfaceStyleWithTextures_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcSurfaceTexture", nullptr, IfcSurfaceTexture_attributes, 4, nullptr, 0, nullptr, 0 },
+	{ "IfcSweptAreaSolid", "IfcSolidModel", IfcSweptAreaSolid_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcSweptDiskSolid", "IfcSolidModel", IfcSweptDiskSolid_attributes, 5, nullptr, 0, nullptr, 0 },
+	{ "IfcSweptSurface", "IfcSurface", IfcSweptSurface_attributes, 2, nullptr, 0, IfcSweptSurface_derived, 1 },
+	{ "IfcSwitchingDeviceType", "IfcFlowControllerType", IfcSwitchingDeviceType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcSymbolStyle", "IfcPresentationStyle", IfcSymbolStyle_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcSystem", "IfcGroup", nullptr, 0, IfcSystem_inverses, 1, nullptr, 0 },
+	{ "IfcSystemFurnitureElementType", "IfcFurnishingElementType", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcTShapeProfileDef", "IfcParameterizedProfileDef", IfcTShapeProfileDef_attributes, 10, nullptr, 0, nullptr, 0 },
+	{ "IfcTable", nullptr, IfcTable_attributes, 2, nullptr, 0, IfcTable_derived, 3 },
+	{ "IfcTableRow", nullptr, IfcTableRow_attributes, 2, IfcTableRow_inverses, 1, nullptr, 0 },
+	{ "IfcTankType", "IfcFlowStorageDeviceType", IfcTankType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcTask", "IfcProcess", IfcTask_attributes, 5, nullptr, 0, nullptr, 0 },
+	{ "IfcTelecomAddress", "IfcAddress", IfcTelecomAddress_attributes, 5, nullptr, 0, nullptr, 0 },
+	{ "IfcTendon", "IfcReinforcingElement", IfcTendon_attributes, 8, nullptr, 0, nullptr, 0 },
+	{ "IfcTendonAnchor", "IfcReinforcingElement", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcTerminatorSymbol", "IfcAnnotationSymbolOccurrence", IfcTerminatorSymbol_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcTextLiteral", "IfcGeometricRepresentationItem", IfcTextLiteral_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcTextLiteralWithExtent", "IfcTextLiteral", IfcTextLiteralWithExtent_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcTextStyle", "IfcPresentationStyle", IfcTextStyle_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcTextStyleFontModel", "IfcPreDefinedTextFont", IfcTextStyleFontModel_attributes, 5, nullptr, 0, nullptr, 0 },
+	{ "IfcTextStyleForDefinedFont", nullptr, IfcTextStyleForDefinedFont_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcTextStyleTextModel", nullptr, IfcTextStyleTextModel_attributes, 7, nullptr, 0, nullptr, 0 },
+	{ "IfcTextStyleWithBoxCharacteristics", nullptr, IfcTextStyleWithBoxCharacteristics_attributes, 5, nullptr, 0, nullptr, 0 },
+	{ "IfcTextureCoordinate", nullptr, nullptr, 0, IfcTextureCoordinate_inverses, 1, nullptr, 0 },
+	{ "IfcTextureCoordinateGenerator", "IfcTextureCoordinate", IfcTextureCoordinateGenerator_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcTextureMap", "IfcTextureCoordinate", IfcTextureMap_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcTextureVertex", nullptr, IfcTextureVertex_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcThermalMaterialProperties", "IfcMaterialProperties", IfcThermalMaterialProperties_attributes, 4, nullptr, 0, nullptr, 0 },
+	{ "IfcTimeSeries", nullptr, IfcTimeSeries_attributes, 8, IfcTimeSeries_inverses, 1, nullptr, 0 },
+	{ "IfcTimeSeriesReferenceRelationship", nullptr, IfcTimeSeriesReferenceRelationship_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcTimeSeriesSchedule", "IfcControl", IfcTimeSeriesSchedule_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcTimeSeriesValue", nullptr, IfcTimeSeriesValue_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcTopologicalRepresentationItem", "IfcRepresentationItem", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcTopologyRepresentation", "IfcShapeModel", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcTransformerType", "IfcEnergyConversionDeviceType", IfcTransformerType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcTransportElement", "IfcElement", IfcTransportElement_attributes, 3, nullptr, 0, nullptr, 0 },
+	{ "IfcTransportElementType", "IfcElementType", IfcTransportElementType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcTrapeziumProfileDef", "IfcParameterizedProfileDef", IfcTrapeziumProfileDef_attributes, 4, nullptr, 0, nullptr, 0 },
+	{ "IfcTrimmedCurve", "IfcBoundedCurve", IfcTrimmedCurve_attributes, 5, nullptr, 0, nullptr, 0 },
+	{ "IfcTubeBundleType", "IfcEnergyConversionDeviceType", IfcTubeBundleType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcTwoDirectionRepeatFactor", "IfcOneDirectionRepeatFactor", IfcTwoDirectionRepeatFactor_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcTypeObject", "IfcObjectDefinition", IfcTypeObject_attributes, 2, IfcTypeObject_inverses, 1, nullptr, 0 },
+	{ "IfcTypeProduct", "IfcTypeObject", IfcTypeProduct_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcUShapeProfileDef", "IfcParameterizedProfileDef", IfcUShapeProfileDef_attributes, 8, nullptr, 0, nullptr, 0 },
+	{ "IfcUnitAssignment", nullptr, IfcUnitAssignment_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcUnitaryEquipmentType", "IfcEnergyConversionDeviceType", IfcUnitaryEquipmentType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcValveType", "IfcFlowControllerType", IfcValveType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcVector", "IfcGeometricRepresentationItem", IfcVector_attributes, 2, nullptr, 0, IfcVector_derived, 1 },
+	{ "IfcVertex", "IfcTopologicalRepresentationItem", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcVertexBasedTextureMap", nullptr, IfcVertexBasedTextureMap_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcVertexLoop", "IfcLoop", IfcVertexLoop_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcVertexPoint", "IfcVertex", IfcVertexPoint_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcVibrationIsolatorType", "IfcDiscreteAccessoryType", IfcVibrationIsolatorType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcVirtualElement", "IfcElement", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcVirtualGridIntersection", nullptr, IfcVirtualGridIntersection_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcWall", "IfcBuildingElement", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcWallStandardCase", "IfcWall", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcWallType", "IfcBuildingElementType", IfcWallType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcWasteTerminalType", "IfcFlowTerminalType", IfcWasteTerminalType_attributes, 1, nullptr, 0, nullptr, 0 },
+	{ "IfcWaterProperties", "IfcMaterialProperties", IfcWaterProperties_attributes, 7, nullptr, 0, nullptr, 0 },
+	{ "IfcWindow", "IfcBuildingElement", IfcWindow_attributes, 2, nullptr, 0, nullptr, 0 },
+	{ "IfcWindowLiningProperties", "IfcPropertySetDefinition", IfcWindowLiningProperties_attributes, 9, nullptr, 0, nullptr, 0 },
+	{ "IfcWindowPanelProperties", "IfcPropertySetDefinition", IfcWindowPanelProperties_attributes, 5, nullptr, 0, nullptr, 0 },
+	{ "IfcWindowStyle", "IfcTypeProduct", IfcWindowStyle_attributes, 4, nullptr, 0, nullptr, 0 },
+	{ "IfcWorkControl", "IfcControl", IfcWorkControl_attributes, 10, nullptr, 0, nullptr, 0 },
+	{ "IfcWorkPlan", "IfcWorkControl", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcWorkSchedule", "IfcWorkControl", nullptr, 0, nullptr, 0, nullptr, 0 },
+	{ "IfcZShapeProfileDef", "IfcParameterizedProfileDef", IfcZShapeProfileDef_attributes, 6, nullptr, 0, nullptr, 0 },
+	{ "IfcZone", "IfcGroup", nullptr, 0, nullptr, 0, nullptr, 0 },
+};
+
+} // namespace
+
+const entity_definition * ifc2x3_entity_definitions() { return ifc2x3_entities; }
+size_t ifc2x3_entity_definition_count() { return sizeof(ifc2x3_entities) / sizeof(ifc2x3_entities[0]); }
+
+} // namespace spf
@@ -0,0 +1,247 @@
+#include <ctime>
+
+#include <boost/interprocess/exceptions.hpp>
+
+#include "../Edm Wrapper/edm_wrapper_native_interface.h"
+
+#include "ifc_model_internals.h"
+#include "ifc_object.h"
+
+using namespace spf;
+
+namespace ifc_interface {
+
+namespace {
+
+const entity_type * find_type(const char * name) {
+	return schema::ifc2x3().find(name);
+}
+
+boost::optional<entity_id> first_of_kind(const instance_store & store, const char * type) {
+	boost::optional<entity_id> res;
+	store.for_each_of_kind(*find_type(type), [&res](entity_id id) {
+		if (!res) { res = id; }
+	});
+	return res;
+}
+
+boost::optional<entity_id> reference_field(instance_store * store, entity_id id, const char * name) {
+	value v;
+	if (store->field(id, name, &v) && v.untyped().kind == value::REFERENCE) { return v.untyped().ref; }
+	return boost::optional<entity_id>();
+}
+
+double length_units_per_meter(instance_store * store, entity_id unit) {
+	const entity_type * t = store->type_of(unit);
+	if (!t) { return 1.0; }
+	if (t->is_kind_of(*find_type("IfcSIUnit"))) {
+		value prefix;
+		if (store->field(unit, "Prefix", &prefix) && prefix.kind == value::ENUMERATION) {
+			if (prefix.text == "MEGA") { return 1e-6; }
+			else if (prefix.text == "KILO") { return 1e-3; }
+			else if (prefix.text == "HECTO") { return 1e-2; }
+			else if (prefix.text == "DECA") { return 1e-1; }
+			else if (prefix.text == "DECI") { return 1e1; }
+			else if (prefix.text == "CENTI") { return 1e2; }
+			else if (prefix.text == "MILLI") { return 1e3; }
+			else if (prefix.text == "MICRO") { return 1e6; }
+		}
+	}
+	else if (t->is_kind_of(*find_type("IfcConversionBasedUnit"))) {
+		auto factor = reference_field(store, unit, "ConversionFactor");
+		value magnitude;
+		if (factor && store->field(*factor, "ValueComponent", &magnitude)) {
+			auto component = reference_field(store, *factor, "UnitComponent");
+			double base = component ? length_units_per_meter(store, *component) : 1.0;
+			return base / magnitude.untyped().number;
+		}
+	}
+	return 1.0;
+}
+
+// The innermost ownership scope on each thread.
+thread_local_pointer g_current_scope;
+
+} // namespace
+
+struct ownership_scope::internals {
+	model * m;
+	ownership_scope * outer;
+	std::list<ifc_object> objects;
+};
+
+ownership_scope::ownership_scope(model * m) : d_(new internals) {
+	d_->m = m;
+	d_->outer = static_cast<ownership_scope *>(g_current_scope.get());
+	g_current_scope.set(this);
+}
+
+ownership_scope::~ownership_scope() {
+	g_current_scope.set(d_->outer);
+	delete d_;
+}
+
+model::model(const char * path) : d_(new internals) {
+	try { d_->open(path); }
+	catch (std::exception & e) { d_->last_error = e.what(); }
+}
+
+model::~model() {
+	delete d_;
+}
+
+bool model::loaded_ok() const { return d_->is_open(); }
+
+const std::string & model::last_error() const { return d_->last_error; }
+
+std::vector<const ifc_object *> model::building_elements() {
+	std::vector<const ifc_object *> res;
+	d_->for_each_of_kind(*find_type("IfcBuildingElement"), [this, &res](entity_id id) {
+		res.push_back(take_ownership(ifc_object(value::make_reference(id), this, d_)));
+	});
+	return res;
+}
+
+std::vector<const ifc_object *> model::spaces() {
+	std::vector<const ifc_object *> res;
+	d_->for_each_of_kind(*find_type("IfcSpace"), [this, &res](entity_id id) {
+		res.push_back(take_ownership(ifc_object(value::make_reference(id), this, d_)));
+	});
+	return res;
+}
+
+double model::length_units_per_meter() const {
+	double res = 1.0;
+	auto project = first_of_kind(*d_, "IfcProject");
+	if (!project) { return res; }
+	auto assignment = reference_field(d_, *project, "UnitsInContext");
+	value units;
+	if (!assignment || !d_->field(*assignment, "Units", &units) || units.kind != value::LIST) { return res; }
+	for (auto u = units.items.begin(); u != units.items.end(); ++u) {
+		if (u->kind != value::REFERENCE) { continue; }
+		const entity_type * t = d_->type_of(u->ref);
+		value type;
+		if (t && t->is_kind_of(*find_type("IfcNamedUnit")) &&
+			d_->field(u->ref, "UnitType", &type) && type.text == "LENGTHUNIT")
+		{
+			res = ifc_interface::length_units_per_meter(d_, u->ref);
+		}
+	}
+	return res;
+}
+
+void model::write(const std::string & path) const {
+	try { d_->write(path); }
+	catch (std::exception & e) { d_->last_error = e.what(); }
+}
+
+ifc_object * model::create_curve(
+	const std::vector<std::pair<double, double>> & points)
+{
+	entity_id curve = d_->create(*find_type("IfcPolyline"));
+	value pts(value::LIST);
+	for (auto p = points.begin(); p != points.end(); ++p) {
+		ifc_object * pt = this->create_point(p->first, p->second);
+		pts.items.push_back(pt->data());
+	}
+	d_->set_field(curve, "Points", pts);
+	return take_ownership(ifc_object(value::make_reference(curve), this, d_));
+}
+
+ifc_object * model::create_direction(double dx, double dy, double dz) {
+	entity_id direction = d_->create(*find_type("IfcDirection"));
+	value ratios(value::LIST);
+	ratios.items.push_back(value::make_real(dx));
+	ratios.items.push_back(value::make_real(dy));
+	ratios.items.push_back(value::make_real(dz));
+	d_->set_field(direction, "DirectionRatios", ratios);
+	return take_ownership(ifc_object(value::make_reference(direction), this, d_));
+}
+
+ifc_object * model::create_object(
+	const std::string & type,
+	bool with_owner_history)
+{
+	if (with_owner_history && !d_->owner_history) { return nullptr; }
+	const entity_type * t = schema::ifc2x3().find(type);
+	if (!t) { return nullptr; }
+	entity_id obj = d_->create(*t);
+	if (with_owner_history) {
+		d_->set_field(obj, "OwnerHistory", value::make_reference(*d_->owner_history));
+	}
+	return take_ownership(ifc_object(value::make_reference(obj), this, d_));
+}
+
+ifc_object * model::create_point(double x, double y) {
+	entity_id point = d_->create(*find_type("IfcCartesianPoint"));
+	value coords(value::LIST);
+	coords.items.push_back(value::make_real(x));
+	coords.items.push_back(value::make_real(y));
+	d_->set_field(point, "Coordinates", coords);
+	return take_ownership(ifc_object(value::make_reference(point), this, d_));
+}
+
+ifc_object * model::create_point(double x, double y, double z) {
+	entity_id point = d_->create(*find_type("IfcCartesianPoint"));
+	value coords(value::LIST);
+	coords.items.push_back(value::make_real(x));
+	coords.items.push_back(value::make_real(y));
+	coords.items.push_back(value::make_real(z));
+	d_->set_field(point, "Coordinates", coords);
+	return take_ownership(ifc_object(value::make_reference(point), this, d_));
+}
+
+void model::invalidate_all_ownership_pointers() {
+	scoped_lock lock(d_->mutex());
+	d_->known_instances.clear();
+	d_->known_objects.clear();
+}
+
+void model::remove_all_space_boundaries() {
+	std::vector<entity_id> sbs;
+	d_->for_each_of_kind(*find_type("IfcRelSpaceBoundary"), [&sbs](entity_id id) { sbs.push_back(id); });
+	for (auto sb = sbs.begin(); sb != sbs.end(); ++sb) { d_->remove(*sb); }
+}
+
+bool model::set_new_owner_history(
+	const char * app_full_name,
+	const char * app_identifier,
+	const char * app_version,
+	const char * organization)
+{
+	auto existing = first_of_kind(*d_, "IfcOwnerHistory");
+	if (!existing) { return false; }
+	entity_id inst = d_->clone(*existing);
+	if (inst == 0) { return false; }
+	d_->set_field(inst, "ChangeAction", value::make_enumeration("ADDED"));
+	entity_id app = d_->create(*find_type("IfcApplication"));
+	entity_id org = d_->create(*find_type("IfcOrganization"));
+	d_->set_field(org, "Name", value::make_string(organization));
+	d_->set_field(app, "ApplicationDeveloper", value::make_reference(org));
+	d_->set_field(app, "Version", value::make_string(app_version));
+	d_->set_field(app, "ApplicationFullName", value::make_string(app_full_name));
+	d_->set_field(app, "ApplicationIdentifier", value::make_string(app_identifier));
+	d_->set_field(inst, "LastModifyingApplication", value::make_reference(app));
+	d_->set_field(inst, "CreationDate", value::make_integer((int)time(NULL)));
+	d_->owner_history = inst;
+	return true;
+}
+
+ifc_object * model::take_ownership(ifc_object && obj) {
+	if (obj.data().kind == value::REFERENCE) {
+		scoped_lock lock(d_->mutex());
+		entity_id id = obj.data().ref;
+		return &d_->known_instances.insert(std::make_pair(id, obj)).first->second;
+	}
+	auto scope = static_cast<ownership_scope *>(g_current_scope.get());
+	while (scope && scope->d_->m != this) { scope = scope->d_->outer; }
+	if (scope) {
+		scope->d_->objects.push_back(obj);
+		return &scope->d_->objects.back();
+	}
+	scoped_lock lock(d_->mutex());
+	d_->known_objects.push_back(obj);
+	return &d_->known_objects.back();
+}
+
+} // namespace ifc_interface
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <list>
+#include <string>
+#include <unordered_map>
+
+#include <boost/optional.hpp>
+
+#include "../Edm Wrapper/edm_wrapper_native_interface.h"
+
+#include "ifc_object.h"
+#include "instance_store.h"
+
+namespace ifc_interface {
+
+struct model::internals : public spf::instance_store {
+	// Both guarded by the store's mutex. Instance references are handed out
+	// once per instance; other values (which are rare) once per request.
+	std::unordered_map<spf::entity_id, ifc_object> known_instances;
+	std::list<ifc_object> known_objects;
+	boost::optional<spf::entity_id> owner_history;
+	std::string last_error;
+};
+
+} // namespace ifc_interface
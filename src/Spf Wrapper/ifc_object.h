@@ -0,0 +1,26 @@
+#pragma once
+
+#include "instance_store.h"
+#include "spf_value.h"
+
+namespace ifc_interface {
+
+class model;
+
+// An instance reference or a plain value (like an element of a list of
+// reals), along with the store it came from.
+class ifc_object {
+public:
+	ifc_object(const spf::value & v, model * m, spf::instance_store * store) : data_(v), m_(m), store_(store) { }
+
+	const spf::value & data() const { return data_; }
+	model * parent_model() const { return m_; }
+	spf::instance_store * store() const { return store_; }
+
+private:
+	spf::value data_;
+	model * m_;
+	spf::instance_store * store_;
+};
+
+} // namespace ifc_interface
@@ -0,0 +1,168 @@
+#include "../Edm Wrapper/edm_wrapper_native_interface.h"
+
+#include "ifc_object.h"
+
+using namespace spf;
+
+namespace ifc_interface {
+
+namespace {
+
+// Looks up a field of an instance, looking through typed parameters.
+bool get_field(const ifc_object & obj, const char * field_name, value * res) {
+	if (obj.data().kind != value::REFERENCE) { return false; }
+	try {
+		if (!obj.store()->field(obj.data().ref, field_name, res)) { return false; }
+		*res = value(res->untyped());
+		return true;
+	}
+	catch (...) { return false; }
+}
+
+ifc_object * own(const ifc_object & parent, const value & v) {
+	model * m = parent.parent_model();
+	return m->take_ownership(ifc_object(v, m, parent.store()));
+}
+
+bool is_number(const value & v) {
+	return v.kind == value::REAL || v.kind == value::INTEGER;
+}
+
+} // namespace
+
+bool is_kind_of(const ifc_object & obj, const char * type) {
+	if (obj.data().kind != value::REFERENCE) { return false; }
+	const entity_type * t = schema::ifc2x3().find(type);
+	const entity_type * actual = obj.store()->type_of(obj.data().ref);
+	return t && actual && actual->is_kind_of(*t);
+}
+
+bool is_instance_of(const ifc_object & obj, const char * type) {
+	if (obj.data().kind != value::REFERENCE) { return false; }
+	const entity_type * t = schema::ifc2x3().find(type);
+	return t && obj.store()->type_of(obj.data().ref) == t;
+}
+
+bool boolean_field(
+	const ifc_object & obj, 
+	const char * field_name,
+	bool * res)
+{
+	value v;
+	if (!get_field(obj, field_name, &v) || v.kind != value::ENUMERATION) { return false; }
+	if (v.text == "T") { *res = true; }
+	else if (v.text == "F") { *res = false; }
+	else { return false; }
+	return true;
+}
+
+bool collection_field(
+	const ifc_object & obj, 
+	const char * field_name,
+	std::vector<ifc_object *> * res)
+{
+	value v;
+	if (!get_field(obj, field_name, &v) || v.kind != value::LIST) { return false; }
+	*res = std::vector<ifc_object *>();
+	for (auto item = v.items.begin(); item != v.items.end(); ++item) {
+		res->push_back(own(obj, item->untyped()));
+	}
+	return true;
+}
+
+bool object_field(
+	const ifc_object & obj, 
+	const char * field_name,
+	ifc_object ** res)
+{
+	value v;
+	if (!get_field(obj, field_name, &v)) { return false; }
+	*res = v.kind == value::UNSET ? nullptr : own(obj, v);
+	return true;
+}
+
+bool real_field(
+	const ifc_object & obj, 
+	const char * field_name, 
+	double * res) 
+{
+	value v;
+	if (!get_field(obj, field_name, &v) || !is_number(v)) { return false; }
+	*res = v.number;
+	return true;
+}
+
+bool string_field(
+	const ifc_object & obj, 
+	const char * field_name,
+	std::string * res)
+{
+	value v;
+	if (!get_field(obj, field_name, &v)) { return false; }
+	if (v.kind != value::STRING && v.kind != value::ENUMERATION) { return false; }
+	*res = v.text;
+	return true;
+}
+
+bool triple_field(
+	const ifc_object & obj,
+	const char * field_name,
+	double * a,
+	double * b,
+	double * c)
+{
+	value v;
+	if (!get_field(obj, field_name, &v) || v.kind != value::LIST || v.items.size() < 2) { return false; }
+	const value & x = v.items[0].untyped();
+	const value & y = v.items[1].untyped();
+	if (!is_number(x) || !is_number(y)) { return false; }
+	*a = x.number;
+	*b = y.number;
+	if (v.items.size() > 2) {
+		const value & z = v.items[2].untyped();
+		if (!is_number(z)) { return false; }
+		*c = z.number;
+	}
+	else { *c = 0.0; }
+	return true;
+}
+
+bool as_real(const ifc_object & obj, double * res) {
+	const value & v = obj.data().untyped();
+	if (!is_number(v)) { return false; }
+	*res = v.number;
+	return true;
+}
+
+bool instance_id(const ifc_object & obj, size_t * res) {
+	if (obj.data().kind != value::REFERENCE) { return false; }
+	*res = obj.data().ref;
+	return true;
+}
+	
+bool set_field(
+	ifc_object * obj,
+	const char * field_name,
+	const char * value)
+{
+	if (obj->data().kind != spf::value::REFERENCE) { return false; }
+	entity_id id = obj->data().ref;
+	const entity_type * t = obj->store()->type_of(id);
+	int ix = t ? t->attribute_index(field_name) : -1;
+	if (ix < 0) { return false; }
+	return obj->store()->set_field(
+		id,
+		field_name,
+		t->attributes()[ix]->is_enumeration ? spf::value::make_enumeration(value) : spf::value::make_string(value));
+}
+
+bool set_field(
+	ifc_object * obj,
+	const char * field_name,
+	const ifc_object & value)
+{
+	if (obj->data().kind != spf::value::REFERENCE) { return false; }
+	return obj->store()->set_field(obj->data().ref, field_name, value.data());
+}
+
+} // namespace ifc_interface
@@ -0,0 +1,465 @@
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#endif
+
+#include "instance_store.h"
+
+namespace spf {
+
+namespace {
+
+// Vector functions from the IFC2x3 schema, for derived attributes.
+typedef std::vector<double> vec;
+
+double dot(const vec & a, const vec & b) {
+	double res = 0.0;
+	for (size_t i = 0; i < a.size() && i < b.size(); ++i) { res += a[i] * b[i]; }
+	return res;
+}
+
+vec minus(const vec & a, const vec & b) {
+	vec res(a);
+	for (size_t i = 0; i < res.size() && i < b.size(); ++i) { res[i] -= b[i]; }
+	return res;
+}
+
+vec times(double s, const vec & a) {
+	vec res(a);
+	for (size_t i = 0; i < res.size(); ++i) { res[i] *= s; }
+	return res;
+}
+
+vec normalise(const vec & a) {
+	double len = sqrt(dot(a, a));
+	return len > 0.0 ? times(1.0 / len, a) : a;
+}
+
+vec cross(const vec & a, const vec & b) {
+	vec res(3);
+	res[0] = a[1] * b[2] - a[2] * b[1];
+	res[1] = a[2] * b[0] - a[0] * b[2];
+	res[2] = a[0] * b[1] - a[1] * b[0];
+	return res;
+}
+
+vec make_vec(double x, double y) {
+	vec res(2);
+	res[0] = x;
+	res[1] = y;
+	return res;
+}
+
+vec make_vec(double x, double y, double z) {
+	vec res(3);
+	res[0] = x;
+	res[1] = y;
+	res[2] = z;
+	return res;
+}
+
+vec orthogonal_complement(const vec & v) {
+	return make_vec(-v[1], v[0]);
+}
+
+// IfcFirstProjAxis
+vec first_proj_axis(const vec & z_axis, const vec * arg) {
+	vec z = normalise(z_axis);
+	vec v;
+	if (!arg) { v = z != make_vec(1, 0, 0) ? make_vec(1, 0, 0) : make_vec(0, 1, 0); }
+	else { v = normalise(*arg); }
+	return normalise(minus(v, times(dot(v, z), z)));
+}
+
+// IfcSecondProjAxis
+vec second_proj_axis(const vec & z_axis, const vec & x_axis, const vec * arg) {
+	vec v = arg ? *arg : make_vec(0, 1, 0);
+	vec y = minus(v, times(dot(v, x_axis), x_axis));
+	return normalise(minus(y, times(dot(v, z_axis), z_axis)));
+}
+
+std::string to_upper(const std::string & s) {
+	std::string res(s);
+	std::transform(res.begin(), res.end(), res.begin(), [](char c) { return (char)toupper((unsigned char)c); });
+	return res;
+}
+
+// Replaces to with from in one step, so to is never missing or partly
+// written.
+bool replace_file(const std::string & from, const std::string & to) {
+#ifdef _WIN32
+	return MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+	return std::rename(from.c_str(), to.c_str()) == 0;
+#endif
+}
+
+} // namespace
+
+void instance_store::open(const char * path) {
+	scoped_lock lock(mutex_);
+	f_.reset(new file(path));
+	next_id_ = f_->max_id() + 1;
+}
+
+const entity_type * instance_store::type_of(entity_id id) const {
+	scoped_lock lock(mutex_);
+	auto p = owned_.find(id);
+	if (p != owned_.end()) { return p->second->type; }
+	if (!f_) { return nullptr; }
+	unsigned short type = f_->type_index(id);
+	return type == schema::NO_TYPE ? nullptr : &schema::ifc2x3().type(type);
+}
+
+std::shared_ptr<const instance> instance_store::get(entity_id id) {
+	scoped_lock lock(mutex_);
+	if (removed_.find(id) != removed_.end()) { return nullptr; }
+	auto o = owned_.find(id);
+	if (o != owned_.end()) { return o->second; }
+	auto r = recent_.find(id);
+	if (r != recent_.end()) { return r->second; }
+	auto old = older_.find(id);
+	if (old != older_.end()) {
+		std::shared_ptr<const instance> res = old->second;
+		older_.erase(old);
+		cache_parsed(id, res);
+		return res;
+	}
+	if (!f_ || !f_->contains(id)) { return nullptr; }
+	std::shared_ptr<const instance> res = std::make_shared<instance>(f_->parse(id));
+	cache_parsed(id, res);
+	return res;
+}
+
+size_t instance_store::cached_count() const {
+	scoped_lock lock(mutex_);
+	return recent_.size() + older_.size();
+}
+
+void instance_store::cache_parsed(entity_id id, const std::shared_ptr<const instance> & inst) {
+	if (recent_.size() >= cache_size_ / 2) {
+		older_.swap(recent_);
+		recent_.clear();
+	}
+	recent_[id] = inst;
+}
+
+instance & instance_store::own(entity_id id, const instance & inst) {
+	auto o = owned_.find(id);
+	if (o != owned_.end()) { return *o->second; }
+	std::shared_ptr<instance> res = std::make_shared<instance>(inst);
+	recent_.erase(id);
+	older_.erase(id);
+	owned_[id] = res;
+	return *res;
+}
+
+bool instance_store::field(entity_id id, const std::string & name, value * res) {
+	scoped_lock lock(mutex_);
+	std::shared_ptr<const instance> inst = get(id);
+	if (!inst || !inst->type) { return false; }
+	int ix = inst->type->attribute_index(name);
+	if (ix >= 0 && (size_t)ix < inst->attributes.size() && inst->attributes[ix].kind != value::DERIVED) {
+		*res = inst->attributes[ix];
+		return true;
+	}
+	if (inst->type->is_derived(name)) {
+		auto key = std::make_pair(id, name);
+		auto cached = derived_.find(key);
+		if (cached != derived_.end()) {
+			*res = cached->second;
+			return true;
+		}
+		if (!derive(id, *inst, name, res)) { return false; }
+		derived_[key] = *res;
+		return true;
+	}
+	const inverse_definition * inv = inst->type->find_inverse(name);
+	if (inv) {
+		const inverse_index & index = inverses_for(*inv);
+		std::vector<entity_id> sources;
+		auto range = index.equal_range(id);
+		for (auto s = range.first; s != range.second; ++s) { sources.push_back(s->second); }
+		std::sort(sources.begin(), sources.end());
+		*res = value(value::LIST);
+		for (auto s = sources.begin(); s != sources.end(); ++s) {
+			res->items.push_back(value::make_reference(*s));
+		}
+		return true;
+	}
+	return false;
+}
+
+bool instance_store::set_field(entity_id id, const std::string & name, const value & v) {
+	scoped_lock lock(mutex_);
+	std::shared_ptr<const instance> existing = get(id);
+	if (!existing) { return false; }
+	int ix = existing->type ? existing->type->attribute_index(name) : -1;
+	if (ix < 0) { return false; }
+	instance & inst = own(id, *existing);
+	inst.attributes.resize(std::max(inst.attributes.size(), (size_t)ix + 1));
+	inst.attributes[ix] = v;
+	if (f_ && f_->contains(id)) { modified_.insert(id); }
+	inverses_.clear();
+	forget_derived();
+	return true;
+}
+
+void instance_store::forget_derived() {
+	derived_.clear();
+	for (auto id = made_up_.begin(); id != made_up_.end(); ++id) { owned_.erase(*id); }
+	made_up_.clear();
+}
+
+entity_id instance_store::create(const entity_type & t) {
+	scoped_lock lock(mutex_);
+	entity_id id = next_id_++;
+	std::shared_ptr<instance> inst = std::make_shared<instance>();
+	inst->type = &t;
+	inst->attributes.resize(t.attributes().size());
+	owned_[id] = inst;
+	created_.push_back(id);
+	inverses_.clear();
+	return id;
+}
+
+entity_id instance_store::clone(entity_id id) {
+	scoped_lock lock(mutex_);
+	std::shared_ptr<const instance> src = get(id);
+	if (!src || !src->type) { return 0; }
+	entity_id res = create(*src->type);
+	*owned_[res] = *src;
+	return res;
+}
+
+void instance_store::remove(entity_id id) {
+	scoped_lock lock(mutex_);
+	removed_.insert(id);
+	owned_.erase(id);
+	recent_.erase(id);
+	older_.erase(id);
+	inverses_.clear();
+}
+
+bool instance_store::read_direction(const value & v, double * d, size_t * dim) {
+	const value & ref = v.untyped();
+	if (ref.kind != value::REFERENCE) { return false; }
+	value ratios;
+	if (!field(ref.ref, "DirectionRatios", &ratios) || ratios.kind != value::LIST) { return false; }
+	*dim = std::min(ratios.items.size(), (size_t)3);
+	for (size_t i = 0; i < *dim; ++i) { d[i] = ratios.items[i].untyped().number; }
+	return true;
+}
+
+value instance_store::make_directions(const std::vector<vec> & directions) {
+	// These are never written out, so they aren't recorded as created.
+	const entity_type * direction_type = schema::ifc2x3().find("IfcDirection");
+	value res(value::LIST);
+	for (auto d = directions.begin(); d != directions.end(); ++d) {
+		entity_id id = next_derived_id_--;
+		std::shared_ptr<instance> inst = std::make_shared<instance>();
+		inst->type = direction_type;
+		value ratios(value::LIST);
+		for (auto c = d->begin(); c != d->end(); ++c) { ratios.items.push_back(value::make_real(*c)); }
+		inst->attributes.push_back(ratios);
+		owned_[id] = inst;
+		made_up_.push_back(id);
+		res.items.push_back(value::make_reference(id));
+	}
+	return res;
+}
+
+bool instance_store::derive(entity_id /*id*/, const instance & inst, const std::string & name, value * res) {
+	const schema & s = schema::ifc2x3();
+	auto attr = [&inst](const char * attr_name) -> const value * {
+		int ix = inst.type->attribute_index(attr_name);
+		return ix >= 0 && (size_t)ix < inst.attributes.size() && inst.attributes[ix].kind != value::UNSET ? &inst.attributes[ix] : nullptr;
+	};
+	auto direction = [this, &attr](const char * attr_name, vec * out) -> bool {
+		const value * v = attr(attr_name);
+		double d[3];
+		size_t dim;
+		if (!v || !read_direction(*v, d, &dim)) { return false; }
+		*out = vec(d, d + dim);
+		return true;
+	};
+	vec a, b, c;
+
+	if (name == "P" && inst.type->is_kind_of(*s.find("IfcAxis2Placement3D"))) {
+		// IfcBuildAxes
+		vec d1 = direction("Axis", &a) ? normalise(a) : make_vec(0, 0, 1);
+		vec d2 = first_proj_axis(d1, direction("RefDirection", &b) ? &b : nullptr);
+		std::vector<vec> axes;
+		axes.push_back(d2);
+		axes.push_back(normalise(cross(d1, d2)));
+		axes.push_back(d1);
+		*res = make_directions(axes);
+		return true;
+	}
+	if (name == "P" && inst.type->is_kind_of(*s.find("IfcAxis2Placement2D"))) {
+		// IfcBuild2Axes
+		vec d = direction("RefDirection", &a) ? normalise(a) : make_vec(1, 0);
+		std::vector<vec> axes;
+		axes.push_back(d);
+		axes.push_back(orthogonal_complement(d));
+		*res = make_directions(axes);
+		return true;
+	}
+	if (name == "Scl" && inst.type->is_kind_of(*s.find("IfcCartesianTransformationOperator"))) {
+		const value * scale = attr("Scale");
+		*res = value::make_real(scale ? scale->untyped().number : 1.0);
+		return true;
+	}
+	if (name == "U" && inst.type->is_kind_of(*s.find("IfcCartesianTransformationOperator3D"))) {
+		// IfcBaseAxis(3, ...)
+		bool has_axis1 = direction("Axis1", &a);
+		bool has_axis2 = direction("Axis2", &b);
+		vec d1 = direction("Axis3", &c) ? normalise(c) : make_vec(0, 0, 1);
+		vec d2 = first_proj_axis(d1, has_axis1 ? &a : nullptr);
+		std::vector<vec> axes;
+		axes.push_back(d2);
+		axes.push_back(second_proj_axis(d1, d2, has_axis2 ? &b : nullptr));
+		axes.push_back(d1);
+		*res = make_directions(axes);
+		return true;
+	}
+	if (name == "U" && inst.type->is_kind_of(*s.find("IfcCartesianTransformationOperator2D"))) {
+		// IfcBaseAxis(2, ...)
+		bool has_axis1 = direction("Axis1", &a);
+		bool has_axis2 = direction("Axis2", &b);
+		std::vector<vec> axes(2);
+		if (has_axis1) {
+			axes[0] = normalise(a);
+			axes[1] = orthogonal_complement(axes[0]);
+			if (has_axis2 && dot(b, axes[1]) < 0.0) { axes[1] = times(-1.0, axes[1]); }
+		}
+		else if (has_axis2) {
+			axes[1] = normalise(b);
+			axes[0] = times(-1.0, orthogonal_complement(axes[1]));
+		}
+		else {
+			axes[0] = make_vec(1, 0);
+			axes[1] = make_vec(0, 1);
+		}
+		*res = make_directions(axes);
+		return true;
+	}
+	return false;
+}
+
+const instance_store::inverse_index & instance_store::inverses_for(const inverse_definition & def) {
+	auto existing = inverses_.find(&def);
+	if (existing != inverses_.end()) { return existing->second; }
+
+	const entity_type * relating = schema::ifc2x3().find(def.entity);
+	int ix = relating ? relating->attribute_index(def.attribute) : -1;
+	if (ix < 0) { return inverses_[&def]; }
+
+	// Relationships are indexed with the file, so that index can be used
+	// as-is until something changes.
+	const inverse_index * indexed = f_ ? f_->relationship_references(relating->index(), ix) : nullptr;
+	bool unchanged = modified_.empty() && created_.empty() && removed_.empty();
+	if (indexed && unchanged) { return *indexed; }
+
+	inverse_index & res = inverses_[&def];
+	auto add = [ix, &res](entity_id source, const instance & inst) {
+		if ((size_t)ix >= inst.attributes.size()) { return; }
+		const value & v = inst.attributes[ix];
+		if (v.kind == value::REFERENCE) { res.insert(std::make_pair(v.ref, source)); }
+		else if (v.kind == value::LIST) {
+			for (auto item = v.items.begin(); item != v.items.end(); ++item) {
+				if (item->kind == value::REFERENCE) { res.insert(std::make_pair(item->ref, source)); }
+			}
+		}
+	};
+	if (indexed) {
+		// Start from the file's index and apply the changes.
+		for (auto r = indexed->begin(); r != indexed->end(); ++r) {
+			if (modified_.find(r->second) == modified_.end() && removed_.find(r->second) == removed_.end()) {
+				res.insert(*r);
+			}
+		}
+		std::vector<entity_id> changed(modified_.begin(), modified_.end());
+		changed.insert(changed.end(), created_.begin(), created_.end());
+		for (auto id = changed.begin(); id != changed.end(); ++id) {
+			std::shared_ptr<const instance> inst = get(*id);
+			if (inst && inst->type && inst->type->is_kind_of(*relating)) { add(*id, *inst); }
+		}
+		return res;
+	}
+	for_each_of_kind(*relating, [this, &add](entity_id source) {
+		// Relationships are mostly only needed for this, so they aren't
+		// cached.
+		auto p = owned_.find(source);
+		if (p != owned_.end()) { add(source, *p->second); }
+		else { add(source, f_->parse(source)); }
+	});
+	return res;
+}
+
+void instance_store::write_instance(entity_id id, const instance & inst, std::string * out) const {
+	char buf[32];
+	sprintf(buf, "#%u=", (unsigned)id);
+	out->append(buf);
+	value params(value::LIST);
+	params.items = inst.attributes;
+	out->append(to_upper(inst.type->name()));
+	params.write(out);
+	out->push_back(';');
+}
+
+void instance_store::write(const std::string & path) const {
+	scoped_lock lock(mutex_);
+	if (!f_) { throw std::runtime_error("couldn't write " + path + " (no file is open)"); }
+	// The records are streamed straight from the mapped input, so the output
+	// can't be opened (and truncated) in place if it's the same file.
+	std::string temp_path = path + ".tmp";
+	std::ofstream out(temp_path.c_str(), std::ios::binary);
+	if (!out) { throw std::runtime_error("couldn't create " + temp_path); }
+	// Whatever is between the records (line breaks, comments) is kept too, so
+	// an unchanged file is written back byte for byte.
+	const char * copied = f_->begin();
+	std::string buf;
+	f_->for_each_record([this, &out, &buf, &copied](entity_id id, const char * begin, const char * end) {
+		out.write(copied, begin - copied);
+		copied = end;
+		if (removed_.find(id) != removed_.end()) {
+			// Take the line break with it.
+			if (copied < f_->data_end() && *copied == '\r') { ++copied; }
+			if (copied < f_->data_end() && *copied == '\n') { ++copied; }
+		}
+		else if (modified_.find(id) != modified_.end()) {
+			buf.clear();
+			write_instance(id, *owned_.find(id)->second, &buf);
+			out.write(buf.data(), buf.size());
+		}
+		else { out.write(begin, end - begin); }
+	});
+	out.write(copied, f_->data_end() - copied);
+	for (auto id = created_.begin(); id != created_.end(); ++id) {
+		if (removed_.find(*id) != removed_.end()) { continue; }
+		buf.clear();
+		write_instance(*id, *owned_.find(*id)->second, &buf);
+		buf.push_back('\n');
+		out.write(buf.data(), buf.size());
+	}
+	out.write(f_->data_end(), f_->end() - f_->data_end());
+	out.close();
+	if (!out) {
+		std::remove(temp_path.c_str());
+		throw std::runtime_error("couldn't write " + temp_path);
+	}
+	if (!replace_file(temp_path, path)) {
+		// Keep the finished output; it may be the only copy left.
+		throw std::runtime_error(
+			"couldn't replace " + path + " (is it the open input file?); the output is in " + temp_path);
+	}
+}
+
+} // namespace spf
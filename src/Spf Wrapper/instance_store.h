@@ -0,0 +1,134 @@
+#pragma once
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "parallel.h"
+#include "schema.h"
+#include "spf_file.h"
+#include "spf_value.h"
+
+namespace spf {
+
+// Everything a model holds on top of its file: the instances that have been
+// parsed recently, the ones that have been created, changed, or removed since
+// it was opened, and the lookups for derived and inverse attributes. Every
+// member function holds the store's mutex, so a store can be read from
+// several threads at once.
+class instance_store {
+public:
+	// Roughly how many parsed instances are kept around. Instances that
+	// haven't been used in a while are dropped and parsed again when they're
+	// next needed; the ones this store has made or changed are always kept.
+	static const size_t DEFAULT_CACHE_SIZE = 1 << 16;
+
+	explicit instance_store(size_t cache_size = DEFAULT_CACHE_SIZE)
+		: cache_size_(std::max(cache_size, (size_t)2)), next_id_(1), next_derived_id_((entity_id)-1) { }
+
+	// Throws parse_error or boost::interprocess::interprocess_exception.
+	void open(const char * path);
+	bool is_open() const { return f_.get() != nullptr; }
+
+	// Null for complex instances, unknown types, and instances that don't
+	// exist.
+	const entity_type * type_of(entity_id id) const;
+
+	// The instance, parsed if it isn't cached. Null if it doesn't exist or has
+	// been removed.
+	std::shared_ptr<const instance> get(entity_id id);
+
+	// How many instances parsed from the file are currently cached.
+	size_t cached_count() const;
+
+	// Looks up an explicit, derived, or inverse attribute. Inverse attributes
+	// come back as lists of references. Returns false if the instance has no
+	// such attribute or its value can't be derived.
+	bool field(entity_id id, const std::string & name, value * res);
+
+	// Returns false if the instance has no such explicit attribute.
+	bool set_field(entity_id id, const std::string & name, const value & v);
+
+	// New instances get new IDs after the file's. They (and the changes to
+	// existing ones) are only written out by write().
+	entity_id create(const entity_type & t);
+	entity_id clone(entity_id id);
+	void remove(entity_id id);
+
+	// Calls f(id) for every live instance of the type or any of its subtypes.
+	template <typename F>
+	void for_each_of_kind(const entity_type & t, F f) const;
+
+	// Writes the file back out with the changes applied. Unchanged instances,
+	// and everything between instances, are copied verbatim. The output goes
+	// to path + ".tmp" first and replaces path when it's complete. Throws
+	// std::runtime_error if it can't be written; if only the replacing
+	// failed, the output is left in path + ".tmp".
+	void write(const std::string & path) const;
+
+	// Lock this to make several calls atomic.
+	recursive_mutex & mutex() const { return mutex_; }
+
+private:
+	typedef file::reference_index inverse_index;
+	typedef std::unordered_map<entity_id, std::shared_ptr<const instance>> cache;
+
+	mutable recursive_mutex mutex_;
+	std::unique_ptr<file> f_;
+	// Parsed instances live in recent_ until it's half of cache_size_, when
+	// it replaces older_ (and what was in older_ is dropped). Anything found
+	// in older_ moves back to recent_.
+	size_t cache_size_;
+	cache recent_;
+	cache older_;
+	// Created and modified instances, and the ones made up for derived
+	// attributes.
+	std::unordered_map<entity_id, std::shared_ptr<instance>> owned_;
+	std::unordered_set<entity_id> modified_;
+	std::unordered_set<entity_id> removed_;
+	std::vector<entity_id> created_;
+	entity_id next_id_;
+	// Instances made up for derived attributes count down from the top, so
+	// that they don't take IDs from the ones that will be written out.
+	// They're dropped (from owned_ too) along with the derived values that
+	// refer to them whenever an attribute is set.
+	entity_id next_derived_id_;
+	std::map<std::pair<entity_id, std::string>, value> derived_;
+	std::vector<entity_id> made_up_;
+	std::map<const inverse_definition *, inverse_index> inverses_;
+
+	instance & own(entity_id id, const instance & inst);
+	void cache_parsed(entity_id id, const std::shared_ptr<const instance> & inst);
+	bool derive(entity_id id, const instance & inst, const std::string & name, value * res);
+	void forget_derived();
+	const inverse_index & inverses_for(const inverse_definition & def);
+	bool read_direction(const value & v, double * d, size_t * dim);
+	value make_directions(const std::vector<std::vector<double>> & directions);
+	void write_instance(entity_id id, const instance & inst, std::string * out) const;
+
+	instance_store(const instance_store & disabled);
+	instance_store & operator = (const instance_store & disabled);
+};
+
+template <typename F>
+void instance_store::for_each_of_kind(const entity_type & t, F f) const {
+	scoped_lock lock(mutex_);
+	const schema & s = schema::ifc2x3();
+	if (f_) {
+		f_->for_each_id([this, &s, &t, &f](entity_id id) {
+			unsigned short type = f_->type_index(id);
+			if (type != schema::NO_TYPE && s.type(type).is_kind_of(t) && removed_.find(id) == removed_.end()) {
+				f(id);
+			}
+		});
+	}
+	for (auto id = created_.begin(); id != created_.end(); ++id) {
+		if (removed_.find(*id) == removed_.end() && type_of(*id)->is_kind_of(t)) { f(*id); }
+	}
+}
+
+} // namespace spf
@@ -0,0 +1,124 @@
+#include <exception>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <process.h>
+#else
+#include <mutex>
+#include <thread>
+#include <pthread.h>
+#endif
+
+#include "parallel.h"
+
+namespace spf {
+
+namespace {
+
+struct task {
+	const std::function<void (size_t)> * f;
+	size_t index;
+	std::exception_ptr error;
+
+	void run() {
+		try { (*f)(index); }
+		catch (...) { error = std::current_exception(); }
+	}
+};
+
+#ifdef _WIN32
+unsigned __stdcall thread_main(void * t) {
+	static_cast<task *>(t)->run();
+	return 0;
+}
+#endif
+
+} // namespace
+
+size_t hardware_threads() {
+#ifdef _WIN32
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	return info.dwNumberOfProcessors > 0 ? info.dwNumberOfProcessors : 1;
+#else
+	unsigned n = std::thread::hardware_concurrency();
+	return n > 0 ? n : 1;
+#endif
+}
+
+void run_in_parallel(size_t count, const std::function<void (size_t)> & f) {
+	std::vector<task> tasks(count);
+	for (size_t i = 0; i < count; ++i) {
+		tasks[i].f = &f;
+		tasks[i].index = i;
+	}
+#ifdef _WIN32
+	std::vector<HANDLE> threads;
+	for (size_t i = 1; i < count; ++i) {
+		HANDLE h = (HANDLE)_beginthreadex(nullptr, 0, &thread_main, &tasks[i], 0, nullptr);
+		if (h) { threads.push_back(h); }
+		else { tasks[i].run(); }
+	}
+	if (count > 0) { tasks[0].run(); }
+	for (auto h = threads.begin(); h != threads.end(); ++h) {
+		WaitForSingleObject(*h, INFINITE);
+		CloseHandle(*h);
+	}
+#else
+	std::vector<std::thread> threads;
+	for (size_t i = 1; i < count; ++i) {
+		threads.push_back(std::thread(&task::run, &tasks[i]));
+	}
+	if (count > 0) { tasks[0].run(); }
+	for (auto t = threads.begin(); t != threads.end(); ++t) { t->join(); }
+#endif
+	for (auto t = tasks.begin(); t != tasks.end(); ++t) {
+		if (t->error) { std::rethrow_exception(t->error); }
+	}
+}
+
+#ifdef _WIN32
+recursive_mutex::recursive_mutex() : impl_(new CRITICAL_SECTION) {
+	InitializeCriticalSection(static_cast<CRITICAL_SECTION *>(impl_));
+}
+
+recursive_mutex::~recursive_mutex() {
+	DeleteCriticalSection(static_cast<CRITICAL_SECTION *>(impl_));
+	delete static_cast<CRITICAL_SECTION *>(impl_);
+}
+
+void recursive_mutex::lock() { EnterCriticalSection(static_cast<CRITICAL_SECTION *>(impl_)); }
+void recursive_mutex::unlock() { LeaveCriticalSection(static_cast<CRITICAL_SECTION *>(impl_)); }
+#else
+recursive_mutex::recursive_mutex() : impl_(new std::recursive_mutex) { }
+recursive_mutex::~recursive_mutex() { delete static_cast<std::recursive_mutex *>(impl_); }
+void recursive_mutex::lock() { static_cast<std::recursive_mutex *>(impl_)->lock(); }
+void recursive_mutex::unlock() { static_cast<std::recursive_mutex *>(impl_)->unlock(); }
+#endif
+
+#ifdef _WIN32
+thread_local_pointer::thread_local_pointer() : impl_(new DWORD(TlsAlloc())) { }
+
+thread_local_pointer::~thread_local_pointer() {
+	TlsFree(*static_cast<DWORD *>(impl_));
+	delete static_cast<DWORD *>(impl_);
+}
+
+void * thread_local_pointer::get() const { return TlsGetValue(*static_cast<DWORD *>(impl_)); }
+void thread_local_pointer::set(void * p) { TlsSetValue(*static_cast<DWORD *>(impl_), p); }
+#else
+thread_local_pointer::thread_local_pointer() : impl_(new pthread_key_t) {
+	pthread_key_create(static_cast<pthread_key_t *>(impl_), nullptr);
+}
+
+thread_local_pointer::~thread_local_pointer() {
+	pthread_key_delete(*static_cast<pthread_key_t *>(impl_));
+	delete static_cast<pthread_key_t *>(impl_);
+}
+
+void * thread_local_pointer::get() const { return pthread_getspecific(*static_cast<pthread_key_t *>(impl_)); }
+void thread_local_pointer::set(void * p) { pthread_setspecific(*static_cast<pthread_key_t *>(impl_), p); }
+#endif
+
+} // namespace spf
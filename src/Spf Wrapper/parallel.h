@@ -0,0 +1,60 @@
+#pragma once
+
+#include <functional>
+
+namespace spf {
+
+// The number of threads worth running at once (at least one).
+size_t hardware_threads();
+
+// Calls f(0) through f(count - 1), each on its own thread (f(0) on the
+// calling one), and waits for all of them. If any of them throw, the first
+// one's exception is rethrown once they've all finished.
+void run_in_parallel(size_t count, const std::function<void (size_t)> & f);
+
+// A mutex that the thread holding it can lock again.
+class recursive_mutex {
+public:
+	recursive_mutex();
+	~recursive_mutex();
+
+	void lock();
+	void unlock();
+
+private:
+	void * impl_;
+
+	recursive_mutex(const recursive_mutex & disabled);
+	recursive_mutex & operator = (const recursive_mutex & disabled);
+};
+
+// A pointer with a value of its own on each thread (null until that thread
+// sets it).
+class thread_local_pointer {
+public:
+	thread_local_pointer();
+	~thread_local_pointer();
+
+	void * get() const;
+	void set(void * p);
+
+private:
+	void * impl_;
+
+	thread_local_pointer(const thread_local_pointer & disabled);
+	thread_local_pointer & operator = (const thread_local_pointer & disabled);
+};
+
+class scoped_lock {
+public:
+	explicit scoped_lock(recursive_mutex & m) : m_(m) { m_.lock(); }
+	~scoped_lock() { m_.unlock(); }
+
+private:
+	recursive_mutex & m_;
+
+	scoped_lock(const scoped_lock & disabled);
+	scoped_lock & operator = (const scoped_lock & disabled);
+};
+
+} // namespace spf
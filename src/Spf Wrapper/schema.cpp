@@ -0,0 +1,88 @@
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
+#include "schema.h"
+
+namespace spf {
+
+namespace {
+
+std::string to_upper(const std::string & s) {
+	std::string res(s);
+	std::transform(res.begin(), res.end(), res.begin(), [](char c) { return (char)toupper((unsigned char)c); });
+	return res;
+}
+
+} // namespace
+
+const unsigned short schema::NO_TYPE;
+
+bool entity_type::is_kind_of(const entity_type & other) const {
+	for (const entity_type * t = this; t; t = t->supertype_) {
+		if (t == &other) { return true; }
+	}
+	return false;
+}
+
+int entity_type::attribute_index(const std::string & name) const {
+	for (size_t i = 0; i < attributes_.size(); ++i) {
+		if (name == attributes_[i]->name) { return (int)i; }
+	}
+	return -1;
+}
+
+const inverse_definition * entity_type::find_inverse(const std::string & name) const {
+	for (const entity_type * t = this; t; t = t->supertype_) {
+		for (size_t i = 0; i < t->def_->inverse_count; ++i) {
+			if (name == t->def_->inverses[i].name) { return &t->def_->inverses[i]; }
+		}
+	}
+	return nullptr;
+}
+
+bool entity_type::is_derived(const std::string & name) const {
+	for (const entity_type * t = this; t; t = t->supertype_) {
+		for (size_t i = 0; i < t->def_->derived_count; ++i) {
+			if (name == t->def_->derived[i]) { return true; }
+		}
+	}
+	return false;
+}
+
+schema::schema(const entity_definition * defs, size_t count) : types_(count) {
+	for (size_t i = 0; i < count; ++i) {
+		types_[i].name_ = defs[i].name;
+		types_[i].index_ = (unsigned short)i;
+		types_[i].def_ = &defs[i];
+		by_upper_name_[to_upper(defs[i].name)] = (unsigned short)i;
+	}
+	for (size_t i = 0; i < count; ++i) {
+		types_[i].supertype_ = defs[i].supertype ? find(defs[i].supertype) : nullptr;
+	}
+	for (size_t i = 0; i < count; ++i) {
+		std::vector<const entity_type *> chain;
+		for (const entity_type * t = &types_[i]; t; t = t->supertype_) { chain.push_back(t); }
+		for (auto t = chain.rbegin(); t != chain.rend(); ++t) {
+			for (size_t j = 0; j < (*t)->def_->attribute_count; ++j) {
+				types_[i].attributes_.push_back(&(*t)->def_->attributes[j]);
+			}
+		}
+	}
+}
+
+const schema & schema::ifc2x3() {
+	static schema s(ifc2x3_entity_definitions(), ifc2x3_entity_definition_count());
+	return s;
+}
+
+const entity_type * schema::find(const std::string & name) const {
+	return find_upper(to_upper(name));
+}
+
+const entity_type * schema::find_upper(const std::string & upper_name) const {
+	auto t = by_upper_name_.find(upper_name);
+	return t == by_upper_name_.end() ? nullptr : &types_[t->second];
+}
+
+} // namespace spf
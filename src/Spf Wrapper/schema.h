@@ -0,0 +1,82 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace spf {
+
+// The raw schema tables (see generate_schema.py). Names are as they appear in
+// the schema; only an entity's own attributes are listed.
+struct attribute_definition {
+	const char * name;
+	bool is_enumeration;
+};
+
+struct inverse_definition {
+	const char * name;
+	const char * entity;
+	const char * attribute;
+};
+
+struct entity_definition {
+	const char * name;
+	const char * supertype;
+	const attribute_definition * attributes;
+	size_t attribute_count;
+	const inverse_definition * inverses;
+	size_t inverse_count;
+	const char * const * derived;
+	size_t derived_count;
+};
+
+const entity_definition * ifc2x3_entity_definitions();
+size_t ifc2x3_entity_definition_count();
+
+class entity_type {
+public:
+	const std::string & name() const { return name_; }
+	unsigned short index() const { return index_; }
+	const entity_type * supertype() const { return supertype_; }
+
+	bool is_kind_of(const entity_type & other) const;
+
+	// Attribute lookups include inherited attributes. An instance's
+	// attribute list is in the same order as attributes().
+	const std::vector<const attribute_definition *> & attributes() const { return attributes_; }
+	int attribute_index(const std::string & name) const;
+	const inverse_definition * find_inverse(const std::string & name) const;
+	bool is_derived(const std::string & name) const;
+
+private:
+	friend class schema;
+
+	std::string name_;
+	unsigned short index_;
+	const entity_type * supertype_;
+	const entity_definition * def_;
+	std::vector<const attribute_definition *> attributes_;
+};
+
+class schema {
+public:
+	static const schema & ifc2x3();
+
+	static const unsigned short NO_TYPE = 0xFFFF;
+
+	// Case-insensitive, because SPF files use upper case names.
+	const entity_type * find(const std::string & name) const;
+	const entity_type * find_upper(const std::string & upper_name) const;
+	const entity_type & type(unsigned short index) const { return types_[index]; }
+
+private:
+	std::vector<entity_type> types_;
+	std::unordered_map<std::string, unsigned short> by_upper_name_;
+
+	schema(const entity_definition * defs, size_t count);
+
+	schema(const schema & disabled);
+	schema & operator = (const schema & disabled);
+};
+
+} // namespace spf
@@ -0,0 +1,643 @@
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "parallel.h"
+#include "spf_file.h"
+
+namespace spf {
+
+namespace {
+
+bool is_name_char(char c) {
+	return isalnum((unsigned char)c) || c == '_' || c == '-';
+}
+
+parse_error error_at(const char * what, entity_id id) {
+	char buf[64];
+	sprintf(buf, " (instance #%u)", (unsigned)id);
+	return parse_error(std::string(what) + buf);
+}
+
+// Skips a string or binary literal that starts at p.
+const char * skip_literal(const char * p, const char * end) {
+	char quote = *p++;
+	while (p < end) {
+		if (*p++ == quote) {
+			if (quote == '\'' && p < end && *p == '\'') { ++p; }
+			else { return p; }
+		}
+	}
+	return end;
+}
+
+void append_utf8(unsigned long cp, std::string * out) {
+	if (cp < 0x80) { out->push_back((char)cp); }
+	else if (cp < 0x800) {
+		out->push_back((char)(0xC0 | (cp >> 6)));
+		out->push_back((char)(0x80 | (cp & 0x3F)));
+	}
+	else if (cp < 0x10000) {
+		out->push_back((char)(0xE0 | (cp >> 12)));
+		out->push_back((char)(0x80 | ((cp >> 6) & 0x3F)));
+		out->push_back((char)(0x80 | (cp & 0x3F)));
+	}
+	else {
+		out->push_back((char)(0xF0 | (cp >> 18)));
+		out->push_back((char)(0x80 | ((cp >> 12) & 0x3F)));
+		out->push_back((char)(0x80 | ((cp >> 6) & 0x3F)));
+		out->push_back((char)(0x80 | (cp & 0x3F)));
+	}
+}
+
+// Reads the UTF-8 sequence at *p (advancing it). Malformed bytes are taken
+// as Latin-1.
+unsigned long read_utf8(const char ** p, const char * end) {
+	unsigned char c = (unsigned char)*(*p)++;
+	size_t len = c >= 0xF0 ? 3 : c >= 0xE0 ? 2 : c >= 0xC0 ? 1 : 0;
+	if (len == 0 || (size_t)(end - *p) < len) { return c; }
+	unsigned long cp = c & (0x3F >> len);
+	for (size_t i = 0; i < len; ++i) {
+		unsigned char cont = (unsigned char)(*p)[i];
+		if ((cont & 0xC0) != 0x80) { return c; }
+		cp = (cp << 6) | (cont & 0x3F);
+	}
+	*p += len;
+	return cp;
+}
+
+// Reads count hex digits at *p (advancing it). Returns false if they aren't
+// all there.
+bool read_hex(const char ** p, const char * end, size_t count, unsigned long * res) {
+	if ((size_t)(end - *p) < count) { return false; }
+	*res = 0;
+	for (size_t i = 0; i < count; ++i) {
+		char c = (*p)[i];
+		if (!isxdigit((unsigned char)c)) { return false; }
+		*res = *res * 16 + (isdigit((unsigned char)c) ? c - '0' : toupper((unsigned char)c) - 'A' + 10);
+	}
+	*p += count;
+	return true;
+}
+
+bool starts_with(const char * p, const char * end, const char * s) {
+	size_t len = strlen(s);
+	return (size_t)(end - p) >= len && strncmp(p, s, len) == 0;
+}
+
+const char * read_name(const char * p, const char * end, std::string * res) {
+	const char * start = p;
+	while (p < end && is_name_char(*p)) { ++p; }
+	res->assign(start, p);
+	return p;
+}
+
+class parameter_parser {
+public:
+	parameter_parser(const char * p, const char * end, entity_id id) : p(p), end(end), id(id) { }
+
+	std::vector<value> parse_list() {
+		std::vector<value> res;
+		expect('(');
+		if (peek() == ')') { ++p; return res; }
+		while (true) {
+			res.push_back(parse_value());
+			char c = peek();
+			++p;
+			if (c == ')') { return res; }
+			if (c != ',') { throw error_at("expected ',' or ')'", id); }
+		}
+	}
+
+	value parse_value() {
+		char c = peek();
+		if (c == '$') { ++p; return value(value::UNSET); }
+		if (c == '*') { ++p; return value(value::DERIVED); }
+		if (c == '#') {
+			++p;
+			return value::make_reference(read_id(&p, end));
+		}
+		if (c == '\'') { return parse_string(); }
+		if (c == '"') {
+			const char * start = p;
+			p = skip_literal(p, end);
+			value res(value::BINARY);
+			res.text.assign(start + 1, p - 1);
+			return res;
+		}
+		if (c == '.') {
+			const char * start = ++p;
+			while (p < end && *p != '.') { ++p; }
+			value res(value::ENUMERATION);
+			res.text.assign(start, p);
+			++p;
+			return res;
+		}
+		if (c == '(') {
+			value res(value::LIST);
+			res.items = parse_list();
+			return res;
+		}
+		if (isdigit((unsigned char)c) || c == '-' || c == '+' || c == '.') { return parse_number(); }
+		if (isalpha((unsigned char)c)) {
+			value res(value::TYPED);
+			p = read_name(p, end, &res.text);
+			res.items = parse_list();
+			return res;
+		}
+		throw error_at("unexpected character in parameter", id);
+	}
+
+	char peek() {
+		p = skip_whitespace(p, end);
+		if (p == end) { throw error_at("unexpected end of file", id); }
+		return *p;
+	}
+
+	void expect(char c) {
+		if (peek() != c) { throw error_at("malformed instance", id); }
+		++p;
+	}
+
+	const char * position() const { return p; }
+
+private:
+	const char * p;
+	const char * end;
+	entity_id id;
+
+	// Strings come back as UTF-8. Page switches (\P?\) are ignored, so
+	// \S\ always means Latin-1.
+	value parse_string() {
+		value res(value::STRING);
+		++p;
+		while (p < end) {
+			char c = *p++;
+			if (c == '\'') {
+				if (p < end && *p == '\'') { ++p; }
+				else { return res; }
+			}
+			else if (c == '\\') {
+				if (p < end && *p == '\\') { ++p; }
+				else if (parse_escape(&res.text)) { continue; }
+			}
+			res.text.push_back(c);
+		}
+		throw error_at("unterminated string", id);
+	}
+
+	// Called just past a backslash. Leaves p alone and returns false if it
+	// isn't an escape.
+	bool parse_escape(std::string * out) {
+		const char * q = p;
+		unsigned long cp;
+		if (starts_with(q, end, "X2\\") || starts_with(q, end, "X4\\")) {
+			size_t digits = q[1] == '2' ? 4 : 8;
+			q += 3;
+			std::string decoded;
+			while (!starts_with(q, end, "\\X0\\")) {
+				if (!read_hex(&q, end, digits, &cp)) { return false; }
+				if (digits == 4 && cp >= 0xD800 && cp < 0xDC00) {
+					// A UTF-16 surrogate pair
+					unsigned long low;
+					if (!read_hex(&q, end, 4, &low)) { return false; }
+					cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+				}
+				append_utf8(cp, &decoded);
+			}
+			out->append(decoded);
+			p = q + 4;
+			return true;
+		}
+		if (starts_with(q, end, "X\\")) {
+			q += 2;
+			if (!read_hex(&q, end, 2, &cp)) { return false; }
+			append_utf8(cp, out);
+			p = q;
+			return true;
+		}
+		if (starts_with(q, end, "S\\") && end - q > 2) {
+			append_utf8((unsigned char)q[2] + 0x80, out);
+			p = q + 3;
+			return true;
+		}
+		if (end - q >= 3 && q[0] == 'P' && isupper((unsigned char)q[1]) && q[2] == '\\') {
+			p = q + 3;
+			return true;
+		}
+		return false;
+	}
+
+	value parse_number() {
+		char buf[64];
+		size_t len = 0;
+		bool is_real = false;
+		while (p < end && len < sizeof(buf) - 1 && (isdigit((unsigned char)*p) || strchr("+-.Ee", *p))) {
+			is_real = is_real || *p == '.' || *p == 'E' || *p == 'e';
+			buf[len++] = *p++;
+		}
+		buf[len] = '\0';
+		value res(is_real ? value::REAL : value::INTEGER);
+		res.number = strtod(buf, nullptr);
+		return res;
+	}
+};
+
+// Data sections smaller than this (per thread) aren't worth splitting up.
+const size_t MIN_CHUNK_BYTES = 4 * 1024 * 1024;
+
+// Tables indexed by ID are used unless they'd have more than this many
+// entries per instance.
+const size_t MAX_DENSE_ENTRIES_PER_INSTANCE = 4;
+
+// The relationship attributes that inverse attributes are based on, which
+// are indexed while the file is.
+class relationship_attributes {
+public:
+	explicit relationship_attributes(const schema & s) : by_type_(ifc2x3_entity_definition_count()) {
+		const entity_type * relationship = s.find("IfcRelationship");
+		const entity_definition * defs = ifc2x3_entity_definitions();
+		for (size_t i = 0; i < ifc2x3_entity_definition_count(); ++i) {
+			for (size_t j = 0; j < defs[i].inverse_count; ++j) {
+				const entity_type * source = s.find(defs[i].inverses[j].entity);
+				if (!source || !relationship || !source->is_kind_of(*relationship)) { continue; }
+				int ix = source->attribute_index(defs[i].inverses[j].attribute);
+				auto k = std::make_pair(source->index(), ix);
+				if (ix < 0 || std::find(keys_.begin(), keys_.end(), k) != keys_.end()) { continue; }
+				keys_.push_back(k);
+				for (size_t t = 0; t < by_type_.size(); ++t) {
+					if (s.type((unsigned short)t).is_kind_of(*source)) {
+						by_type_[t].push_back(std::make_pair(keys_.size() - 1, ix));
+					}
+				}
+			}
+		}
+	}
+
+	// (type index, attribute index) pairs.
+	const std::vector<std::pair<unsigned short, int>> & keys() const { return keys_; }
+
+	// (key, attribute index) pairs for the instances of a type.
+	const std::vector<std::pair<size_t, int>> & for_type(unsigned short type) const { return by_type_[type]; }
+
+private:
+	std::vector<std::pair<unsigned short, int>> keys_;
+	std::vector<std::vector<std::pair<size_t, int>>> by_type_;
+};
+
+struct index_entry {
+	entity_id id;
+	size_t offset;
+	unsigned short type;
+};
+
+struct reference_entry {
+	size_t key;
+	entity_id target;
+	entity_id source;
+};
+
+struct chunk_index {
+	chunk_index() : stop(nullptr), data_end(nullptr) { }
+
+	std::vector<index_entry> entries;
+	std::vector<reference_entry> references;
+	const char * stop; // the first record at or after the chunk's limit
+	const char * data_end; // set if the chunk ran into ENDSEC
+};
+
+// Indexes the records from p (which must be at the start of one) until the
+// first one that starts at or after limit, or the end of the data section.
+void index_chunk(
+	const char * begin,
+	const char * p,
+	const char * limit,
+	const char * end,
+	const relationship_attributes & rels,
+	chunk_index * res)
+{
+	const schema & s = schema::ifc2x3();
+	std::string name;
+	while (true) {
+		p = skip_whitespace(p, end);
+		if (p == end) { throw parse_error("unterminated DATA section"); }
+		if (*p != '#') {
+			read_name(p, end, &name);
+			if (name != "ENDSEC") { throw parse_error("expected an instance or ENDSEC"); }
+			res->data_end = p;
+			return;
+		}
+		if (p >= limit) {
+			res->stop = p;
+			return;
+		}
+		const char * record = p++;
+		entity_id id = read_id(&p, end);
+		p = skip_whitespace(p, end);
+		if (id == 0 || p == end || *p != '=') { throw error_at("malformed instance", id); }
+		p = skip_whitespace(p + 1, end);
+		index_entry e = { id, (size_t)(record - begin), schema::NO_TYPE };
+		if (p < end && *p != '(') {
+			p = read_name(p, end, &name);
+			const entity_type * t = s.find_upper(name);
+			if (t) { e.type = t->index(); }
+		}
+		res->entries.push_back(e);
+		if (e.type != schema::NO_TYPE && !rels.for_type(e.type).empty()) {
+			parameter_parser parser(p, end, id);
+			std::vector<value> params = parser.parse_list();
+			const std::vector<std::pair<size_t, int>> & attrs = rels.for_type(e.type);
+			for (auto a = attrs.begin(); a != attrs.end(); ++a) {
+				if ((size_t)a->second >= params.size()) { continue; }
+				size_t key = a->first;
+				auto add = [res, key, id](const value & v) {
+					if (v.kind != value::REFERENCE) { return; }
+					reference_entry ref = { key, v.ref, id };
+					res->references.push_back(ref);
+				};
+				const value & v = params[a->second];
+				if (v.kind == value::LIST) { std::for_each(v.items.begin(), v.items.end(), add); }
+				else { add(v); }
+			}
+			p = parser.position();
+		}
+		p = skip_record(p, end);
+	}
+}
+
+// Guesses where the first record after p starts: the first line that starts
+// with "#<id>=". This might be inside a string literal, which the caller has
+// to check for.
+const char * find_record_start(const char * p, const char * end) {
+	while (p < end) {
+		const char * newline = static_cast<const char *>(memchr(p, '\n', end - p));
+		if (!newline) { return end; }
+		p = newline + 1;
+		const char * q = p;
+		while (q < end && (*q == ' ' || *q == '\t' || *q == '\r')) { ++q; }
+		if (q == end || *q != '#') { continue; }
+		const char * after_id = q + 1;
+		if (read_id(&after_id, end) == 0) { continue; }
+		while (after_id < end && (*after_id == ' ' || *after_id == '\t')) { ++after_id; }
+		if (after_id < end && *after_id == '=') { return q; }
+	}
+	return end;
+}
+
+} // namespace
+
+const char * skip_whitespace(const char * p, const char * end) {
+	while (p < end) {
+		if (isspace((unsigned char)*p)) { ++p; }
+		else if (*p == '/' && p + 1 < end && p[1] == '*') {
+			const char * close = p + 2;
+			while (close + 1 < end && !(close[0] == '*' && close[1] == '/')) { ++close; }
+			p = close + 2 < end ? close + 2 : end;
+		}
+		else { break; }
+	}
+	return p;
+}
+
+const char * skip_record(const char * p, const char * end) {
+	while (p < end) {
+		char c = *p;
+		if (c == ';') { return p + 1; }
+		else if (c == '\'' || c == '"') { p = skip_literal(p, end); }
+		else if (c == '/' && p + 1 < end && p[1] == '*') { p = skip_whitespace(p, end); }
+		else { ++p; }
+	}
+	return end;
+}
+
+entity_id read_id(const char ** p, const char * end) {
+	entity_id res = 0;
+	const char * q = *p;
+	while (q < end && isdigit((unsigned char)*q)) {
+		res = res * 10 + (*q - '0');
+		++q;
+	}
+	*p = q;
+	return res;
+}
+
+file::file(const char * path, size_t chunk_count)
+	: mapping_(path, boost::interprocess::read_only),
+	  region_(mapping_, boost::interprocess::read_only),
+	  max_id_(0),
+	  instance_count_(0)
+{
+	begin_ = static_cast<const char *>(region_.get_address());
+	end_ = begin_ + region_.get_size();
+	build_index(chunk_count);
+}
+
+void file::build_index(size_t chunk_count) {
+	const schema & s = schema::ifc2x3();
+
+	// Find the data section.
+	std::string keyword;
+	const char * p = skip_whitespace(begin_, end_);
+	while (true) {
+		if (p == end_) { throw parse_error("no DATA section"); }
+		const char * after = read_name(p, end_, &keyword);
+		if (keyword == "DATA") {
+			p = skip_whitespace(after, end_);
+			if (p == end_ || *p != ';') { throw parse_error("malformed DATA section"); }
+			data_begin_ = p + 1;
+			break;
+		}
+		p = skip_whitespace(skip_record(p, end_), end_);
+	}
+
+	// Index it, in parallel if it's big enough. The chunk boundaries are
+	// guesses, so if any chunk doesn't end exactly where the next one starts
+	// (because a boundary was inside a string) it's done again in one piece.
+	relationship_attributes rels(s);
+	size_t size = end_ - data_begin_;
+	if (chunk_count == 0) { chunk_count = std::max((size_t)1, std::min(hardware_threads(), size / MIN_CHUNK_BYTES)); }
+	std::vector<const char *> starts(1, skip_whitespace(data_begin_, end_));
+	for (size_t i = 1; i < chunk_count; ++i) {
+		const char * start = find_record_start(data_begin_ + size / chunk_count * i, end_);
+		if (start > starts.back() && start < end_) { starts.push_back(start); }
+	}
+	std::vector<chunk_index> chunks(starts.size());
+	bool consistent = true;
+	try {
+		run_in_parallel(starts.size(), [&](size_t i) {
+			index_chunk(begin_, starts[i], i + 1 < starts.size() ? starts[i + 1] : end_, end_, rels, &chunks[i]);
+		});
+		for (size_t i = 0; i + 1 < chunks.size(); ++i) {
+			consistent = consistent && chunks[i].stop == starts[i + 1] && !chunks[i].data_end;
+		}
+	}
+	catch (const parse_error &) {
+		consistent = false;
+	}
+	if (!consistent) {
+		chunks.assign(1, chunk_index());
+		index_chunk(begin_, starts.front(), end_, end_, rels, &chunks.front());
+	}
+	data_end_ = chunks.back().data_end;
+
+	for (auto c = chunks.begin(); c != chunks.end(); ++c) {
+		for (auto e = c->entries.begin(); e != c->entries.end(); ++e) { max_id_ = std::max(max_id_, e->id); }
+		instance_count_ += c->entries.size();
+	}
+	bool dense = max_id_ / MAX_DENSE_ENTRIES_PER_INSTANCE <= instance_count_;
+	if (dense) {
+		offsets_.assign(max_id_ + 1, 0);
+		types_.assign(max_id_ + 1, schema::NO_TYPE);
+	}
+	else { sparse_.reserve(instance_count_); }
+	for (auto k = rels.keys().begin(); k != rels.keys().end(); ++k) { references_[*k]; }
+	for (auto c = chunks.begin(); c != chunks.end(); ++c) {
+		for (auto e = c->entries.begin(); e != c->entries.end(); ++e) {
+			if (dense) {
+				offsets_[e->id] = e->offset;
+				types_[e->id] = e->type;
+			}
+			else {
+				sparse_entry s = { e->id, e->offset, e->type };
+				sparse_.push_back(s);
+			}
+		}
+		std::vector<index_entry>().swap(c->entries);
+		for (auto r = c->references.begin(); r != c->references.end(); ++r) {
+			references_[rels.keys()[r->key]].insert(std::make_pair(r->target, r->source));
+		}
+		std::vector<reference_entry>().swap(c->references);
+	}
+	if (!dense) {
+		// Records needn't be in ID order. A stable sort keeps duplicates in file
+		// order so that, as with the dense tables, the last one wins.
+		std::stable_sort(sparse_.begin(), sparse_.end(), [](const sparse_entry & a, const sparse_entry & b) {
+			return a.id < b.id;
+		});
+		auto last = std::unique(sparse_.rbegin(), sparse_.rend(), [](const sparse_entry & a, const sparse_entry & b) {
+			return a.id == b.id;
+		});
+		sparse_.erase(sparse_.begin(), last.base());
+	}
+}
+
+size_t file::offset(entity_id id) const {
+	if (!sparse_.empty()) {
+		const sparse_entry * e = find_sparse(id);
+		return e ? e->offset : 0;
+	}
+	return id < offsets_.size() ? offsets_[id] : 0;
+}
+
+unsigned short file::type_index(entity_id id) const {
+	if (!sparse_.empty()) {
+		const sparse_entry * e = find_sparse(id);
+		return e ? e->type : schema::NO_TYPE;
+	}
+	return id < offsets_.size() && offsets_[id] != 0 ? types_[id] : schema::NO_TYPE;
+}
+
+const file::sparse_entry * file::find_sparse(entity_id id) const {
+	auto e = std::lower_bound(sparse_.begin(), sparse_.end(), id, [](const sparse_entry & s, entity_id i) {
+		return s.id < i;
+	});
+	return e != sparse_.end() && e->id == id ? &*e : nullptr;
+}
+
+const file::reference_index * file::relationship_references(unsigned short type, int attribute) const {
+	auto res = references_.find(std::make_pair(type, attribute));
+	return res != references_.end() ? &res->second : nullptr;
+}
+
+instance file::parse(entity_id id) const {
+	instance res;
+	if (!contains(id)) { return res; }
+	const char * p = begin_ + offset(id);
+	while (p < end_ && *p != '=') { ++p; }
+	p = skip_whitespace(p + 1, end_);
+	if (p == end_ || *p == '(') { return res; } // complex instances aren't supported
+	while (p < end_ && is_name_char(*p)) { ++p; }
+	unsigned short type = type_index(id);
+	res.type = type == schema::NO_TYPE ? nullptr : &schema::ifc2x3().type(type);
+	parameter_parser parser(p, end_, id);
+	res.attributes = parser.parse_list();
+	return res;
+}
+
+void value::write(std::string * out) const {
+	char buf[64];
+	switch (kind) {
+		case UNSET: out->push_back('$'); break;
+		case DERIVED: out->push_back('*'); break;
+		case INTEGER:
+			sprintf(buf, "%.0f", number);
+			out->append(buf);
+			break;
+		case REAL:
+			sprintf(buf, "%.17G", number);
+			if (!strchr(buf, '.')) {
+				// SPF reals need a decimal point
+				char * e = strchr(buf, 'E');
+				std::string s(buf);
+				s.insert(e ? e - buf : s.size(), ".");
+				out->append(s);
+			}
+			else { out->append(buf); }
+			break;
+		case STRING: {
+			// Anything outside of ASCII goes in \X2\ (or \X4\) escapes.
+			out->push_back('\'');
+			const char * c = text.data();
+			const char * end = c + text.size();
+			while (c < end) {
+				if ((unsigned char)*c < 0x80) {
+					if (*c == '\'' || *c == '\\') { out->push_back(*c); }
+					out->push_back(*c++);
+					continue;
+				}
+				std::vector<unsigned long> cps;
+				bool wide = false;
+				while (c < end && (unsigned char)*c >= 0x80) {
+					cps.push_back(read_utf8(&c, end));
+					wide = wide || cps.back() > 0xFFFF;
+				}
+				out->append(wide ? "\\X4\\" : "\\X2\\");
+				for (auto cp = cps.begin(); cp != cps.end(); ++cp) {
+					sprintf(buf, wide ? "%08lX" : "%04lX", *cp);
+					out->append(buf);
+				}
+				out->append("\\X0\\");
+			}
+			out->push_back('\'');
+			break;
+		}
+		case ENUMERATION:
+			out->push_back('.');
+			out->append(text);
+			out->push_back('.');
+			break;
+		case BINARY:
+			out->push_back('"');
+			out->append(text);
+			out->push_back('"');
+			break;
+		case REFERENCE:
+			sprintf(buf, "#%u", (unsigned)ref);
+			out->append(buf);
+			break;
+		case LIST:
+		case TYPED:
+			if (kind == TYPED) { out->append(text); }
+			out->push_back('(');
+			for (size_t i = 0; i < items.size(); ++i) {
+				if (i > 0) { out->push_back(','); }
+				items[i].write(out);
+			}
+			out->push_back(')');
+			break;
+	}
+}
+
+} // namespace spf
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include "schema.h"
+#include "spf_value.h"
+
+namespace spf {
+
+class parse_error : public std::runtime_error {
+public:
+	explicit parse_error(const std::string & msg) : std::runtime_error(msg) { }
+};
+
+struct instance {
+	instance() : type(nullptr) { }
+
+	const entity_type * type; // null for complex instances and unknown types
+	std::vector<value> attributes;
+};
+
+// A memory-mapped IFC-SPF (ISO 10303-21) file. Opening one maps it and
+// makes a single pass over the data section to record where each entity
+// instance starts and what type it is. Large files are split into chunks
+// that are indexed in parallel. Relationships are parsed during the pass
+// too, so that the inverse attributes they imply are ready; nothing else is
+// parsed until it's asked for. The file must stay unmodified while this is
+// alive.
+class file {
+public:
+	// For each instance, the instances that refer to it.
+	typedef std::unordered_multimap<entity_id, entity_id> reference_index;
+
+	// The data section is indexed in up to chunk_count chunks. Zero picks a
+	// count from the file's size and the number of hardware threads.
+	explicit file(const char * path, size_t chunk_count = 0);
+
+	// Instance IDs run from 1 to max_id(), with gaps.
+	entity_id max_id() const { return max_id_; }
+	size_t instance_count() const { return instance_count_; }
+	bool contains(entity_id id) const { return offset(id) != 0; }
+	unsigned short type_index(entity_id id) const;
+
+	// Calls f(id) for every instance, in order of ID.
+	template <typename F>
+	void for_each_id(F f) const;
+
+	// The references to each instance through the attribute (by index) of
+	// the relationship type and its subtypes, as the file has them. Null if
+	// the attribute isn't one that an inverse attribute is based on.
+	const reference_index * relationship_references(unsigned short type, int attribute) const;
+
+	// Parses the instance's attributes. Nothing is cached.
+	instance parse(entity_id id) const;
+
+	// The file up to the first instance, the instance records (each
+	// including its terminating semicolon), and the rest of the file after the
+	// last one.
+	const char * begin() const { return begin_; }
+	const char * data_begin() const { return data_begin_; }
+	const char * data_end() const { return data_end_; }
+	const char * end() const { return end_; }
+
+	// Calls f(id, record_begin, record_end) for every instance, in file
+	// order.
+	template <typename F>
+	void for_each_record(F f) const;
+
+private:
+	boost::interprocess::file_mapping mapping_;
+	boost::interprocess::mapped_region region_;
+	const char * begin_;
+	const char * data_begin_;
+	const char * data_end_;
+	const char * end_;
+
+	struct sparse_entry {
+		entity_id id;
+		size_t offset;
+		unsigned short type;
+	};
+
+	// If the IDs are dense enough, offsets_ and types_ are indexed by ID, and
+	// an offset of zero means there's no such instance (no instance can start
+	// at the beginning of the file). Otherwise (because a few huge IDs would
+	// make those enormous) sparse_ has the instances instead, sorted by ID.
+	std::vector<size_t> offsets_;
+	std::vector<unsigned short> types_;
+	std::vector<sparse_entry> sparse_;
+	entity_id max_id_;
+	size_t instance_count_;
+	std::map<std::pair<unsigned short, int>, reference_index> references_;
+
+	void build_index(size_t chunk_count);
+	size_t offset(entity_id id) const;
+	const sparse_entry * find_sparse(entity_id id) const;
+
+	file(const file & disabled);
+	file & operator = (const file & disabled);
+};
+
+// Used by the index and by for_each_record.
+const char * skip_whitespace(const char * p, const char * end);
+const char * skip_record(const char * p, const char * end);
+entity_id read_id(const char ** p, const char * end);
+
+template <typename F>
+void file::for_each_id(F f) const {
+	if (!sparse_.empty()) {
+		for (auto e = sparse_.begin(); e != sparse_.end(); ++e) { f(e->id); }
+	}
+	else {
+		for (entity_id id = 1; id < offsets_.size(); ++id) {
+			if (offsets_[id] != 0) { f(id); }
+		}
+	}
+}
+
+template <typename F>
+void file::for_each_record(F f) const {
+	const char * p = skip_whitespace(data_begin_, data_end_);
+	while (p < data_end_) {
+		const char * record_begin = p;
+		++p; // '#'
+		entity_id id = read_id(&p, data_end_);
+		p = skip_record(p, data_end_);
+		f(id, record_begin, p);
+		p = skip_whitespace(p, data_end_);
+	}
+}
+
+} // namespace spf
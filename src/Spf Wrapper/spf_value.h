@@ -0,0 +1,49 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace spf {
+
+typedef size_t entity_id;
+
+// One parameter of an entity instance. Typed parameters (like
+// IFCLABEL('x') in a select) keep their type name in text and their value
+// as their only item.
+struct value {
+	enum kind_t {
+		UNSET,			// $
+		DERIVED,		// *
+		INTEGER,
+		REAL,
+		STRING,
+		ENUMERATION,	// .T., .ADDED., etc., without the dots
+		BINARY,
+		REFERENCE,
+		LIST,
+		TYPED
+	};
+
+	kind_t kind;
+	double number;
+	std::string text;
+	entity_id ref;
+	std::vector<value> items;
+
+	value() : kind(UNSET), number(0.0), ref(0) { }
+	explicit value(kind_t k) : kind(k), number(0.0), ref(0) { }
+
+	static value make_integer(int i) { value res(INTEGER); res.number = i; return res; }
+	static value make_real(double d) { value res(REAL); res.number = d; return res; }
+	static value make_string(const std::string & s) { value res(STRING); res.text = s; return res; }
+	static value make_enumeration(const std::string & s) { value res(ENUMERATION); res.text = s; return res; }
+	static value make_reference(entity_id id) { value res(REFERENCE); res.ref = id; return res; }
+
+	// Typed parameters are looked through.
+	const value & untyped() const { return kind == TYPED && !items.empty() ? items.front().untyped() : *this; }
+
+	// Appends the parameter in SPF syntax.
+	void write(std::string * out) const;
+};
+
+} // namespace spf